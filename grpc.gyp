@@ -537,6 +537,7 @@
         'src/core/ext/transport/chttp2/transport/huffsyms.cc',
         'src/core/ext/transport/chttp2/transport/incoming_metadata.cc',
         'src/core/ext/transport/chttp2/transport/parsing.cc',
+        'src/core/ext/transport/chttp2/transport/shm_handshaker.cc',
         'src/core/ext/transport/chttp2/transport/stream_lists.cc',
         'src/core/ext/transport/chttp2/transport/stream_map.cc',
         'src/core/ext/transport/chttp2/transport/varint.cc',
@@ -618,6 +619,7 @@
         'src/core/ext/upb-generated/validate/validate.upb.c',
         'src/core/lib/avl/avl.cc',
         'src/core/lib/backoff/backoff.cc',
+        'src/core/lib/channel/call_profiler.cc',
         'src/core/lib/channel/channel_args.cc',
         'src/core/lib/channel/channel_stack.cc',
         'src/core/lib/channel/channel_stack_builder.cc',
@@ -652,6 +654,7 @@
         'src/core/lib/iomgr/endpoint_pair_posix.cc',
         'src/core/lib/iomgr/endpoint_pair_uv.cc',
         'src/core/lib/iomgr/endpoint_pair_windows.cc',
+        'src/core/lib/iomgr/endpoint_shm_posix.cc',
         'src/core/lib/iomgr/error.cc',
         'src/core/lib/iomgr/error_cfstream.cc',
         'src/core/lib/iomgr/ev_apple.cc',
@@ -1043,6 +1046,7 @@
         'src/core/ext/transport/chttp2/transport/huffsyms.cc',
         'src/core/ext/transport/chttp2/transport/incoming_metadata.cc',
         'src/core/ext/transport/chttp2/transport/parsing.cc',
+        'src/core/ext/transport/chttp2/transport/shm_handshaker.cc',
         'src/core/ext/transport/chttp2/transport/stream_lists.cc',
         'src/core/ext/transport/chttp2/transport/stream_map.cc',
         'src/core/ext/transport/chttp2/transport/varint.cc',
@@ -1121,6 +1125,7 @@
         'src/core/ext/upb-generated/validate/validate.upb.c',
         'src/core/lib/avl/avl.cc',
         'src/core/lib/backoff/backoff.cc',
+        'src/core/lib/channel/call_profiler.cc',
         'src/core/lib/channel/channel_args.cc',
         'src/core/lib/channel/channel_stack.cc',
         'src/core/lib/channel/channel_stack_builder.cc',
@@ -1154,6 +1159,7 @@
         'src/core/lib/iomgr/endpoint_pair_posix.cc',
         'src/core/lib/iomgr/endpoint_pair_uv.cc',
         'src/core/lib/iomgr/endpoint_pair_windows.cc',
+        'src/core/lib/iomgr/endpoint_shm_posix.cc',
         'src/core/lib/iomgr/error.cc',
         'src/core/lib/iomgr/error_cfstream.cc',
         'src/core/lib/iomgr/ev_apple.cc',
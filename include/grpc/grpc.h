@@ -204,6 +204,17 @@ GRPCAPI void grpc_channel_watch_connectivity_state(
     grpc_channel* channel, grpc_connectivity_state last_observed_state,
     gpr_timespec deadline, grpc_completion_queue* cq, void* tag);
 
+/** Bring the channel fully up ahead of its first call: resolve its target,
+    connect every subchannel the load balancing policy picks and complete
+    their handshakes. If send_ping is non-zero, also ping each connection
+    and wait for the acks. Once done, tag will be enqueued on cq with
+    success=1. If the channel shuts down or deadline expires first, tag will
+    be enqueued on cq with success=0. */
+GRPCAPI void grpc_channel_warm_up(grpc_channel* channel, int send_ping,
+                                  gpr_timespec deadline,
+                                  grpc_completion_queue* cq, void* tag,
+                                  void* reserved);
+
 /** Check whether a grpc channel supports connectivity watcher */
 GRPCAPI int grpc_channel_support_connectivity_watcher(grpc_channel* channel);
 
@@ -533,6 +544,12 @@ GRPCAPI char* grpc_channelz_get_subchannel(intptr_t subchannel_id);
    is allocated and must be freed by the application. */
 GRPCAPI char* grpc_channelz_get_socket(intptr_t socket_id);
 
+/* Returns the per-method profiles of calls on client channels and servers
+   created with GRPC_ARG_ENABLE_CALL_PROFILING, as a JSON object keyed by
+   method name. The returned string is allocated and must be freed by the
+   application. */
+GRPCAPI char* grpc_call_profiler_get_profiles(void);
+
 #ifdef __cplusplus
 }
 #endif
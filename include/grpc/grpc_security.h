@@ -560,6 +560,42 @@ grpc_ssl_server_credentials_create_options_using_config_fetcher(
 GRPCAPI void grpc_ssl_server_credentials_options_destroy(
     grpc_ssl_server_credentials_options* options);
 
+/** --- SSL Session Ticket Keys. ---
+
+    A SSL session ticket keys object is a set of keys with which SSL servers
+    encrypt the session tickets they issue. Servers sharing the same object,
+    including the servers of other processes whose objects are rotated with the
+    same keys, accept each other's tickets, so that clients can resume their
+    sessions after reconnecting to any of them. */
+
+typedef struct grpc_ssl_session_ticket_keys grpc_ssl_session_ticket_keys;
+
+/** Creates an empty set of session ticket keys that keeps the current key and
+    at most max_keys - 1 previous ones. If max_keys is < 1, a default of 3 is
+    used instead. Servers do not issue tickets until a key has been added. */
+GRPCAPI grpc_ssl_session_ticket_keys* grpc_ssl_session_ticket_keys_create(
+    size_t max_keys);
+
+/** Makes key the current session ticket key: new tickets are encrypted with it,
+    while tickets encrypted with the previous keys still kept are accepted and
+    renewed. key must be GRPC_SSL_SESSION_TICKET_KEY_SIZE random bytes, and
+    should be rotated regularly. Returns 1 on success and 0 on failure. */
+GRPCAPI int grpc_ssl_session_ticket_keys_rotate(
+    grpc_ssl_session_ticket_keys* keys, const unsigned char* key,
+    size_t key_size);
+
+/** Destroys the session ticket keys object. Credentials it was set on keep
+    using the keys. */
+GRPCAPI void grpc_ssl_session_ticket_keys_destroy(
+    grpc_ssl_session_ticket_keys* keys);
+
+/** Makes the SSL server credentials created with options encrypt session
+    tickets with keys instead of a per-server random key. Does not take
+    ownership of keys. */
+GRPCAPI void grpc_ssl_server_credentials_options_set_session_ticket_keys(
+    grpc_ssl_server_credentials_options* options,
+    grpc_ssl_session_ticket_keys* keys);
+
 /** Creates an SSL server_credentials object using the provided options struct.
     - Takes ownership of the options parameter. */
 GRPCAPI grpc_server_credentials*
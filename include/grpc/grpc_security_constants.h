@@ -31,6 +31,9 @@ extern "C" {
 #define GRPC_X509_PEM_CERT_PROPERTY_NAME "x509_pem_cert"
 #define GRPC_X509_PEM_CERT_CHAIN_PROPERTY_NAME "x509_pem_cert_chain"
 #define GRPC_SSL_SESSION_REUSED_PROPERTY "ssl_session_reused"
+/** Size of a key of grpc_ssl_session_ticket_keys: a 16 bytes key name followed
+    by a 16 bytes HMAC-SHA256 key and a 16 bytes AES-128 key. */
+#define GRPC_SSL_SESSION_TICKET_KEY_SIZE 48
 #define GRPC_TRANSPORT_SECURITY_LEVEL_PROPERTY_NAME "security_level"
 #define GRPC_PEER_SPIFFE_ID_PROPERTY_NAME "peer_spiffe_id"
 
@@ -157,6 +157,12 @@ typedef struct {
 /** Maximum message length that the channel can send. Int valued, bytes.
     -1 means unlimited. */
 #define GRPC_ARG_MAX_SEND_MESSAGE_LENGTH "grpc.max_send_message_length"
+/** Experimental Arg, C++ servers only. When positive, the request and
+    response messages of sync and callback methods are each allocated on a
+    protobuf arena whose first block of this many bytes comes from the call
+    arena. Int valued, bytes. Defaults to 0 (disabled). */
+#define GRPC_ARG_MESSAGE_ARENA_INITIAL_BLOCK_SIZE \
+  "grpc.message_arena_initial_block_size"
 /** Maximum time that a channel may have no outstanding rpcs, after which the
  * server will close the connection. Int valued, milliseconds. INT_MAX means
  * unlimited. */
@@ -228,6 +234,13 @@ typedef struct {
 /** Should we allow receipt of true-binary data on http2 connections?
     Defaults to on (1) */
 #define GRPC_ARG_HTTP2_ENABLE_TRUE_BINARY "grpc.http2.true_binary"
+/** Sample the write latency breakdown (queued in gRPC, in the kernel send
+    queue, on the wire until acked) of one in every N streams, using kernel TX
+    timestamps. Results are exported as stats histograms and on the channelz
+    socket. Int valued, defaults to 0 (disabled). Only effective on Linux, and
+    only if no TCP write timestamps callback other than chttp2's is set. */
+#define GRPC_ARG_HTTP2_WRITE_LATENCY_SAMPLE_ONE_IN \
+  "grpc.experimental.http2_write_latency_sample_one_in"
 /** After a duration of this time the client/server pings its peer to see if the
     transport is still alive. Int valued, milliseconds. */
 #define GRPC_ARG_KEEPALIVE_TIME_MS "grpc.keepalive_time_ms"
@@ -255,6 +268,14 @@ typedef struct {
 /** The time between the first and second connection attempts, in ms */
 #define GRPC_ARG_INITIAL_RECONNECT_BACKOFF_MS \
   "grpc.initial_reconnect_backoff_ms"
+/** Number of HTTP/2 connections each subchannel keeps open to its address.
+    Calls are spread across them round-robin, so that a single busy backend
+    is not limited to one connection's flow control window and
+    MAX_CONCURRENT_STREAMS. The subchannel reports READY once the first
+    connection is up and opens the others one at a time after it. Int valued,
+    1 to 64. Defaults to 1. */
+#define GRPC_ARG_SUBCHANNEL_CONNECTIONS \
+  "grpc.experimental.subchannel_connections"
 /** Minimum amount of time between DNS resolutions, in ms */
 #define GRPC_ARG_DNS_MIN_TIME_BETWEEN_RESOLUTIONS_MS \
   "grpc.dns_min_time_between_resolutions_ms"
@@ -273,6 +294,12 @@ typedef struct {
     grpc_ssl_session_cache*). (use grpc_ssl_session_cache_arg_vtable() to fetch
     an appropriate pointer arg vtable) */
 #define GRPC_SSL_SESSION_CACHE_ARG "grpc.ssl_session_cache"
+/** If non-zero and no GRPC_SSL_SESSION_CACHE_ARG is given, SSL channels cache
+    their client sessions in a cache shared by the whole process, so that new
+    channels to the same target resume the sessions of previous ones instead of
+    doing a full handshake. Sessions are only resumed by channels whose
+    credentials trust the same roots. Defaults to 0. */
+#define GRPC_ARG_SSL_SHARED_SESSION_CACHE "grpc.ssl_shared_session_cache"
 /** If non-zero, it will determine the maximum frame size used by TSI's frame
  *  protector.
  *
@@ -281,6 +308,34 @@ typedef struct {
  *        can break old binaries that don't support larger than 1MiB frame
  *        size. */
 #define GRPC_ARG_TSI_MAX_FRAME_SIZE "grpc.tsi.max_frame_size"
+/** If non-zero, try to hand record encryption of the sending direction of a
+ *  TLS connection to the Linux kernel (kTLS) once the handshake completes, so
+ *  that the TCP endpoint writes plaintext. Connections whose kernel or
+ *  negotiated cipher does not support it keep protecting records in user
+ *  space. Defaults to 0. */
+#define GRPC_ARG_ENABLE_KERNEL_TLS "grpc.experimental.enable_kernel_tls"
+/** If non-zero, TLS connections protect and unprotect records directly in
+ *  grpc_slice_buffers instead of going through the SSL frame protector's
+ *  staging buffers. Needs OpenSSL 1.1.0 or BoringSSL. Defaults to 0. */
+#define GRPC_ARG_ENABLE_SSL_ZERO_COPY_PROTECTOR \
+  "grpc.experimental.ssl_zero_copy_protector"
+/** If non-zero, run the CPU-heavy steps of security handshakes (key exchange
+ *  and certificate signing/verification) on a dedicated handshake thread pool
+ *  instead of inline on the thread polling the connection, so that a storm of
+ *  new connections does not stall I/O for established ones. Defaults to 0. */
+#define GRPC_ARG_OFFLOAD_HANDSHAKES "grpc.experimental.offload_handshakes"
+/** Maximum number of handshake steps waiting for the handshake thread pool
+ *  when GRPC_ARG_OFFLOAD_HANDSHAKES is set. Handshakes arriving while the
+ *  queue is full fail with UNAVAILABLE. Defaults to 1024. */
+#define GRPC_ARG_HANDSHAKE_OFFLOAD_MAX_PENDING \
+  "grpc.experimental.handshake_offload_max_pending"
+/** If non-zero on both the client and the server of a Unix domain socket
+ *  connection, the two sides switch the connection over to a pair of
+ *  shared-memory rings right after connecting, and keep the socket only to
+ *  notice when the peer goes away. Set implicitly by "shm:" addresses.
+ *  Only effective on Linux. Defaults to 0. */
+#define GRPC_ARG_UNIX_SOCKET_SHARED_MEMORY \
+  "grpc.experimental.unix_socket_shared_memory"
 /** Maximum metadata size, in bytes. Note this limit applies to the max sum of
     all metadata key-value entries in a batch of headers. */
 #define GRPC_ARG_MAX_METADATA_SIZE "grpc.max_metadata_size"
@@ -314,6 +369,11 @@ typedef struct {
  * level. Disabling channelz naturally disables channel tracing. The default
  * is for channelz to be enabled. */
 #define GRPC_ARG_ENABLE_CHANNELZ "grpc.enable_channelz"
+/** If non-zero, calls on this client channel or server record arena usage,
+ * time spent in the filter stack, the transport and the application, and
+ * bytes on the wire into per-method histograms, which can be read with
+ * grpc_call_profiler_get_profiles(). Defaults to 0. */
+#define GRPC_ARG_ENABLE_CALL_PROFILING "grpc.experimental.enable_call_profiling"
 /** If non-zero, Cronet transport will coalesce packets to fewer frames
  * when possible. */
 #define GRPC_ARG_USE_CRONET_PACKET_COALESCING \
@@ -343,6 +403,11 @@ typedef struct {
    issued by the tcp_write(). By default, this is set to 4. */
 #define GRPC_ARG_TCP_TX_ZEROCOPY_MAX_SIMULT_SENDS \
   "grpc.experimental.tcp_tx_zerocopy_max_simultaneous_sends"
+/* Send buffer size, in bytes, to request for Unix domain socket endpoints.
+   The kernel caps it at net.core.wmem_max. If 0 or unset, the kernel default
+   is kept. */
+#define GRPC_ARG_UNIX_SOCKET_SNDBUF_SIZE \
+  "grpc.experimental.unix_socket_sndbuf_size"
 /* Timeout in milliseconds to use for calls to the grpclb load balancer.
    If 0 or unset, the balancer calls will have no deadline. */
 #define GRPC_ARG_GRPCLB_CALL_TIMEOUT_MS "grpc.grpclb_call_timeout_ms"
@@ -355,6 +420,15 @@ typedef struct {
    over to the next priority. Default value is 10 seconds. */
 #define GRPC_ARG_PRIORITY_FAILOVER_TIMEOUT_MS \
   "grpc.priority_failover_timeout_ms"
+/* Delay in milliseconds after which the pick_first LB policy starts
+   connecting to the next address while earlier connection attempts are
+   still pending (the "Connection Attempt Delay" of RFC 8305). The first
+   attempt to succeed is used and the others are abandoned. An attempt
+   succeeds once its subchannel is READY, i.e. after the security handshake,
+   so the delay should cover that too. If 0, addresses are tried one at a
+   time. Default value is 0; RFC 8305 recommends 250. */
+#define GRPC_ARG_HAPPY_EYEBALLS_CONNECTION_ATTEMPT_DELAY_MS \
+  "grpc.experimental.happy_eyeballs_connection_attempt_delay_ms"
 /* Timeout in milliseconds to wait for a resource to be returned from
  * the xds server before assuming that it does not exist.
  * The default is 15 seconds. */
@@ -408,6 +482,13 @@ typedef struct {
  * timeouts/backoff/retry logic, and so the actual DNS resolution may time out
  * sooner than the value specified here. */
 #define GRPC_ARG_DNS_ARES_QUERY_TIMEOUT_MS "grpc.dns_ares_query_timeout"
+/** If set, the c-ares based DNS resolver shares its results with every other
+ * channel that sets this arg, through a process-wide cache. Entries live for
+ * the smallest TTL of the address records they came from, capped at 5
+ * minutes. Concurrent lookups of the same name are coalesced into one, and
+ * entries close to expiry are refreshed when they are used. Failed lookups
+ * are not cached. Defaults to false. */
+#define GRPC_ARG_DNS_ARES_ENABLE_CACHE "grpc.experimental.dns_ares_enable_cache"
 /** If set, uses a local subchannel pool within the channel. Otherwise, uses the
  * global subchannel pool. */
 #define GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL "grpc.use_local_subchannel_pool"
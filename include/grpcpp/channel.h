@@ -30,6 +30,13 @@ namespace experimental {
 /// TODO(roth): Once we see whether this proves useful, either create a gRFC
 /// and change this to be a method of the Channel class, or remove it.
 void ChannelResetConnectionBackoff(Channel* channel);
+
+/// Brings the channel fully up ahead of its first RPC: resolves its target,
+/// connects every subchannel the load balancing policy picks and completes
+/// their handshakes, and if \a send_ping is set, pings each connection.
+/// Blocks until that is done, returning true, or until the channel shuts
+/// down or \a deadline passes, returning false.
+bool ChannelWarmUp(Channel* channel, gpr_timespec deadline, bool send_ping);
 }  // namespace experimental
 
 }  // namespace grpc
@@ -61,16 +61,19 @@ class RpcMethodHandler : public ::grpc::internal::MethodHandler {
       : func_(func), service_(service) {}
 
   void RunHandler(const HandlerParameter& param) final {
-    ResponseType rsp;
+    ResponseType* rsp =
+        ::grpc::internal::MessageArenaTraits<ResponseType>::Create(
+            param.call->call(), message_arena_block_size());
     ::grpc::Status status = param.status;
     if (status.ok()) {
-      status = CatchingFunctionHandler([this, &param, &rsp] {
+      status = CatchingFunctionHandler([this, &param, rsp] {
         return func_(
             service_,
             static_cast<::grpc_impl::ServerContext*>(param.server_context),
-            static_cast<RequestType*>(param.request), &rsp);
+            static_cast<RequestType*>(param.request), rsp);
       });
-      static_cast<RequestType*>(param.request)->~RequestType();
+      ::grpc::internal::MessageArenaTraits<RequestType>::Destroy(
+          static_cast<RequestType*>(param.request));
     }
 
     GPR_CODEGEN_ASSERT(!param.server_context->sent_initial_metadata_);
@@ -84,27 +87,27 @@ class RpcMethodHandler : public ::grpc::internal::MethodHandler {
       ops.set_compression_level(param.server_context->compression_level());
     }
     if (status.ok()) {
-      status = ops.SendMessagePtr(&rsp);
+      status = ops.SendMessagePtr(rsp);
     }
     ops.ServerSendStatus(&param.server_context->trailing_metadata_, status);
     param.call->PerformOps(&ops);
     param.call->cq()->Pluck(&ops);
+    ::grpc::internal::MessageArenaTraits<ResponseType>::Destroy(rsp);
   }
 
   void* Deserialize(grpc_call* call, grpc_byte_buffer* req,
                     ::grpc::Status* status, void** /*handler_data*/) final {
     ::grpc::ByteBuffer buf;
     buf.set_buffer(req);
-    auto* request =
-        new (::grpc::g_core_codegen_interface->grpc_call_arena_alloc(
-            call, sizeof(RequestType))) RequestType();
+    auto* request = ::grpc::internal::MessageArenaTraits<RequestType>::Create(
+        call, message_arena_block_size());
     *status =
         ::grpc::SerializationTraits<RequestType>::Deserialize(&buf, request);
     buf.Release();
     if (status->ok()) {
       return request;
     }
-    request->~RequestType();
+    ::grpc::internal::MessageArenaTraits<RequestType>::Destroy(request);
     return nullptr;
   }
 
@@ -133,13 +136,15 @@ class ClientStreamingHandler : public ::grpc::internal::MethodHandler {
     ::grpc_impl::ServerReader<RequestType> reader(
         param.call,
         static_cast<::grpc_impl::ServerContext*>(param.server_context));
-    ResponseType rsp;
+    ResponseType* rsp =
+        ::grpc::internal::MessageArenaTraits<ResponseType>::Create(
+            param.call->call(), message_arena_block_size());
     ::grpc::Status status =
-        CatchingFunctionHandler([this, &param, &reader, &rsp] {
+        CatchingFunctionHandler([this, &param, &reader, rsp] {
           return func_(
               service_,
               static_cast<::grpc_impl::ServerContext*>(param.server_context),
-              &reader, &rsp);
+              &reader, rsp);
         });
 
     ::grpc::internal::CallOpSet<::grpc::internal::CallOpSendInitialMetadata,
@@ -154,11 +159,12 @@ class ClientStreamingHandler : public ::grpc::internal::MethodHandler {
       }
     }
     if (status.ok()) {
-      status = ops.SendMessagePtr(&rsp);
+      status = ops.SendMessagePtr(rsp);
     }
     ops.ServerSendStatus(&param.server_context->trailing_metadata_, status);
     param.call->PerformOps(&ops);
     param.call->cq()->Pluck(&ops);
+    ::grpc::internal::MessageArenaTraits<ResponseType>::Destroy(rsp);
   }
 
  private:
@@ -193,7 +199,8 @@ class ServerStreamingHandler : public ::grpc::internal::MethodHandler {
             static_cast<::grpc_impl::ServerContext*>(param.server_context),
             static_cast<RequestType*>(param.request), &writer);
       });
-      static_cast<RequestType*>(param.request)->~RequestType();
+      ::grpc::internal::MessageArenaTraits<RequestType>::Destroy(
+          static_cast<RequestType*>(param.request));
     }
 
     ::grpc::internal::CallOpSet<::grpc::internal::CallOpSendInitialMetadata,
@@ -218,16 +225,15 @@ class ServerStreamingHandler : public ::grpc::internal::MethodHandler {
                     ::grpc::Status* status, void** /*handler_data*/) final {
     ::grpc::ByteBuffer buf;
     buf.set_buffer(req);
-    auto* request =
-        new (::grpc::g_core_codegen_interface->grpc_call_arena_alloc(
-            call, sizeof(RequestType))) RequestType();
+    auto* request = ::grpc::internal::MessageArenaTraits<RequestType>::Create(
+        call, message_arena_block_size());
     *status =
         ::grpc::SerializationTraits<RequestType>::Deserialize(&buf, request);
     buf.Release();
     if (status->ok()) {
       return request;
     }
-    request->~RequestType();
+    ::grpc::internal::MessageArenaTraits<RequestType>::Destroy(request);
     return nullptr;
   }
 
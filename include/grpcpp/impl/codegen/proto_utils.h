@@ -29,6 +29,7 @@
 #include <grpcpp/impl/codegen/core_codegen_interface.h>
 #include <grpcpp/impl/codegen/proto_buffer_reader.h>
 #include <grpcpp/impl/codegen/proto_buffer_writer.h>
+#include <grpcpp/impl/codegen/rpc_service_method.h>
 #include <grpcpp/impl/codegen/serialization_traits.h>
 #include <grpcpp/impl/codegen/slice.h>
 #include <grpcpp/impl/codegen/status.h>
@@ -50,7 +51,11 @@ Status GenericSerialize(const grpc::protobuf::MessageLite& msg, ByteBuffer* bb,
                 "::protobuf::io::ZeroCopyOutputStream");
   *own_buffer = true;
   int byte_size = msg.ByteSizeLong();
-  if ((size_t)byte_size <= GRPC_SLICE_INLINED_SIZE) {
+  // The serialized size is known up front, so any message that fits in one
+  // writer block is serialized straight into a single exactly-sized slice
+  // (inlined when small enough). This skips the ZeroCopyOutputStream
+  // round-trips and the extra raw byte buffer the writer would set up.
+  if (byte_size <= kProtoBufferWriterMaxBufferLength) {
     Slice slice(byte_size);
     // We serialize directly into the allocated slices memory
     GPR_CODEGEN_ASSERT(slice.end() == msg.SerializeWithCachedSizesToArray(
@@ -112,6 +117,59 @@ class SerializationTraits<
     return GenericDeserialize<ProtoBufferReader, T>(buffer, msg);
   }
 };
+
+namespace internal {
+// Gives each protobuf message created by a method handler its own
+// protobuf::Arena when a block size is configured. The arena and its initial
+// block are carved out of the call arena, so the message and all of its
+// submessages, strings and repeated fields are allocated without touching the
+// heap until the block is exhausted, and are released in one go.
+template <class T>
+class MessageArenaTraits<
+    T, typename std::enable_if<
+           std::is_base_of<grpc::protobuf::MessageLite, T>::value>::type> {
+ public:
+  static T* Create(grpc_call* call, size_t block_size) {
+    return Create(
+        call, block_size,
+        std::integral_constant<
+            bool, protobuf::Arena::is_arena_constructable<T>::value>());
+  }
+
+  static void Destroy(T* msg) {
+    protobuf::Arena* arena = msg->GetArena();
+    if (arena == nullptr) {
+      msg->~T();
+      return;
+    }
+    // Destroys the message and frees any blocks allocated past the initial
+    // one; the arena itself lives in the call arena.
+    arena->~Arena();
+  }
+
+ private:
+  static T* Create(grpc_call* call, size_t block_size,
+                   std::true_type /*arena_constructable*/) {
+    if (block_size == 0) {
+      return Create(call, block_size, std::false_type());
+    }
+    char* mem =
+        static_cast<char*>(g_core_codegen_interface->grpc_call_arena_alloc(
+            call, sizeof(protobuf::Arena) + block_size));
+    protobuf::ArenaOptions options;
+    options.initial_block = mem + sizeof(protobuf::Arena);
+    options.initial_block_size = block_size;
+    auto* arena = new (mem) protobuf::Arena(options);
+    return protobuf::Arena::CreateMessage<T>(arena);
+  }
+
+  static T* Create(grpc_call* call, size_t /*block_size*/,
+                   std::false_type /*arena_constructable*/) {
+    return new (g_core_codegen_interface->grpc_call_arena_alloc(
+        call, sizeof(T))) T();
+  }
+};
+}  // namespace internal
 #endif
 
 }  // namespace grpc
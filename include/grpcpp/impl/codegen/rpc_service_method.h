@@ -28,6 +28,7 @@
 #include <grpc/impl/codegen/log.h>
 #include <grpcpp/impl/codegen/byte_buffer.h>
 #include <grpcpp/impl/codegen/config.h>
+#include <grpcpp/impl/codegen/core_codegen_interface.h>
 #include <grpcpp/impl/codegen/rpc_method.h>
 #include <grpcpp/impl/codegen/status.h>
 
@@ -37,6 +38,22 @@ class ServerContextBase;
 
 namespace grpc {
 namespace internal {
+/// Creates and destroys the request and response messages that method
+/// handlers own. The default places the message in the call arena; message
+/// types that support it may specialize this to allocate from an arena of
+/// their own (see proto_utils.h). \a block_size is the size of the initial
+/// block such an arena may take from the call arena, 0 meaning none.
+template <class Message,
+          class UnusedButHereForPartialTemplateSpecialization = void>
+class MessageArenaTraits {
+ public:
+  static Message* Create(grpc_call* call, size_t /*block_size*/) {
+    return new (g_core_codegen_interface->grpc_call_arena_alloc(
+        call, sizeof(Message))) Message();
+  }
+  static void Destroy(Message* msg) { msg->~Message(); }
+};
+
 /// Base class for running an RPC handler.
 class MethodHandler {
  public:
@@ -81,6 +98,18 @@ class MethodHandler {
     GPR_CODEGEN_ASSERT(req == nullptr);
     return nullptr;
   }
+
+  /// Sets the initial block size handed to MessageArenaTraits when this
+  /// handler creates messages. Called by the server before it is started.
+  void set_message_arena_block_size(size_t block_size) {
+    message_arena_block_size_ = block_size;
+  }
+
+ protected:
+  size_t message_arena_block_size() const { return message_arena_block_size_; }
+
+ private:
+  size_t message_arena_block_size_ = 0;
 };
 
 /// Server side rpc method class
@@ -92,7 +92,8 @@ class CallbackUnaryHandler : public ::grpc::internal::MethodHandler {
       allocator_state =
           new (::grpc::g_core_codegen_interface->grpc_call_arena_alloc(
               call, sizeof(DefaultMessageHolder<RequestType, ResponseType>)))
-              DefaultMessageHolder<RequestType, ResponseType>();
+              DefaultMessageHolder<RequestType, ResponseType>(
+                  call, message_arena_block_size());
     }
     *handler_data = allocator_state;
     request = allocator_state->request();
@@ -487,16 +488,15 @@ class CallbackServerStreamingHandler : public ::grpc::internal::MethodHandler {
                     ::grpc::Status* status, void** /*handler_data*/) final {
     ::grpc::ByteBuffer buf;
     buf.set_buffer(req);
-    auto* request =
-        new (::grpc::g_core_codegen_interface->grpc_call_arena_alloc(
-            call, sizeof(RequestType))) RequestType();
+    auto* request = ::grpc::internal::MessageArenaTraits<RequestType>::Create(
+        call, message_arena_block_size());
     *status =
         ::grpc::SerializationTraits<RequestType>::Deserialize(&buf, request);
     buf.Release();
     if (status->ok()) {
       return request;
     }
-    request->~RequestType();
+    ::grpc::internal::MessageArenaTraits<RequestType>::Destroy(request);
     return nullptr;
   }
 
@@ -618,7 +618,11 @@ class CallbackServerStreamingHandler : public ::grpc::internal::MethodHandler {
       // DefaultReactor (which is unary).
       this->MaybeDone(/*inlineable_ondone=*/false);
     }
-    ~ServerCallbackWriterImpl() { req_->~RequestType(); }
+    ~ServerCallbackWriterImpl() {
+      if (req_ != nullptr) {
+        ::grpc::internal::MessageArenaTraits<RequestType>::Destroy(req_);
+      }
+    }
 
     const RequestType* request() { return req_; }
 
@@ -28,6 +28,7 @@
 #include <grpcpp/impl/codegen/config.h>
 #include <grpcpp/impl/codegen/core_codegen_interface.h>
 #include <grpcpp/impl/codegen/message_allocator.h>
+#include <grpcpp/impl/codegen/rpc_service_method.h>
 #include <grpcpp/impl/codegen/status.h>
 
 namespace grpc_impl {
@@ -160,18 +161,18 @@ template <class Request, class Response>
 class DefaultMessageHolder
     : public ::grpc::experimental::MessageHolder<Request, Response> {
  public:
-  DefaultMessageHolder() {
-    this->set_request(&request_obj_);
-    this->set_response(&response_obj_);
+  DefaultMessageHolder(grpc_call* call, size_t message_arena_block_size) {
+    this->set_request(::grpc::internal::MessageArenaTraits<Request>::Create(
+        call, message_arena_block_size));
+    this->set_response(::grpc::internal::MessageArenaTraits<Response>::Create(
+        call, message_arena_block_size));
   }
   void Release() override {
+    ::grpc::internal::MessageArenaTraits<Request>::Destroy(this->request());
+    ::grpc::internal::MessageArenaTraits<Response>::Destroy(this->response());
     // the object is allocated in the call arena.
     this->~DefaultMessageHolder<Request, Response>();
   }
-
- private:
-  Request request_obj_;
-  Response response_obj_;
 };
 
 }  // namespace internal
@@ -275,6 +275,16 @@ class ServerBuilder {
       builder_->interceptor_creators_ = std::move(interceptor_creators);
     }
 
+    /// Allocate the request and response messages of sync and callback
+    /// methods on per-message protobuf arenas, each seeded with an initial
+    /// block of \a initial_block_size bytes taken from the call's arena.
+    /// Messages of async methods are owned by the application and are not
+    /// affected. Sets GRPC_ARG_MESSAGE_ARENA_INITIAL_BLOCK_SIZE.
+    ServerBuilder& SetMessageArenaInitialBlockSize(int initial_block_size) {
+      return builder_->AddChannelArgument(
+          GRPC_ARG_MESSAGE_ARENA_INITIAL_BLOCK_SIZE, initial_block_size);
+    }
+
 #ifndef GRPC_CALLBACK_API_NONEXPERIMENTAL
     /// Register a generic service that uses the callback API.
     /// Matches requests with any :authority
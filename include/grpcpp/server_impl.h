@@ -312,6 +312,10 @@ class Server : public grpc::ServerInterface, private grpc::GrpcLibraryCodegen {
 
   int max_receive_message_size_;
 
+  // Initial block size of the per-message protobuf arenas used by sync and
+  // callback method handlers; 0 disables them.
+  size_t message_arena_block_size_;
+
   /// The following completion queues are ONLY used in case of Sync API
   /// i.e. if the server has any services with sync methods. The server uses
   /// these completion queues to poll for new RPCs
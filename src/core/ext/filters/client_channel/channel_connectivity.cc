@@ -262,3 +262,69 @@ void grpc_channel_watch_connectivity_state(
     abort();
   }
 }
+
+namespace {
+struct warm_up_request {
+  grpc_closure on_complete;
+  grpc_cq_completion completion_storage;
+  grpc_completion_queue* cq;
+  grpc_channel* channel;
+  void* tag;
+};
+}  // namespace
+
+static void warm_up_finished_completion(void* pr,
+                                        grpc_cq_completion* /*ignored*/) {
+  warm_up_request* r = static_cast<warm_up_request*>(pr);
+  GRPC_CHANNEL_INTERNAL_UNREF(r->channel, "warm_up");
+  gpr_free(r);
+}
+
+static void warm_up_complete(void* pr, grpc_error* error) {
+  warm_up_request* r = static_cast<warm_up_request*>(pr);
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_trace_operation_failures)) {
+    GRPC_LOG_IF_ERROR("warm_up_error", GRPC_ERROR_REF(error));
+  }
+  grpc_cq_end_op(r->cq, r->tag, GRPC_ERROR_REF(error),
+                 warm_up_finished_completion, r, &r->completion_storage);
+}
+
+void grpc_channel_warm_up(grpc_channel* channel, int send_ping,
+                          gpr_timespec deadline, grpc_completion_queue* cq,
+                          void* tag, void* reserved) {
+  grpc_channel_element* client_channel_elem =
+      grpc_channel_stack_last_element(grpc_channel_get_channel_stack(channel));
+  grpc_core::ApplicationCallbackExecCtx callback_exec_ctx;
+  grpc_core::ExecCtx exec_ctx;
+  GRPC_API_TRACE(
+      "grpc_channel_warm_up("
+      "channel=%p, send_ping=%d, "
+      "deadline=gpr_timespec { tv_sec: %" PRId64
+      ", tv_nsec: %d, clock_type: %d }, "
+      "cq=%p, tag=%p, reserved=%p)",
+      8,
+      (channel, send_ping, deadline.tv_sec, deadline.tv_nsec,
+       (int)deadline.clock_type, cq, tag, reserved));
+  GPR_ASSERT(reserved == nullptr);
+  GPR_ASSERT(grpc_cq_begin_op(cq, tag));
+  warm_up_request* r = static_cast<warm_up_request*>(gpr_malloc(sizeof(*r)));
+  GRPC_CLOSURE_INIT(&r->on_complete, warm_up_complete, r,
+                    grpc_schedule_on_exec_ctx);
+  r->cq = cq;
+  r->tag = tag;
+  r->channel = channel;
+  GRPC_CHANNEL_INTERNAL_REF(channel, "warm_up");
+  if (client_channel_elem->filter != &grpc_client_channel_filter) {
+    grpc_core::ExecCtx::Run(
+        DEBUG_LOCATION, &r->on_complete,
+        GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+            "grpc_channel_warm_up called on something that is not a client "
+            "channel"));
+    return;
+  }
+  grpc_client_channel_warm_up(
+      client_channel_elem,
+      grpc_polling_entity_create_from_pollset(grpc_cq_pollset(cq)),
+      send_ping != 0, grpc_timespec_to_millis_round_up(deadline),
+      &r->on_complete);
+}
@@ -198,11 +198,15 @@ class ChannelData {
   void RemoveConnectivityWatcher(
       AsyncConnectivityStateWatcherInterface* watcher);
 
+  void WarmUp(grpc_polling_entity pollent, bool send_ping,
+              grpc_millis deadline, grpc_closure* on_complete);
+
  private:
   class SubchannelWrapper;
   class ClientChannelControlHelper;
   class ConnectivityWatcherAdder;
   class ConnectivityWatcherRemover;
+  class WarmUpRequest;
 
   // Represents a pending connectivity callback from an external caller
   // via grpc_client_channel_watch_connectivity_state().
@@ -241,6 +245,9 @@ class ChannelData {
       grpc_connectivity_state state, const char* reason,
       std::unique_ptr<LoadBalancingPolicy::SubchannelPicker> picker);
 
+  // Lets pending warm-ups re-check the channel and subchannel states.
+  void CheckWarmUpRequestsLocked();
+
   void UpdateServiceConfigLocked(
       RefCountedPtr<ServerRetryThrottleData> retry_throttle_data,
       RefCountedPtr<ServiceConfig> service_config);
@@ -312,6 +319,9 @@ class ChannelData {
   // applied in the data plane mutex when the picker is updated.
   std::map<RefCountedPtr<SubchannelWrapper>, RefCountedPtr<ConnectedSubchannel>>
       pending_subchannel_updates_;
+  // Pending grpc_client_channel_warm_up() requests.  Each holds a ref to
+  // itself while it is in the set.
+  std::set<WarmUpRequest*> warm_up_requests_;
 
   //
   // Fields accessed from both data plane mutex and control plane
@@ -986,14 +996,22 @@ class ChannelData::SubchannelWrapper : public SubchannelInterface {
     return connected_subchannel_.get();
   }
 
-  // Caller must be holding the data-plane mutex.
-  ConnectedSubchannel* connected_subchannel_in_data_plane() const {
-    return connected_subchannel_in_data_plane_.get();
+  // Unlike CheckConnectivityState(), does not update connected_subchannel_.
+  grpc_connectivity_state connectivity_state() const {
+    return subchannel_->CheckConnectivityState(
+        health_check_service_name_.get(), nullptr);
   }
+
+  // Caller must be holding the data-plane mutex.
   void set_connected_subchannel_in_data_plane(
       RefCountedPtr<ConnectedSubchannel> connected_subchannel) {
     connected_subchannel_in_data_plane_ = std::move(connected_subchannel);
   }
+  RefCountedPtr<ConnectedSubchannel> PickConnectedSubchannelInDataPlane() {
+    if (connected_subchannel_in_data_plane_ == nullptr) return nullptr;
+    return subchannel_->PickConnectedSubchannel(
+        connected_subchannel_in_data_plane_.get());
+  }
 
  private:
   // Subchannel and SubchannelInterface have different interfaces for
@@ -1078,6 +1096,9 @@ class ChannelData::SubchannelWrapper : public SubchannelInterface {
         parent_->MaybeUpdateConnectedSubchannel(
             std::move(state_change.connected_subchannel));
         watcher_->OnConnectivityStateChange(state_change.state);
+        // The LB policy need not update its picker for every subchannel
+        // transition, e.g. once it is already READY.
+        parent_->chand_->CheckWarmUpRequestsLocked();
       }
     }
 
@@ -1254,6 +1275,142 @@ class ChannelData::ConnectivityWatcherRemover {
   AsyncConnectivityStateWatcherInterface* watcher_;
 };
 
+//
+// ChannelData::WarmUpRequest
+//
+
+// Brings the channel up ahead of its first call, on behalf of
+// grpc_client_channel_warm_up().  All methods other than the closures'
+// entry points run in the control-plane work_serializer.
+class ChannelData::WarmUpRequest : public RefCounted<WarmUpRequest> {
+ public:
+  WarmUpRequest(ChannelData* chand, grpc_polling_entity pollent,
+                bool send_ping, grpc_millis deadline,
+                grpc_closure* on_complete)
+      : chand_(chand),
+        pollent_(pollent),
+        send_ping_(send_ping),
+        deadline_(deadline),
+        on_complete_(on_complete) {
+    grpc_polling_entity_add_to_pollset_set(&pollent_,
+                                           chand_->interested_parties_);
+    GRPC_CHANNEL_STACK_REF(chand_->owning_stack_, "WarmUpRequest");
+    GRPC_CLOSURE_INIT(&on_timeout_, OnTimeout, this, nullptr);
+  }
+
+  ~WarmUpRequest() {
+    grpc_polling_entity_del_from_pollset_set(&pollent_,
+                                             chand_->interested_parties_);
+    GRPC_ERROR_UNREF(ping_error_);
+    GRPC_CHANNEL_STACK_UNREF(chand_->owning_stack_, "WarmUpRequest");
+  }
+
+  void StartLocked() {
+    chand_->warm_up_requests_.insert(this);
+    Ref().release();  // Ref held by timer callback.
+    grpc_timer_init(&timer_, deadline_, &on_timeout_);
+    CheckProgressLocked();
+  }
+
+  // Finishes the request if the channel is READY and every subchannel that
+  // the LB policy tried to connect has either connected or failed.
+  void CheckProgressLocked() {
+    if (done_ || pending_pings_ > 0) return;
+    switch (chand_->state_tracker_.state()) {
+      case GRPC_CHANNEL_READY:
+        break;
+      case GRPC_CHANNEL_IDLE:
+        chand_->CheckConnectivityState(/*try_to_connect=*/true);
+        return;
+      case GRPC_CHANNEL_SHUTDOWN:
+        FinishLocked(GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+            "Channel shut down while warming up"));
+        return;
+      default:
+        return;
+    }
+    // A READY subchannel whose connected subchannel we have not seen yet is
+    // about to be handed to the data plane by the next picker update.
+    for (SubchannelWrapper* subchannel : chand_->subchannel_wrappers_) {
+      grpc_connectivity_state state = subchannel->connectivity_state();
+      if (state == GRPC_CHANNEL_CONNECTING ||
+          (state == GRPC_CHANNEL_READY &&
+           subchannel->connected_subchannel() == nullptr)) {
+        return;
+      }
+    }
+    if (send_ping_) {
+      for (SubchannelWrapper* subchannel : chand_->subchannel_wrappers_) {
+        ConnectedSubchannel* connected_subchannel =
+            subchannel->connected_subchannel();
+        if (connected_subchannel == nullptr) continue;
+        ++pending_pings_;
+        Ref().release();  // Ref held by ping callback.
+        connected_subchannel->Ping(
+            nullptr, GRPC_CLOSURE_CREATE(OnPingAck, this, nullptr));
+      }
+      if (pending_pings_ > 0) return;
+    }
+    FinishLocked(GRPC_ERROR_NONE);
+  }
+
+ private:
+  static void OnPingAck(void* arg, grpc_error* error) {
+    auto* self = static_cast<WarmUpRequest*>(arg);
+    GRPC_ERROR_REF(error);
+    self->chand_->work_serializer_->Run(
+        [self, error]() {
+          // Report the first ping that failed, if any.
+          if (self->ping_error_ == GRPC_ERROR_NONE) {
+            self->ping_error_ = error;
+          } else {
+            GRPC_ERROR_UNREF(error);
+          }
+          if (--self->pending_pings_ == 0 && !self->done_) {
+            grpc_error* ping_error = self->ping_error_;
+            self->ping_error_ = GRPC_ERROR_NONE;
+            self->FinishLocked(ping_error);
+          }
+          self->Unref();
+        },
+        DEBUG_LOCATION);
+  }
+
+  static void OnTimeout(void* arg, grpc_error* error) {
+    auto* self = static_cast<WarmUpRequest*>(arg);
+    GRPC_ERROR_REF(error);
+    self->chand_->work_serializer_->Run(
+        [self, error]() {
+          if (error == GRPC_ERROR_NONE && !self->done_) {
+            self->FinishLocked(GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+                "Deadline exceeded while warming up channel"));
+          }
+          GRPC_ERROR_UNREF(error);
+          self->Unref();
+        },
+        DEBUG_LOCATION);
+  }
+
+  void FinishLocked(grpc_error* error) {
+    done_ = true;
+    grpc_timer_cancel(&timer_);
+    chand_->warm_up_requests_.erase(this);
+    ExecCtx::Run(DEBUG_LOCATION, on_complete_, error);
+    Unref();
+  }
+
+  ChannelData* chand_;
+  grpc_polling_entity pollent_;
+  const bool send_ping_;
+  const grpc_millis deadline_;
+  grpc_closure* on_complete_;
+  grpc_timer timer_;
+  grpc_closure on_timeout_;
+  int pending_pings_ = 0;
+  grpc_error* ping_error_ = GRPC_ERROR_NONE;
+  bool done_ = false;
+};
+
 //
 // ChannelData::ClientChannelControlHelper
 //
@@ -1538,6 +1695,17 @@ void ChannelData::UpdateStateAndPickerLocked(
   // Clear the pending update map after releasing the lock, to keep the
   // critical section small.
   pending_subchannel_updates_.clear();
+  CheckWarmUpRequestsLocked();
+}
+
+void ChannelData::CheckWarmUpRequestsLocked() {
+  // Iterate over a copy, since a request that finishes removes itself from
+  // the set.
+  std::vector<WarmUpRequest*> warm_up_requests(warm_up_requests_.begin(),
+                                               warm_up_requests_.end());
+  for (WarmUpRequest* request : warm_up_requests) {
+    request->CheckProgressLocked();
+  }
 }
 
 void ChannelData::UpdateServiceConfigLocked(
@@ -1903,10 +2071,16 @@ ChannelData::GetConnectedSubchannelInDataPlane(
     SubchannelInterface* subchannel) const {
   SubchannelWrapper* subchannel_wrapper =
       static_cast<SubchannelWrapper*>(subchannel);
-  ConnectedSubchannel* connected_subchannel =
-      subchannel_wrapper->connected_subchannel_in_data_plane();
-  if (connected_subchannel == nullptr) return nullptr;
-  return connected_subchannel->Ref();
+  return subchannel_wrapper->PickConnectedSubchannelInDataPlane();
+}
+
+void ChannelData::WarmUp(grpc_polling_entity pollent, bool send_ping,
+                         grpc_millis deadline, grpc_closure* on_complete) {
+  // Owned by warm_up_requests_ until it finishes.
+  auto* request =
+      new WarmUpRequest(this, pollent, send_ping, deadline, on_complete);
+  work_serializer_->Run([request]() { request->StartLocked(); },
+                        DEBUG_LOCATION);
 }
 
 void ChannelData::TryToConnectLocked() {
@@ -4033,6 +4207,14 @@ void grpc_client_channel_watch_connectivity_state(
                                                watcher_timer_init);
 }
 
+void grpc_client_channel_warm_up(grpc_channel_element* elem,
+                                 grpc_polling_entity pollent, bool send_ping,
+                                 grpc_millis deadline,
+                                 grpc_closure* on_complete) {
+  auto* chand = static_cast<ChannelData*>(elem->channel_data);
+  chand->WarmUp(pollent, send_ping, deadline, on_complete);
+}
+
 void grpc_client_channel_start_connectivity_watch(
     grpc_channel_element* elem, grpc_connectivity_state initial_state,
     grpc_core::OrphanablePtr<grpc_core::AsyncConnectivityStateWatcherInterface>
@@ -60,6 +60,20 @@ void grpc_client_channel_watch_connectivity_state(
     grpc_connectivity_state* state, grpc_closure* on_complete,
     grpc_closure* watcher_timer_init);
 
+// Brings the channel up ahead of its first call.  Leaves IDLE if needed,
+// then waits until the channel is READY and every subchannel the LB policy
+// is connecting has either connected or failed.  If send_ping is true, then
+// also pings each connected subchannel and waits for the acks.  Schedules
+// on_complete with GRPC_ERROR_NONE when done, or with an error if the
+// channel shuts down or deadline passes first.  I/O will be serviced via
+// pollent.
+//
+// This is intended to be used via grpc_channel_warm_up().
+void grpc_client_channel_warm_up(grpc_channel_element* elem,
+                                 grpc_polling_entity pollent, bool send_ping,
+                                 grpc_millis deadline,
+                                 grpc_closure* on_complete);
+
 // Starts and stops a connectivity watch.  The watcher will be initially
 // notified as soon as the state changes from initial_state and then on
 // every subsequent state change until either the watch is stopped or
@@ -25,13 +25,17 @@
 namespace grpc_core {
 
 GlobalSubchannelPool::GlobalSubchannelPool() {
-  subchannel_map_ = grpc_avl_create(&subchannel_avl_vtable_);
-  gpr_mu_init(&mu_);
+  for (Shard& shard : shards_) {
+    shard.subchannel_map = grpc_avl_create(&subchannel_avl_vtable_);
+    gpr_mu_init(&shard.mu);
+  }
 }
 
 GlobalSubchannelPool::~GlobalSubchannelPool() {
-  gpr_mu_destroy(&mu_);
-  grpc_avl_unref(subchannel_map_, nullptr);
+  for (Shard& shard : shards_) {
+    gpr_mu_destroy(&shard.mu);
+    grpc_avl_unref(shard.subchannel_map, nullptr);
+  }
 }
 
 void GlobalSubchannelPool::Init() {
@@ -56,13 +60,14 @@ RefCountedPtr<GlobalSubchannelPool> GlobalSubchannelPool::instance() {
 
 Subchannel* GlobalSubchannelPool::RegisterSubchannel(SubchannelKey* key,
                                                      Subchannel* constructed) {
+  Shard* shard = ShardForKey(*key);
   Subchannel* c = nullptr;
   // Compare and swap (CAS) loop:
   while (c == nullptr) {
     // Ref the shared map to have a local copy.
-    gpr_mu_lock(&mu_);
-    grpc_avl old_map = grpc_avl_ref(subchannel_map_, nullptr);
-    gpr_mu_unlock(&mu_);
+    gpr_mu_lock(&shard->mu);
+    grpc_avl old_map = grpc_avl_ref(shard->subchannel_map, nullptr);
+    gpr_mu_unlock(&shard->mu);
     // Check to see if a subchannel already exists.
     c = static_cast<Subchannel*>(grpc_avl_get(old_map, key, nullptr));
     if (c != nullptr) {
@@ -84,12 +89,12 @@ Subchannel* GlobalSubchannelPool::RegisterSubchannel(SubchannelKey* key,
       // Try to publish the change to the shared map. It may happen (but
       // unlikely) that some other thread has changed the shared map, so compare
       // to make sure it's unchanged before swapping. Retry if it's changed.
-      gpr_mu_lock(&mu_);
-      if (old_map.root == subchannel_map_.root) {
-        GPR_SWAP(grpc_avl, new_map, subchannel_map_);
+      gpr_mu_lock(&shard->mu);
+      if (old_map.root == shard->subchannel_map.root) {
+        GPR_SWAP(grpc_avl, new_map, shard->subchannel_map);
         c = constructed;
       }
-      gpr_mu_unlock(&mu_);
+      gpr_mu_unlock(&shard->mu);
       grpc_avl_unref(new_map, nullptr);
     }
     grpc_avl_unref(old_map, nullptr);
@@ -98,13 +103,14 @@ Subchannel* GlobalSubchannelPool::RegisterSubchannel(SubchannelKey* key,
 }
 
 void GlobalSubchannelPool::UnregisterSubchannel(SubchannelKey* key) {
+  Shard* shard = ShardForKey(*key);
   bool done = false;
   // Compare and swap (CAS) loop:
   while (!done) {
     // Ref the shared map to have a local copy.
-    gpr_mu_lock(&mu_);
-    grpc_avl old_map = grpc_avl_ref(subchannel_map_, nullptr);
-    gpr_mu_unlock(&mu_);
+    gpr_mu_lock(&shard->mu);
+    grpc_avl old_map = grpc_avl_ref(shard->subchannel_map, nullptr);
+    gpr_mu_unlock(&shard->mu);
     // Remove the subchannel.
     // Note that we should ref the old map first because grpc_avl_remove() will
     // unref it while we still need to access it later.
@@ -113,12 +119,12 @@ void GlobalSubchannelPool::UnregisterSubchannel(SubchannelKey* key) {
     // Try to publish the change to the shared map. It may happen (but
     // unlikely) that some other thread has changed the shared map, so compare
     // to make sure it's unchanged before swapping. Retry if it's changed.
-    gpr_mu_lock(&mu_);
-    if (old_map.root == subchannel_map_.root) {
-      GPR_SWAP(grpc_avl, new_map, subchannel_map_);
+    gpr_mu_lock(&shard->mu);
+    if (old_map.root == shard->subchannel_map.root) {
+      GPR_SWAP(grpc_avl, new_map, shard->subchannel_map);
       done = true;
     }
-    gpr_mu_unlock(&mu_);
+    gpr_mu_unlock(&shard->mu);
     grpc_avl_unref(new_map, nullptr);
     grpc_avl_unref(old_map, nullptr);
   }
@@ -127,9 +133,10 @@ void GlobalSubchannelPool::UnregisterSubchannel(SubchannelKey* key) {
 Subchannel* GlobalSubchannelPool::FindSubchannel(SubchannelKey* key) {
   // Lock, and take a reference to the subchannel map.
   // We don't need to do the search under a lock as AVL's are immutable.
-  gpr_mu_lock(&mu_);
-  grpc_avl index = grpc_avl_ref(subchannel_map_, nullptr);
-  gpr_mu_unlock(&mu_);
+  Shard* shard = ShardForKey(*key);
+  gpr_mu_lock(&shard->mu);
+  grpc_avl index = grpc_avl_ref(shard->subchannel_map, nullptr);
+  gpr_mu_unlock(&shard->mu);
   Subchannel* c = static_cast<Subchannel*>(grpc_avl_get(index, key, nullptr));
   if (c != nullptr) c = GRPC_SUBCHANNEL_REF_FROM_WEAK_REF(c, "found_from_pool");
   grpc_avl_unref(index, nullptr);
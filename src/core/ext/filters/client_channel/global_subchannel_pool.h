@@ -55,12 +55,25 @@ class GlobalSubchannelPool final : public SubchannelPoolInterface {
   // non-local static object can be trivially destructible.)
   static RefCountedPtr<GlobalSubchannelPool>* instance_;
 
+  // Subchannels are spread by key hash over independently locked maps, so
+  // that channels created concurrently for different targets neither wait on
+  // one lock nor keep invalidating each other's compare-and-swap.
+  static constexpr size_t kNumShards = 16;
+
+  struct Shard {
+    // A map from subchannel key to subchannel.
+    grpc_avl subchannel_map;
+    // To protect subchannel_map.
+    gpr_mu mu;
+  };
+
+  Shard* ShardForKey(const SubchannelKey& key) {
+    return &shards_[key.Hash() % kNumShards];
+  }
+
   // The vtable for subchannel operations in an AVL tree.
   static const grpc_avl_vtable subchannel_avl_vtable_;
-  // A map from subchannel key to subchannel.
-  grpc_avl subchannel_map_;
-  // To protect subchannel_map_.
-  gpr_mu mu_;
+  Shard shards_[kNumShards];
 };
 
 }  // namespace grpc_core
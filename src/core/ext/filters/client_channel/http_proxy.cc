@@ -120,7 +120,7 @@ class HttpProxyMapper : public ProxyMapperInterface {
               server_uri);
       goto no_use_proxy;
     }
-    if (strcmp(uri->scheme, "unix") == 0) {
+    if (strcmp(uri->scheme, "unix") == 0 || strcmp(uri->scheme, "shm") == 0) {
       gpr_log(GPR_INFO, "not using proxy for Unix domain socket '%s'",
               server_uri);
       goto no_use_proxy;
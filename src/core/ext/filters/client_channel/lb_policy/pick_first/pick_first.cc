@@ -18,6 +18,7 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <limits.h>
 #include <string.h>
 
 #include <grpc/support/alloc.h>
@@ -29,6 +30,7 @@
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/iomgr/sockaddr_utils.h"
+#include "src/core/lib/iomgr/timer.h"
 #include "src/core/lib/transport/connectivity_state.h"
 
 namespace grpc_core {
@@ -43,6 +45,8 @@ namespace {
 
 constexpr char kPickFirst[] = "pick_first";
 
+#define GRPC_PICK_FIRST_DEFAULT_CONNECTION_ATTEMPT_DELAY_MS 0
+
 class PickFirst : public LoadBalancingPolicy {
  public:
   explicit PickFirst(Args args);
@@ -91,6 +95,12 @@ class PickFirst : public LoadBalancingPolicy {
       // any references to subchannels, since the subchannels'
       // pollset_sets will include the LB policy's pollset_set.
       policy->Ref(DEBUG_LOCATION, "subchannel_list").release();
+      const grpc_arg* arg = grpc_channel_args_find(
+          &args, GRPC_ARG_HAPPY_EYEBALLS_CONNECTION_ATTEMPT_DELAY_MS);
+      connection_attempt_delay_ms_ = grpc_channel_arg_get_integer(
+          arg,
+          {GRPC_PICK_FIRST_DEFAULT_CONNECTION_ATTEMPT_DELAY_MS, 0, INT_MAX});
+      GRPC_CLOSURE_INIT(&on_attempt_timer_, &OnAttemptTimer, this, nullptr);
     }
 
     ~PickFirstSubchannelList() {
@@ -98,13 +108,49 @@ class PickFirst : public LoadBalancingPolicy {
       p->Unref(DEBUG_LOCATION, "subchannel_list");
     }
 
+    void Orphan() override {
+      CancelAttemptTimerLocked();
+      SubchannelList::Orphan();
+    }
+
     bool in_transient_failure() const { return in_transient_failure_; }
     void set_in_transient_failure(bool in_transient_failure) {
       in_transient_failure_ = in_transient_failure;
     }
 
+    // Starts a pass over the list, beginning with the first subchannel.
+    // Each following subchannel is started when the previous attempt
+    // fails or when the connection attempt delay expires, whichever comes
+    // first, so that a blackholed address does not hold up the others.
+    void StartConnectionAttemptsLocked();
+    // Starts connecting to the next subchannel of the current pass, if
+    // there is one left.
+    void StartNextConnectionAttemptLocked();
+    // Records a failed attempt.  Returns true if every subchannel in the
+    // current pass has now failed.
+    bool ConnectionAttemptFailedLocked() {
+      return ++num_failed_attempts_ == num_subchannels();
+    }
+    void CancelAttemptTimerLocked() {
+      if (attempt_timer_pending_) grpc_timer_cancel(&attempt_timer_);
+    }
+
    private:
+    static void OnAttemptTimer(void* arg, grpc_error* error);
+    void OnAttemptTimerLocked(grpc_error* error);
+
     bool in_transient_failure_ = false;
+    // Connection attempt delay.  0 means one attempt at a time.
+    int connection_attempt_delay_ms_;
+    // Index of the next subchannel to start in the current pass.
+    size_t next_attempt_index_ = 0;
+    // Number of subchannels that have failed in the current pass.
+    size_t num_failed_attempts_ = 0;
+    // When the next subchannel should be started if nothing fails first.
+    grpc_millis next_attempt_time_ = 0;
+    bool attempt_timer_pending_ = false;
+    grpc_timer attempt_timer_;
+    grpc_closure on_attempt_timer_;
   };
 
   class Picker : public SubchannelPicker {
@@ -227,13 +273,9 @@ void PickFirst::AttemptToConnectUsingLatestUpdateArgsLocked() {
     // We don't yet have a selected subchannel, so replace the current
     // subchannel list immediately.
     subchannel_list_ = std::move(subchannel_list);
-    // If we're not in IDLE state, start trying to connect to the first
-    // subchannel in the new list.
-    // Note: No need to use CheckConnectivityStateAndStartWatchingLocked()
-    // here, since we've already checked the initial connectivity
-    // state of all subchannels above.
-    subchannel_list_->subchannel(0)->StartConnectivityWatchLocked();
-    subchannel_list_->subchannel(0)->subchannel()->AttemptToConnect();
+    // If we're not in IDLE state, start trying to connect to the
+    // subchannels in the new list.
+    subchannel_list_->StartConnectionAttemptsLocked();
   } else {
     // We do have a selected subchannel (which means it's READY), so keep
     // using it until one of the subchannels in the new list reports READY.
@@ -247,16 +289,9 @@ void PickFirst::AttemptToConnectUsingLatestUpdateArgsLocked() {
       }
     }
     latest_pending_subchannel_list_ = std::move(subchannel_list);
-    // If we're not in IDLE state, start trying to connect to the first
-    // subchannel in the new list.
-    // Note: No need to use CheckConnectivityStateAndStartWatchingLocked()
-    // here, since we've already checked the initial connectivity
-    // state of all subchannels above.
-    latest_pending_subchannel_list_->subchannel(0)
-        ->StartConnectivityWatchLocked();
-    latest_pending_subchannel_list_->subchannel(0)
-        ->subchannel()
-        ->AttemptToConnect();
+    // If we're not in IDLE state, start trying to connect to the
+    // subchannels in the new list.
+    latest_pending_subchannel_list_->StartConnectionAttemptsLocked();
   }
 }
 
@@ -374,31 +409,32 @@ void PickFirst::PickFirstSubchannelData::ProcessConnectivityChangeLocked(
     }
     case GRPC_CHANNEL_TRANSIENT_FAILURE: {
       CancelConnectivityWatchLocked("connection attempt failed");
-      PickFirstSubchannelData* sd = this;
-      size_t next_index =
-          (sd->Index() + 1) % subchannel_list()->num_subchannels();
-      sd = subchannel_list()->subchannel(next_index);
-      // If we're tried all subchannels, set state to TRANSIENT_FAILURE.
-      if (sd->Index() == 0) {
-        // Re-resolve if this is the most recent subchannel list.
-        if (subchannel_list() == (p->latest_pending_subchannel_list_ != nullptr
-                                      ? p->latest_pending_subchannel_list_.get()
-                                      : p->subchannel_list_.get())) {
-          p->channel_control_helper()->RequestReresolution();
-        }
-        subchannel_list()->set_in_transient_failure(true);
-        // Only report new state in case 1.
-        if (subchannel_list() == p->subchannel_list_.get()) {
-          grpc_error* error = grpc_error_set_int(
-              GRPC_ERROR_CREATE_FROM_STATIC_STRING(
-                  "failed to connect to all addresses"),
-              GRPC_ERROR_INT_GRPC_STATUS, GRPC_STATUS_UNAVAILABLE);
-          p->channel_control_helper()->UpdateState(
-              GRPC_CHANNEL_TRANSIENT_FAILURE,
-              absl::make_unique<TransientFailurePicker>(error));
-        }
+      // If other attempts are still pending, move on to the next
+      // subchannel without waiting for the connection attempt delay.
+      if (!subchannel_list()->ConnectionAttemptFailedLocked()) {
+        subchannel_list()->StartNextConnectionAttemptLocked();
+        break;
+      }
+      // We've tried all subchannels, so set state to TRANSIENT_FAILURE.
+      // Re-resolve if this is the most recent subchannel list.
+      if (subchannel_list() == (p->latest_pending_subchannel_list_ != nullptr
+                                    ? p->latest_pending_subchannel_list_.get()
+                                    : p->subchannel_list_.get())) {
+        p->channel_control_helper()->RequestReresolution();
+      }
+      subchannel_list()->set_in_transient_failure(true);
+      // Only report new state in case 1.
+      if (subchannel_list() == p->subchannel_list_.get()) {
+        grpc_error* error = grpc_error_set_int(
+            GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+                "failed to connect to all addresses"),
+            GRPC_ERROR_INT_GRPC_STATUS, GRPC_STATUS_UNAVAILABLE);
+        p->channel_control_helper()->UpdateState(
+            GRPC_CHANNEL_TRANSIENT_FAILURE,
+            absl::make_unique<TransientFailurePicker>(error));
       }
-      sd->CheckConnectivityStateAndStartWatchingLocked();
+      // Start over from the first subchannel.
+      subchannel_list()->StartConnectionAttemptsLocked();
       break;
     }
     case GRPC_CHANNEL_CONNECTING:
@@ -447,6 +483,8 @@ void PickFirst::PickFirstSubchannelData::ProcessUnselectedReadyLocked() {
   p->selected_ = this;
   p->channel_control_helper()->UpdateState(
       GRPC_CHANNEL_READY, absl::make_unique<Picker>(subchannel()->Ref()));
+  // Abandon the attempts that lost the race.
+  subchannel_list()->CancelAttemptTimerLocked();
   for (size_t i = 0; i < subchannel_list()->num_subchannels(); ++i) {
     if (i != Index()) {
       subchannel_list()->subchannel(i)->ShutdownLocked();
@@ -472,6 +510,71 @@ void PickFirst::PickFirstSubchannelData::
   }
 }
 
+//
+// PickFirst::PickFirstSubchannelList
+//
+
+void PickFirst::PickFirstSubchannelList::StartConnectionAttemptsLocked() {
+  next_attempt_index_ = 0;
+  num_failed_attempts_ = 0;
+  StartNextConnectionAttemptLocked();
+}
+
+void PickFirst::PickFirstSubchannelList::StartNextConnectionAttemptLocked() {
+  if (next_attempt_index_ == num_subchannels()) return;
+  PickFirstSubchannelData* sd = subchannel(next_attempt_index_++);
+  // Arm the timer before starting the attempt, since the attempt may
+  // select the subchannel right away, which cancels the timer.
+  if (connection_attempt_delay_ms_ > 0 &&
+      next_attempt_index_ < num_subchannels()) {
+    next_attempt_time_ = ExecCtx::Get()->Now() + connection_attempt_delay_ms_;
+    // If the timer is already pending for an earlier deadline, it will
+    // re-arm itself for the new one when it fires.
+    if (!attempt_timer_pending_) {
+      attempt_timer_pending_ = true;
+      Ref(DEBUG_LOCATION, "attempt_timer").release();
+      grpc_timer_init(&attempt_timer_, next_attempt_time_, &on_attempt_timer_);
+    }
+  }
+  sd->CheckConnectivityStateAndStartWatchingLocked();
+}
+
+void PickFirst::PickFirstSubchannelList::OnAttemptTimer(void* arg,
+                                                        grpc_error* error) {
+  PickFirstSubchannelList* self = static_cast<PickFirstSubchannelList*>(arg);
+  PickFirst* p = static_cast<PickFirst*>(self->policy());
+  GRPC_ERROR_REF(error);  // ref owned by lambda
+  p->work_serializer()->Run(
+      [self, error]() { self->OnAttemptTimerLocked(error); }, DEBUG_LOCATION);
+}
+
+void PickFirst::PickFirstSubchannelList::OnAttemptTimerLocked(
+    grpc_error* error) {
+  PickFirst* p = static_cast<PickFirst*>(policy());
+  attempt_timer_pending_ = false;
+  // The timer may have fired just before one of our subchannels was
+  // selected, in which case there is nothing left to start.
+  if (error == GRPC_ERROR_NONE && !shutting_down() &&
+      (p->selected_ == nullptr || p->selected_->subchannel_list() != this)) {
+    if (ExecCtx::Get()->Now() < next_attempt_time_) {
+      // An attempt was started early because an earlier one failed.
+      attempt_timer_pending_ = true;
+      grpc_timer_init(&attempt_timer_, next_attempt_time_, &on_attempt_timer_);
+      GRPC_ERROR_UNREF(error);
+      return;
+    }
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_pick_first_trace)) {
+      gpr_log(GPR_INFO,
+              "Pick First %p subchannel list %p: connection attempt delay "
+              "expired, starting attempt %" PRIuPTR " of %" PRIuPTR,
+              p, this, next_attempt_index_ + 1, num_subchannels());
+    }
+    StartNextConnectionAttemptLocked();
+  }
+  Unref(DEBUG_LOCATION, "attempt_timer");
+  GRPC_ERROR_UNREF(error);
+}
+
 class PickFirstConfig : public LoadBalancingPolicy::Config {
  public:
   const char* name() const override { return kPickFirst; }
@@ -112,9 +112,11 @@ class RoundRobin : public LoadBalancingPolicy {
    public:
     RoundRobinSubchannelList(RoundRobin* policy, TraceFlag* tracer,
                              const ServerAddressList& addresses,
-                             const grpc_channel_args& args)
+                             const grpc_channel_args& args,
+                             RoundRobinSubchannelList* previous)
         : SubchannelList(policy, tracer, addresses,
-                         policy->channel_control_helper(), args) {
+                         policy->channel_control_helper(), args, previous),
+          args_(grpc_channel_args_copy(&args)) {
       // Need to maintain a ref to the LB policy as long as we maintain
       // any references to subchannels, since the subchannels'
       // pollset_sets will include the LB policy's pollset_set.
@@ -122,10 +124,19 @@ class RoundRobin : public LoadBalancingPolicy {
     }
 
     ~RoundRobinSubchannelList() {
+      grpc_channel_args_destroy(args_);
       RoundRobin* p = static_cast<RoundRobin*>(policy());
       p->Unref(DEBUG_LOCATION, "subchannel_list");
     }
 
+    // The channel args the list was created with.
+    const grpc_channel_args* args() const { return args_; }
+
+    // Returns true if this list was created from exactly the given
+    // addresses and args.
+    bool MatchesUpdate(const ServerAddressList& addresses,
+                       const grpc_channel_args& args);
+
     // Starts watching the subchannels in this list.
     void StartWatchingLocked();
 
@@ -144,6 +155,7 @@ class RoundRobin : public LoadBalancingPolicy {
     void UpdateRoundRobinStateFromSubchannelStateCountsLocked();
 
    private:
+    grpc_channel_args* args_;
     size_t num_ready_ = 0;
     size_t num_connecting_ = 0;
     size_t num_transient_failure_ = 0;
@@ -252,6 +264,16 @@ void RoundRobin::ResetBackoffLocked() {
   }
 }
 
+bool RoundRobin::RoundRobinSubchannelList::MatchesUpdate(
+    const ServerAddressList& addresses, const grpc_channel_args& args) {
+  if (num_subchannels() != addresses.size()) return false;
+  if (grpc_channel_args_compare(args_, &args) != 0) return false;
+  for (size_t i = 0; i < addresses.size(); ++i) {
+    if (!(subchannel(i)->address() == addresses[i])) return false;
+  }
+  return true;
+}
+
 void RoundRobin::RoundRobinSubchannelList::StartWatchingLocked() {
   if (num_subchannels() == 0) return;
   // Check current state of each subchannel synchronously, since any
@@ -435,6 +457,31 @@ void RoundRobin::UpdateLocked(UpdateArgs args) {
     gpr_log(GPR_INFO, "[RR %p] received update with %" PRIuPTR " addresses",
             this, args.addresses.size());
   }
+  // The most recent list, which is the one the update would replace.
+  RoundRobinSubchannelList* latest_subchannel_list =
+      latest_pending_subchannel_list_ != nullptr
+          ? latest_pending_subchannel_list_.get()
+          : subchannel_list_.get();
+  if (latest_subchannel_list != nullptr) {
+    // If nothing changed, keep the existing list, so that its subchannels'
+    // connectivity state and the picker built from it stay as they are.
+    // This is common when a parent policy such as weighted_target passes
+    // down an update in which only some of its children changed.
+    if (latest_subchannel_list->MatchesUpdate(args.addresses, *args.args)) {
+      if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_round_robin_trace)) {
+        gpr_log(GPR_INFO,
+                "[RR %p] update matches subchannel list %p; ignoring", this,
+                latest_subchannel_list);
+      }
+      return;
+    }
+    // Otherwise, carry the subchannels for unchanged addresses over to the
+    // new list, so that only added addresses need new subchannels.
+    if (grpc_channel_args_compare(latest_subchannel_list->args(),
+                                  args.args) != 0) {
+      latest_subchannel_list = nullptr;
+    }
+  }
   // Replace latest_pending_subchannel_list_.
   if (latest_pending_subchannel_list_ != nullptr) {
     if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_round_robin_trace)) {
@@ -444,7 +491,8 @@ void RoundRobin::UpdateLocked(UpdateArgs args) {
     }
   }
   latest_pending_subchannel_list_ = MakeOrphanable<RoundRobinSubchannelList>(
-      this, &grpc_lb_round_robin_trace, args.addresses, *args.args);
+      this, &grpc_lb_round_robin_trace, args.addresses, *args.args,
+      latest_subchannel_list);
   if (latest_pending_subchannel_list_->num_subchannels() == 0) {
     // If the new list is empty, immediately promote the new list to the
     // current list and transition to TRANSIENT_FAILURE.
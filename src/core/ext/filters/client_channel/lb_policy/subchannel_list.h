@@ -23,6 +23,9 @@
 
 #include <string.h>
 
+#include <map>
+#include <string>
+
 #include <grpc/support/alloc.h>
 
 #include "absl/container/inlined_vector.h"
@@ -91,6 +94,9 @@ class SubchannelData {
   // Returns a pointer to the subchannel.
   SubchannelInterface* subchannel() const { return subchannel_.get(); }
 
+  // Returns the address this subchannel was created for.
+  const ServerAddress& address() const { return address_; }
+
   // Synchronously checks the subchannel's connectivity state.
   // Must not be called while there is a connectivity notification
   // pending (i.e., between calling StartConnectivityWatchLocked() and
@@ -160,6 +166,8 @@ class SubchannelData {
 
   // Backpointer to owning subchannel list.  Not owned.
   SubchannelList<SubchannelListType, SubchannelDataType>* subchannel_list_;
+  // The address the subchannel was created for.
+  ServerAddress address_;
   // The subchannel.
   RefCountedPtr<SubchannelInterface> subchannel_;
   // Will be non-null when the subchannel's state is being watched.
@@ -199,10 +207,15 @@ class SubchannelList : public InternallyRefCounted<SubchannelListType> {
   }
 
  protected:
+  // If previous is non-null, the subchannels it holds for addresses that
+  // are also in addresses are reused instead of being created again via
+  // helper.  The caller must make sure that previous was created with the
+  // same args.
   SubchannelList(LoadBalancingPolicy* policy, TraceFlag* tracer,
                  const ServerAddressList& addresses,
                  LoadBalancingPolicy::ChannelControlHelper* helper,
-                 const grpc_channel_args& args);
+                 const grpc_channel_args& args,
+                 SubchannelList* previous = nullptr);
 
   virtual ~SubchannelList();
 
@@ -264,9 +277,10 @@ void SubchannelData<SubchannelListType, SubchannelDataType>::Watcher::
 template <typename SubchannelListType, typename SubchannelDataType>
 SubchannelData<SubchannelListType, SubchannelDataType>::SubchannelData(
     SubchannelList<SubchannelListType, SubchannelDataType>* subchannel_list,
-    const ServerAddress& /*address*/,
+    const ServerAddress& address,
     RefCountedPtr<SubchannelInterface> subchannel)
     : subchannel_list_(subchannel_list),
+      address_(address),
       subchannel_(std::move(subchannel)),
       // We assume that the current state is IDLE.  If not, we'll get a
       // callback telling us that.
@@ -353,7 +367,7 @@ SubchannelList<SubchannelListType, SubchannelDataType>::SubchannelList(
     LoadBalancingPolicy* policy, TraceFlag* tracer,
     const ServerAddressList& addresses,
     LoadBalancingPolicy::ChannelControlHelper* helper,
-    const grpc_channel_args& args)
+    const grpc_channel_args& args, SubchannelList* previous)
     : InternallyRefCounted<SubchannelListType>(tracer),
       policy_(policy),
       tracer_(tracer) {
@@ -363,6 +377,19 @@ SubchannelList<SubchannelListType, SubchannelDataType>::SubchannelList(
             tracer_->name(), policy, this, addresses.size());
   }
   subchannels_.reserve(addresses.size());
+  // Index the subchannels of the previous list by address, so that the
+  // ones for unchanged addresses can be carried over.
+  std::map<std::string, SubchannelDataType*> previous_subchannels;
+  if (previous != nullptr) {
+    for (size_t i = 0; i < previous->num_subchannels(); ++i) {
+      SubchannelDataType* sd = previous->subchannel(i);
+      if (sd->subchannel() == nullptr) continue;
+      const grpc_resolved_address& addr = sd->address().address();
+      previous_subchannels.emplace(
+          std::string(reinterpret_cast<const char*>(addr.addr), addr.len),
+          sd);
+    }
+  }
   // We need to remove the LB addresses in order to be able to compare the
   // subchannel keys of subchannels from a different batch of addresses.
   // We remove the service config, since it will be passed into the
@@ -371,6 +398,24 @@ SubchannelList<SubchannelListType, SubchannelDataType>::SubchannelList(
                                          GRPC_ARG_SERVICE_CONFIG};
   // Create a subchannel for each address.
   for (size_t i = 0; i < addresses.size(); i++) {
+    if (!previous_subchannels.empty()) {
+      const grpc_resolved_address& addr = addresses[i].address();
+      auto it = previous_subchannels.find(
+          std::string(reinterpret_cast<const char*>(addr.addr), addr.len));
+      if (it != previous_subchannels.end() &&
+          it->second->address() == addresses[i]) {
+        if (GRPC_TRACE_FLAG_ENABLED(*tracer_)) {
+          gpr_log(GPR_INFO,
+                  "[%s %p] subchannel list %p index %" PRIuPTR
+                  ": Reusing subchannel %p from subchannel list %p",
+                  tracer_->name(), policy_, this, subchannels_.size(),
+                  it->second->subchannel(), previous);
+        }
+        subchannels_.emplace_back(this, addresses[i],
+                                  it->second->subchannel()->Ref());
+        continue;
+      }
+    }
     absl::InlinedVector<grpc_arg, 3> args_to_add;
     const size_t subchannel_address_arg_index = args_to_add.size();
     args_to_add.emplace_back(
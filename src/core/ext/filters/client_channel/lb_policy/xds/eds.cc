@@ -151,7 +151,8 @@ class EdsLb : public LoadBalancingPolicy {
 
   void MaybeDestroyChildPolicyLocked();
 
-  void UpdatePriorityList(XdsApi::PriorityListUpdate priority_list_update);
+  void UpdatePriorityList(
+      std::shared_ptr<const XdsApi::PriorityListUpdate> priority_list_update);
   void UpdateChildPolicyLocked();
   OrphanablePtr<LoadBalancingPolicy> CreateChildPolicyLocked(
       const grpc_channel_args* args);
@@ -202,8 +203,9 @@ class EdsLb : public LoadBalancingPolicy {
   // A pointer to the endpoint watcher, to be used when cancelling the watch.
   // Note that this is not owned, so this pointer must never be derefernced.
   EndpointWatcher* endpoint_watcher_ = nullptr;
-  // The latest data from the endpoint watcher.
-  XdsApi::PriorityListUpdate priority_list_update_;
+  // The latest data from the endpoint watcher.  Points into an EdsUpdate
+  // that may be shared with other channels, so it must not be modified.
+  std::shared_ptr<const XdsApi::PriorityListUpdate> priority_list_update_;
   // State used to retain child policy names for priority policy.
   std::vector<size_t /*child_number*/> priority_child_numbers_;
 
@@ -298,7 +300,8 @@ class EdsLb::EndpointWatcher : public XdsClient::EndpointWatcherInterface {
 
   ~EndpointWatcher() { eds_policy_.reset(DEBUG_LOCATION, "EndpointWatcher"); }
 
-  void OnEndpointChanged(XdsApi::EdsUpdate update) override {
+  void OnEndpointChanged(
+      std::shared_ptr<const XdsApi::EdsUpdate> update) override {
     if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_eds_trace)) {
       gpr_log(GPR_INFO, "[edslb %p] Received EDS update from xds client",
               eds_policy_.get());
@@ -306,12 +309,12 @@ class EdsLb::EndpointWatcher : public XdsClient::EndpointWatcherInterface {
     // Update the drop config.
     const bool drop_config_changed =
         eds_policy_->drop_config_ == nullptr ||
-        *eds_policy_->drop_config_ != *update.drop_config;
+        *eds_policy_->drop_config_ != *update->drop_config;
     if (drop_config_changed) {
       if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_eds_trace)) {
         gpr_log(GPR_INFO, "[edslb %p] Updating drop config", eds_policy_.get());
       }
-      eds_policy_->drop_config_ = std::move(update.drop_config);
+      eds_policy_->drop_config_ = update->drop_config;
       eds_policy_->MaybeUpdateDropPickerLocked();
     } else if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_eds_trace)) {
       gpr_log(GPR_INFO, "[edslb %p] Drop config unchanged, ignoring",
@@ -319,12 +322,14 @@ class EdsLb::EndpointWatcher : public XdsClient::EndpointWatcherInterface {
     }
     // Update priority and locality info.
     if (eds_policy_->child_policy_ == nullptr ||
-        eds_policy_->priority_list_update_ != update.priority_list_update) {
+        *eds_policy_->priority_list_update_ != update->priority_list_update) {
       if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_eds_trace)) {
         gpr_log(GPR_INFO, "[edslb %p] Updating priority list",
                 eds_policy_.get());
       }
-      eds_policy_->UpdatePriorityList(std::move(update.priority_list_update));
+      eds_policy_->UpdatePriorityList(
+          std::shared_ptr<const XdsApi::PriorityListUpdate>(
+              update, &update->priority_list_update));
     } else if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_eds_trace)) {
       gpr_log(GPR_INFO, "[edslb %p] Priority list unchanged, ignoring",
               eds_policy_.get());
@@ -503,15 +508,16 @@ void EdsLb::ResetBackoffLocked() {
 //
 
 void EdsLb::UpdatePriorityList(
-    XdsApi::PriorityListUpdate priority_list_update) {
+    std::shared_ptr<const XdsApi::PriorityListUpdate> priority_list_update) {
   // Build some maps from locality to child number and the reverse from
   // the old data in priority_list_update_ and priority_child_numbers_.
   std::map<XdsLocalityName*, size_t /*child_number*/, XdsLocalityName::Less>
       locality_child_map;
   std::map<size_t, std::set<XdsLocalityName*>> child_locality_map;
-  for (uint32_t priority = 0; priority < priority_list_update_.size();
-       ++priority) {
-    auto* locality_map = priority_list_update_.Find(priority);
+  const uint32_t old_num_priorities =
+      priority_list_update_ == nullptr ? 0 : priority_list_update_->size();
+  for (uint32_t priority = 0; priority < old_num_priorities; ++priority) {
+    auto* locality_map = priority_list_update_->Find(priority);
     GPR_ASSERT(locality_map != nullptr);
     size_t child_number = priority_child_numbers_[priority];
     for (const auto& p : locality_map->localities) {
@@ -522,9 +528,9 @@ void EdsLb::UpdatePriorityList(
   }
   // Construct new list of children.
   std::vector<size_t> priority_child_numbers;
-  for (uint32_t priority = 0; priority < priority_list_update.size();
+  for (uint32_t priority = 0; priority < priority_list_update->size();
        ++priority) {
-    auto* locality_map = priority_list_update.Find(priority);
+    auto* locality_map = priority_list_update->Find(priority);
     GPR_ASSERT(locality_map != nullptr);
     absl::optional<size_t> child_number;
     // If one of the localities in this priority already existed, reuse its
@@ -572,11 +578,11 @@ void EdsLb::UpdatePriorityList(
 
 ServerAddressList EdsLb::CreateChildPolicyAddressesLocked() {
   ServerAddressList addresses;
-  for (uint32_t priority = 0; priority < priority_list_update_.size();
+  for (uint32_t priority = 0; priority < priority_list_update_->size();
        ++priority) {
     std::string priority_child_name =
         absl::StrCat("child", priority_child_numbers_[priority]);
-    const auto* locality_map = priority_list_update_.Find(priority);
+    const auto* locality_map = priority_list_update_->Find(priority);
     GPR_ASSERT(locality_map != nullptr);
     for (const auto& p : locality_map->localities) {
       const auto& locality_name = p.first;
@@ -599,9 +605,9 @@ RefCountedPtr<LoadBalancingPolicy::Config>
 EdsLb::CreateChildPolicyConfigLocked() {
   Json::Object priority_children;
   Json::Array priority_priorities;
-  for (uint32_t priority = 0; priority < priority_list_update_.size();
+  for (uint32_t priority = 0; priority < priority_list_update_->size();
        ++priority) {
-    const auto* locality_map = priority_list_update_.Find(priority);
+    const auto* locality_map = priority_list_update_->Find(priority);
     GPR_ASSERT(locality_map != nullptr);
     Json::Object weighted_targets;
     for (const auto& p : locality_map->localities) {
@@ -24,6 +24,9 @@
 #include <stdio.h>
 #include <string.h>
 
+#include <map>
+#include <vector>
+
 #include "absl/container/inlined_vector.h"
 
 #include <grpc/support/alloc.h>
@@ -43,6 +46,8 @@
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/gpr/string.h"
 #include "src/core/lib/gprpp/manual_constructor.h"
+#include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/iomgr/gethostname.h"
 #include "src/core/lib/iomgr/iomgr_custom.h"
 #include "src/core/lib/iomgr/resolve_address.h"
@@ -55,12 +60,27 @@
 #define GRPC_DNS_RECONNECT_MAX_BACKOFF_SECONDS 120
 #define GRPC_DNS_RECONNECT_JITTER 0.2
 
+/* Lifetime of cached results whose addresses carried no TTL, e.g. because
+   they came from the hosts file. */
+#define GRPC_DNS_CACHE_DEFAULT_TTL_MS (30 * 1000)
+/* Upper bound on the lifetime of a cached result. */
+#define GRPC_DNS_CACHE_MAX_TTL_MS (5 * 60 * 1000)
+
 namespace grpc_core {
 
 namespace {
 
 const char kDefaultPort[] = "https";
 
+class AresDnsCache;
+
+// A successful lookup, as shared between resolvers by AresDnsCache.
+struct CachedDnsResult {
+  std::unique_ptr<ServerAddressList> addresses;
+  std::unique_ptr<ServerAddressList> balancer_addresses;
+  UniquePtr<char> service_config_json;
+};
+
 class AresDnsResolver : public Resolver {
  public:
   explicit AresDnsResolver(ResolverArgs args);
@@ -79,6 +99,10 @@ class AresDnsResolver : public Resolver {
   void MaybeStartResolvingLocked();
   void StartResolvingLocked();
 
+  // Called by AresDnsCache with either a result or the lookup's error.
+  void OnCacheResolvedLocked(std::shared_ptr<const CachedDnsResult> result,
+                             grpc_error* error);
+
   static void OnNextResolution(void* arg, grpc_error* error);
   static void OnResolved(void* arg, grpc_error* error);
   void OnNextResolutionLocked(grpc_error* error);
@@ -122,8 +146,408 @@ class AresDnsResolver : public Resolver {
   int query_timeout_ms_;
   // whether or not to enable SRV DNS queries
   bool enable_srv_queries_;
+  // whether results come from, and go to, the process-wide AresDnsCache
+  bool enable_cache_;
+  // identifies this resolver's lookups in AresDnsCache
+  std::string cache_key_;
+
+  friend class AresDnsCache;
 };
 
+//
+// AresDnsCache
+//
+
+// Process-wide cache of DNS results, shared by the resolvers that set
+// GRPC_ARG_DNS_ARES_ENABLE_CACHE. Each entry keeps the last successful result
+// for one lookup key until the TTL of its address records runs out, and runs
+// at most one lookup at a time on behalf of all resolvers interested in it.
+// Lookups belong to their entry rather than to a resolver, so they survive
+// the resolver that started them; they are driven by the pollset_sets of the
+// resolvers currently waiting on them. An entry that was served from since
+// its last lookup is refreshed by a prefetch timer shortly before it expires,
+// so that resolvers polling at long intervals still find it fresh; such a
+// lookup has no waiters and is driven by the ares backup poller.
+class AresDnsCache {
+ public:
+  static void Init() {
+    // Never destroyed: a lookup may complete after grpc_shutdown() has
+    // dropped the entries.
+    if (g_cache_ == nullptr) g_cache_ = new AresDnsCache();
+  }
+  static void Shutdown() {
+    if (g_cache_ != nullptr) g_cache_->Clear();
+  }
+  static AresDnsCache* Get() { return g_cache_; }
+
+  // Resolves \a resolver's name. The outcome is passed to
+  // AresDnsResolver::OnCacheResolvedLocked() on the resolver's
+  // work_serializer, right away if the entry is fresh, otherwise once the
+  // entry's lookup completes. Fresh entries that are close to expiry are
+  // refreshed in the background, either by their prefetch timer or by the
+  // first hit after it.
+  void Resolve(AresDnsResolver* resolver);
+
+  // Stops waiting on \a resolver's behalf. The last resolver to stop waiting
+  // cancels the lookup.
+  void CancelResolve(AresDnsResolver* resolver);
+
+ private:
+  struct Waiter {
+    AresDnsResolver* resolver;
+    // false when the resolver only drives a background refresh
+    bool wants_result;
+  };
+
+  class Entry : public RefCounted<Entry> {
+   public:
+    explicit Entry(const AresDnsResolver* resolver);
+    ~Entry();
+
+    // Starts a lookup, which holds a ref to the entry until it completes.
+    void StartLookup();
+    // Cancels the pending lookup, unless someone started waiting on it again.
+    void MaybeCancelLookup();
+    // Arms the prefetch timer for refresh_time, unless it is already armed.
+    // Must be called with AresDnsCache::mu_ held.
+    void MaybeStartPrefetchTimerLocked();
+    // Stops the prefetch timer.
+    void CancelPrefetchTimer();
+
+    // Guarded by AresDnsCache::mu_.
+    std::shared_ptr<const CachedDnsResult> result;
+    grpc_millis expiration = 0;
+    grpc_millis refresh_time = 0;
+    bool lookup_pending = false;
+    // whether the entry was served from since its result was last updated
+    bool used_since_lookup = false;
+    bool prefetch_timer_pending = false;
+    std::vector<Waiter> waiters;
+    grpc_pollset_set* const interested_parties;
+
+   private:
+    void StartLookupLocked();
+    void MaybeCancelLookupLocked();
+    static void OnLookupDone(void* arg, grpc_error* error);
+    void OnLookupDoneLocked(grpc_error* error);
+    static void OnPrefetchTimer(void* arg, grpc_error* error);
+
+    // Immutable.
+    UniquePtr<char> dns_server_;
+    UniquePtr<char> name_to_resolve_;
+    const bool enable_srv_queries_;
+    const bool request_service_config_;
+    const int query_timeout_ms_;
+    std::shared_ptr<WorkSerializer> work_serializer_;
+    // Only accessed from work_serializer_.
+    grpc_closure on_lookup_done_;
+    grpc_ares_request* pending_request_ = nullptr;
+    // Guarded by AresDnsCache::mu_.
+    grpc_timer prefetch_timer_;
+    grpc_closure on_prefetch_timer_;
+    std::unique_ptr<ServerAddressList> addresses_;
+    std::unique_ptr<ServerAddressList> balancer_addresses_;
+    char* service_config_json_ = nullptr;
+  };
+
+  void Clear();
+  // Drops entries that hold neither a live result nor a pending lookup.
+  void RemoveStaleEntriesLocked(grpc_millis now);
+  void AddWaiterLocked(Entry* entry, AresDnsResolver* resolver,
+                       bool wants_result);
+  static void Deliver(AresDnsResolver* resolver,
+                      std::shared_ptr<const CachedDnsResult> result,
+                      grpc_error* error);
+
+  static AresDnsCache* g_cache_;
+
+  Mutex mu_;
+  std::map<std::string, RefCountedPtr<Entry>> entries_;
+};
+
+AresDnsCache* AresDnsCache::g_cache_ = nullptr;
+
+AresDnsCache::Entry::Entry(const AresDnsResolver* resolver)
+    : interested_parties(grpc_pollset_set_create()),
+      dns_server_(gpr_strdup(resolver->dns_server_)),
+      name_to_resolve_(gpr_strdup(resolver->name_to_resolve_)),
+      enable_srv_queries_(resolver->enable_srv_queries_),
+      request_service_config_(resolver->request_service_config_),
+      query_timeout_ms_(resolver->query_timeout_ms_),
+      work_serializer_(std::make_shared<WorkSerializer>()) {
+  GRPC_CLOSURE_INIT(&on_lookup_done_, OnLookupDone, this,
+                    grpc_schedule_on_exec_ctx);
+  GRPC_CLOSURE_INIT(&on_prefetch_timer_, OnPrefetchTimer, this,
+                    grpc_schedule_on_exec_ctx);
+}
+
+AresDnsCache::Entry::~Entry() {
+  GPR_ASSERT(waiters.empty());
+  grpc_pollset_set_destroy(interested_parties);
+}
+
+void AresDnsCache::Entry::StartLookup() {
+  Ref().release();  // ref owned by the lookup
+  work_serializer_->Run([this]() { StartLookupLocked(); }, DEBUG_LOCATION);
+}
+
+void AresDnsCache::Entry::MaybeCancelLookup() {
+  Ref().release();  // ref owned by lambda
+  work_serializer_->Run(
+      [this]() {
+        MaybeCancelLookupLocked();
+        Unref();
+      },
+      DEBUG_LOCATION);
+}
+
+void AresDnsCache::Entry::MaybeStartPrefetchTimerLocked() {
+  if (prefetch_timer_pending) return;
+  prefetch_timer_pending = true;
+  Ref().release();  // ref owned by the timer
+  grpc_timer_init(&prefetch_timer_, refresh_time, &on_prefetch_timer_);
+}
+
+void AresDnsCache::Entry::CancelPrefetchTimer() {
+  MutexLock lock(&g_cache_->mu_);
+  if (prefetch_timer_pending) grpc_timer_cancel(&prefetch_timer_);
+}
+
+void AresDnsCache::Entry::OnPrefetchTimer(void* arg, grpc_error* error) {
+  // Adopt the ref taken when the timer was armed.
+  RefCountedPtr<Entry> entry(static_cast<Entry*>(arg));
+  bool start_lookup = false;
+  {
+    MutexLock lock(&g_cache_->mu_);
+    entry->prefetch_timer_pending = false;
+    // A lookup that is already running re-arms the timer when it completes.
+    if (error != GRPC_ERROR_NONE || entry->lookup_pending) return;
+    const grpc_millis now = ExecCtx::Get()->Now();
+    // Nobody was served from the entry since it was looked up: let it expire.
+    if (entry->result == nullptr || now >= entry->expiration ||
+        !entry->used_since_lookup) {
+      return;
+    }
+    if (now < entry->refresh_time) {
+      // A refresh started by a hit has moved refresh_time.
+      entry->MaybeStartPrefetchTimerLocked();
+    } else {
+      entry->lookup_pending = true;
+      start_lookup = true;
+    }
+  }
+  if (start_lookup) {
+    GRPC_CARES_TRACE_LOG("dns cache entry:%p prefetching %s", entry.get(),
+                         entry->name_to_resolve_.get());
+    entry->StartLookup();
+  }
+}
+
+void AresDnsCache::Entry::StartLookupLocked() {
+  GRPC_CARES_TRACE_LOG("dns cache entry:%p starting lookup of %s", this,
+                       name_to_resolve_.get());
+  pending_request_ = grpc_dns_lookup_ares_with_ttls_locked(
+      dns_server_.get(), name_to_resolve_.get(), kDefaultPort,
+      interested_parties, &on_lookup_done_, &addresses_,
+      enable_srv_queries_ ? &balancer_addresses_ : nullptr,
+      request_service_config_ ? &service_config_json_ : nullptr,
+      query_timeout_ms_, work_serializer_);
+}
+
+void AresDnsCache::Entry::MaybeCancelLookupLocked() {
+  bool cancel;
+  {
+    MutexLock lock(&g_cache_->mu_);
+    // A new waiter may have shown up since the cancellation was queued.
+    cancel = lookup_pending && waiters.empty();
+  }
+  if (cancel && pending_request_ != nullptr) {
+    grpc_cancel_ares_request_locked(pending_request_);
+  }
+}
+
+void AresDnsCache::Entry::OnLookupDone(void* arg, grpc_error* error) {
+  Entry* entry = static_cast<Entry*>(arg);
+  GRPC_ERROR_REF(error);  // ref owned by lambda
+  entry->work_serializer_->Run(
+      [entry, error]() { entry->OnLookupDoneLocked(error); }, DEBUG_LOCATION);
+}
+
+void AresDnsCache::Entry::OnLookupDoneLocked(grpc_error* error) {
+  // Adopt the ref taken when the lookup was started.
+  RefCountedPtr<Entry> self(this);
+  const int ttl_seconds = grpc_ares_request_min_ttl_seconds(pending_request_);
+  gpr_free(pending_request_);
+  pending_request_ = nullptr;
+  std::shared_ptr<CachedDnsResult> new_result;
+  if (addresses_ != nullptr || balancer_addresses_ != nullptr) {
+    new_result = std::make_shared<CachedDnsResult>();
+    new_result->addresses = std::move(addresses_);
+    new_result->balancer_addresses = std::move(balancer_addresses_);
+    new_result->service_config_json.reset(service_config_json_);
+  } else {
+    gpr_free(service_config_json_);
+  }
+  service_config_json_ = nullptr;
+  std::vector<Waiter> waiters_to_notify;
+  std::shared_ptr<const CachedDnsResult> delivered_result;
+  {
+    MutexLock lock(&g_cache_->mu_);
+    const grpc_millis now = ExecCtx::Get()->Now();
+    lookup_pending = false;
+    waiters_to_notify.swap(waiters);
+    for (const Waiter& waiter : waiters_to_notify) {
+      grpc_pollset_set_del_pollset_set(interested_parties,
+                                       waiter.resolver->interested_parties_);
+    }
+    if (new_result != nullptr) {
+      grpc_millis ttl_ms = ttl_seconds < 0
+                               ? GRPC_DNS_CACHE_DEFAULT_TTL_MS
+                               : static_cast<grpc_millis>(ttl_seconds) * 1000;
+      if (ttl_ms > GRPC_DNS_CACHE_MAX_TTL_MS) {
+        ttl_ms = GRPC_DNS_CACHE_MAX_TTL_MS;
+      }
+      result = new_result;
+      expiration = now + ttl_ms;
+      // Refresh during the last tenth of the entry's lifetime.
+      refresh_time = now + ttl_ms - ttl_ms / 10;
+      used_since_lookup = false;
+      MaybeStartPrefetchTimerLocked();
+      delivered_result = std::move(new_result);
+    } else if (result != nullptr && now < expiration) {
+      // A failed refresh leaves the previous result in place until it expires.
+      delivered_result = result;
+    } else {
+      result.reset();
+    }
+  }
+  GRPC_CARES_TRACE_LOG(
+      "dns cache entry:%p lookup of %s done: ttl=%ds waiters=%" PRIuPTR
+      " error=%s",
+      this, name_to_resolve_.get(), ttl_seconds, waiters_to_notify.size(),
+      grpc_error_string(error));
+  for (const Waiter& waiter : waiters_to_notify) {
+    if (waiter.wants_result) {
+      Deliver(waiter.resolver, delivered_result,
+              delivered_result != nullptr ? GRPC_ERROR_NONE
+                                          : GRPC_ERROR_REF(error));
+    }
+    waiter.resolver->Unref(DEBUG_LOCATION, "dns-cache-wait");
+  }
+  GRPC_ERROR_UNREF(error);
+}
+
+void AresDnsCache::Clear() {
+  std::map<std::string, RefCountedPtr<Entry>> entries;
+  {
+    MutexLock lock(&mu_);
+    entries.swap(entries_);
+  }
+  for (auto& p : entries) p.second->CancelPrefetchTimer();
+}
+
+void AresDnsCache::RemoveStaleEntriesLocked(grpc_millis now) {
+  for (auto it = entries_.begin(); it != entries_.end();) {
+    Entry* entry = it->second.get();
+    if (!entry->lookup_pending &&
+        (entry->result == nullptr || now >= entry->expiration)) {
+      it = entries_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+void AresDnsCache::AddWaiterLocked(Entry* entry, AresDnsResolver* resolver,
+                                   bool wants_result) {
+  for (Waiter& waiter : entry->waiters) {
+    if (waiter.resolver == resolver) {
+      waiter.wants_result |= wants_result;
+      return;
+    }
+  }
+  resolver->Ref(DEBUG_LOCATION, "dns-cache-wait").release();
+  grpc_pollset_set_add_pollset_set(entry->interested_parties,
+                                   resolver->interested_parties_);
+  entry->waiters.push_back({resolver, wants_result});
+}
+
+void AresDnsCache::Deliver(AresDnsResolver* resolver,
+                           std::shared_ptr<const CachedDnsResult> result,
+                           grpc_error* error) {
+  resolver->Ref(DEBUG_LOCATION, "dns-cache-deliver").release();
+  resolver->work_serializer()->Run(
+      [resolver, result, error]() {
+        resolver->OnCacheResolvedLocked(std::move(result), error);
+        resolver->Unref(DEBUG_LOCATION, "dns-cache-deliver");
+      },
+      DEBUG_LOCATION);
+}
+
+void AresDnsCache::Resolve(AresDnsResolver* resolver) {
+  RefCountedPtr<Entry> entry;
+  std::shared_ptr<const CachedDnsResult> result;
+  bool start_lookup = false;
+  {
+    MutexLock lock(&mu_);
+    const grpc_millis now = ExecCtx::Get()->Now();
+    auto it = entries_.find(resolver->cache_key_);
+    if (it != entries_.end()) {
+      entry = it->second;
+    } else {
+      RemoveStaleEntriesLocked(now);
+      entry = MakeRefCounted<Entry>(resolver);
+      entries_[resolver->cache_key_] = entry;
+    }
+    if (entry->result != nullptr && now < entry->expiration) {
+      result = entry->result;
+      entry->used_since_lookup = true;
+      if (now >= entry->refresh_time && !entry->lookup_pending) {
+        // Let this resolver's pollers drive the refresh.
+        AddWaiterLocked(entry.get(), resolver, /*wants_result=*/false);
+        start_lookup = true;
+      }
+    } else {
+      AddWaiterLocked(entry.get(), resolver, /*wants_result=*/true);
+      start_lookup = !entry->lookup_pending;
+    }
+    if (start_lookup) entry->lookup_pending = true;
+  }
+  GRPC_CARES_TRACE_LOG("resolver:%p dns cache %s for %s%s", resolver,
+                       result != nullptr ? "hit" : "miss",
+                       resolver->cache_key_.c_str(),
+                       start_lookup ? ", starting lookup" : "");
+  if (result != nullptr) {
+    Deliver(resolver, std::move(result), GRPC_ERROR_NONE);
+  }
+  if (start_lookup) entry->StartLookup();
+}
+
+void AresDnsCache::CancelResolve(AresDnsResolver* resolver) {
+  RefCountedPtr<Entry> entry_to_cancel;
+  bool was_waiting = false;
+  {
+    MutexLock lock(&mu_);
+    auto it = entries_.find(resolver->cache_key_);
+    if (it == entries_.end()) return;
+    Entry* entry = it->second.get();
+    for (auto w = entry->waiters.begin(); w != entry->waiters.end(); ++w) {
+      if (w->resolver == resolver) {
+        grpc_pollset_set_del_pollset_set(entry->interested_parties,
+                                         resolver->interested_parties_);
+        entry->waiters.erase(w);
+        was_waiting = true;
+        break;
+      }
+    }
+    if (was_waiting && entry->waiters.empty() && entry->lookup_pending) {
+      entry_to_cancel = it->second;
+    }
+  }
+  if (was_waiting) resolver->Unref(DEBUG_LOCATION, "dns-cache-wait");
+  if (entry_to_cancel != nullptr) entry_to_cancel->MaybeCancelLookup();
+}
+
 AresDnsResolver::AresDnsResolver(ResolverArgs args)
     : Resolver(std::move(args.work_serializer), std::move(args.result_handler)),
       backoff_(
@@ -169,6 +593,15 @@ AresDnsResolver::AresDnsResolver(ResolverArgs args)
   query_timeout_ms_ = grpc_channel_arg_get_integer(
       query_timeout_ms_arg,
       {GRPC_DNS_ARES_DEFAULT_QUERY_TIMEOUT_MS, 0, INT_MAX});
+  // Shared DNS cache option
+  arg = grpc_channel_args_find(channel_args_, GRPC_ARG_DNS_ARES_ENABLE_CACHE);
+  enable_cache_ = grpc_channel_arg_get_bool(arg, false);
+  if (enable_cache_) {
+    // Resolvers only share lookups that ask for the same records.
+    cache_key_ = std::string(dns_server_ == nullptr ? "" : dns_server_) + "/" +
+                 name_to_resolve_ + (enable_srv_queries_ ? "/srv" : "") +
+                 (request_service_config_ ? "/txt" : "");
+  }
 }
 
 AresDnsResolver::~AresDnsResolver() {
@@ -206,6 +639,15 @@ void AresDnsResolver::ShutdownLocked() {
   if (pending_request_ != nullptr) {
     grpc_cancel_ares_request_locked(pending_request_);
   }
+  if (enable_cache_) {
+    AresDnsCache::Get()->CancelResolve(this);
+    // The cache will not call back for this resolution anymore; any result
+    // it has already queued is ignored once resolving_ is false.
+    if (resolving_) {
+      resolving_ = false;
+      Unref(DEBUG_LOCATION, "dns-resolving");
+    }
+  }
 }
 
 void AresDnsResolver::OnNextResolution(void* arg, grpc_error* error) {
@@ -397,6 +839,28 @@ void AresDnsResolver::OnResolvedLocked(grpc_error* error) {
   GRPC_ERROR_UNREF(error);
 }
 
+void AresDnsResolver::OnCacheResolvedLocked(
+    std::shared_ptr<const CachedDnsResult> result, grpc_error* error) {
+  // Stale deliveries, or ones racing with shutdown, have nothing to complete.
+  if (!resolving_) {
+    GRPC_ERROR_UNREF(error);
+    return;
+  }
+  if (result != nullptr) {
+    if (result->addresses != nullptr) {
+      addresses_ = absl::make_unique<ServerAddressList>(*result->addresses);
+    }
+    if (enable_srv_queries_ && result->balancer_addresses != nullptr) {
+      balancer_addresses_ =
+          absl::make_unique<ServerAddressList>(*result->balancer_addresses);
+    }
+    if (request_service_config_) {
+      service_config_json_ = gpr_strdup(result->service_config_json.get());
+    }
+  }
+  OnResolvedLocked(error);
+}
+
 void AresDnsResolver::MaybeStartResolvingLocked() {
   // If there is an existing timer, the time it fires is the earliest time we
   // can start the next resolution.
@@ -435,6 +899,13 @@ void AresDnsResolver::StartResolvingLocked() {
   GPR_ASSERT(!resolving_);
   resolving_ = true;
   service_config_json_ = nullptr;
+  if (enable_cache_) {
+    last_resolution_timestamp_ = grpc_core::ExecCtx::Get()->Now();
+    GRPC_CARES_TRACE_LOG("resolver:%p Started resolving through the cache",
+                         this);
+    AresDnsCache::Get()->Resolve(this);
+    return;
+  }
   pending_request_ = grpc_dns_lookup_ares_locked(
       dns_server_, name_to_resolve_, kDefaultPort, interested_parties_,
       &on_resolved_, &addresses_,
@@ -512,6 +983,7 @@ void grpc_resolver_dns_ares_init() {
       default_resolver = grpc_resolve_address_impl;
     }
     grpc_set_resolver_impl(&ares_resolver);
+    grpc_core::AresDnsCache::Init();
     grpc_core::ResolverRegistry::Builder::RegisterResolverFactory(
         absl::make_unique<grpc_core::AresDnsResolverFactory>());
   } else {
@@ -521,6 +993,7 @@ void grpc_resolver_dns_ares_init() {
 
 void grpc_resolver_dns_ares_shutdown() {
   if (g_use_ares_dns_resolver) {
+    grpc_core::AresDnsCache::Shutdown();
     address_sorting_shutdown();
     grpc_ares_cleanup();
   }
@@ -70,6 +70,10 @@ struct grpc_ares_request {
   grpc_ares_ev_driver* ev_driver;
   /** number of ongoing queries */
   size_t pending_queries;
+  /** whether A and AAAA lookups should record their TTLs */
+  bool want_ttls;
+  /** smallest TTL seen in the A and AAAA answers, or -1 if none carried one */
+  int min_ttl_seconds;
 
   /** the errors explaining query failures, appended to in query callbacks */
   grpc_error* error;
@@ -90,6 +94,8 @@ typedef struct grpc_ares_hostbyname_request {
   bool is_balancer;
   /** for logging and errors: the query type ("A" or "AAAA") */
   const char* qtype;
+  /** address family queried for: AF_INET or AF_INET6 */
+  int family;
 } grpc_ares_hostbyname_request;
 
 static void grpc_ares_request_ref_locked(grpc_ares_request* r);
@@ -205,6 +211,7 @@ static grpc_ares_hostbyname_request* create_hostbyname_request_locked(
   hr->port = port;
   hr->is_balancer = is_balancer;
   hr->qtype = qtype;
+  hr->family = strcmp(qtype, "AAAA") == 0 ? AF_INET6 : AF_INET;
   grpc_ares_request_ref_locked(parent_request);
   return hr;
 }
@@ -291,6 +298,67 @@ static void on_hostbyname_done_locked(void* arg, int status, int /*timeouts*/,
   destroy_hostbyname_request_locked(hr);
 }
 
+/* Upper bound on the number of per-address TTLs read from one answer. Only the
+   smallest one is kept, so a partial read just makes it less precise. */
+#define GRPC_ARES_MAX_ADDR_TTLS 32
+
+/* Parses an A or AAAA answer the way ares_gethostbyname would, additionally
+   recording the smallest record TTL on the parent request. */
+static void on_hostbyname_query_done_locked(void* arg, int status,
+                                            int timeouts, unsigned char* abuf,
+                                            int alen) {
+  grpc_ares_hostbyname_request* hr =
+      static_cast<grpc_ares_hostbyname_request*>(arg);
+  struct hostent* hostent = nullptr;
+  int naddrttls = GRPC_ARES_MAX_ADDR_TTLS;
+  int ttls[GRPC_ARES_MAX_ADDR_TTLS];
+  if (status == ARES_SUCCESS) {
+    if (hr->family == AF_INET6) {
+      struct ares_addr6ttl addrttls[GRPC_ARES_MAX_ADDR_TTLS];
+      status =
+          ares_parse_aaaa_reply(abuf, alen, &hostent, addrttls, &naddrttls);
+      for (int i = 0; i < naddrttls; i++) ttls[i] = addrttls[i].ttl;
+    } else {
+      struct ares_addrttl addrttls[GRPC_ARES_MAX_ADDR_TTLS];
+      status = ares_parse_a_reply(abuf, alen, &hostent, addrttls, &naddrttls);
+      for (int i = 0; i < naddrttls; i++) ttls[i] = addrttls[i].ttl;
+    }
+  }
+  if (status == ARES_SUCCESS) {
+    grpc_ares_request* r = hr->parent_request;
+    for (int i = 0; i < naddrttls; i++) {
+      if (r->min_ttl_seconds < 0 || ttls[i] < r->min_ttl_seconds) {
+        r->min_ttl_seconds = ttls[i];
+      }
+    }
+  }
+  on_hostbyname_done_locked(hr, status, timeouts, hostent);
+  if (hostent != nullptr) ares_free_hostent(hostent);
+}
+
+/* Looks up the addresses of \a hr->host. Normally this is just
+   ares_gethostbyname. When the parent request wants TTLs, the hosts file is
+   consulted first and DNS answers are parsed here so that their TTLs are not
+   lost; that path ignores the resolver's sortlist and lookup order. */
+static void start_hostbyname_query_locked(ares_channel channel,
+                                          grpc_ares_hostbyname_request* hr) {
+  if (!hr->parent_request->want_ttls) {
+    ares_gethostbyname(channel, hr->host, hr->family, on_hostbyname_done_locked,
+                       hr);
+    return;
+  }
+  struct hostent* hostent = nullptr;
+  if (ares_gethostbyname_file(channel, hr->host, hr->family, &hostent) ==
+      ARES_SUCCESS) {
+    on_hostbyname_done_locked(hr, ARES_SUCCESS, 0, hostent);
+    ares_free_hostent(hostent);
+    return;
+  }
+  ares_search(channel, hr->host, ns_c_in,
+              hr->family == AF_INET6 ? ns_t_aaaa : ns_t_a,
+              on_hostbyname_query_done_locked, hr);
+}
+
 static void on_srv_query_done_locked(void* arg, int status, int /*timeouts*/,
                                      unsigned char* abuf, int alen) {
   GrpcAresQuery* q = static_cast<GrpcAresQuery*>(arg);
@@ -312,13 +380,11 @@ static void on_srv_query_done_locked(void* arg, int status, int /*timeouts*/,
           grpc_ares_hostbyname_request* hr = create_hostbyname_request_locked(
               r, srv_it->host, htons(srv_it->port), true /* is_balancer */,
               "AAAA");
-          ares_gethostbyname(*channel, hr->host, AF_INET6,
-                             on_hostbyname_done_locked, hr);
+          start_hostbyname_query_locked(*channel, hr);
         }
         grpc_ares_hostbyname_request* hr = create_hostbyname_request_locked(
             r, srv_it->host, htons(srv_it->port), true /* is_balancer */, "A");
-        ares_gethostbyname(*channel, hr->host, AF_INET,
-                           on_hostbyname_done_locked, hr);
+        start_hostbyname_query_locked(*channel, hr);
         grpc_ares_ev_driver_start_locked(r->ev_driver);
       }
     }
@@ -472,14 +538,12 @@ void grpc_dns_lookup_ares_continue_after_check_localhost_and_ip_literals_locked(
     hr = create_hostbyname_request_locked(r, host.c_str(),
                                           grpc_strhtons(port.c_str()),
                                           /*is_balancer=*/false, "AAAA");
-    ares_gethostbyname(*channel, hr->host, AF_INET6, on_hostbyname_done_locked,
-                       hr);
+    start_hostbyname_query_locked(*channel, hr);
   }
   hr = create_hostbyname_request_locked(r, host.c_str(),
                                         grpc_strhtons(port.c_str()),
                                         /*is_balancer=*/false, "A");
-  ares_gethostbyname(*channel, hr->host, AF_INET, on_hostbyname_done_locked,
-                     hr);
+  start_hostbyname_query_locked(*channel, hr);
   if (r->balancer_addresses_out != nullptr) {
     /* Query the SRV record */
     char* service_name;
@@ -638,13 +702,14 @@ static bool grpc_ares_maybe_resolve_localhost_manually_locked(
 }
 #endif /* GRPC_ARES_RESOLVE_LOCALHOST_MANUALLY */
 
-static grpc_ares_request* grpc_dns_lookup_ares_locked_impl(
+static grpc_ares_request* dns_lookup_ares_locked(
     const char* dns_server, const char* name, const char* default_port,
     grpc_pollset_set* interested_parties, grpc_closure* on_done,
     std::unique_ptr<grpc_core::ServerAddressList>* addrs,
     std::unique_ptr<grpc_core::ServerAddressList>* balancer_addrs,
     char** service_config_json, int query_timeout_ms,
-    std::shared_ptr<grpc_core::WorkSerializer> work_serializer) {
+    std::shared_ptr<grpc_core::WorkSerializer> work_serializer,
+    bool want_ttls) {
   grpc_ares_request* r =
       static_cast<grpc_ares_request*>(gpr_zalloc(sizeof(grpc_ares_request)));
   r->ev_driver = nullptr;
@@ -654,6 +719,8 @@ static grpc_ares_request* grpc_dns_lookup_ares_locked_impl(
   r->service_config_json_out = service_config_json;
   r->error = GRPC_ERROR_NONE;
   r->pending_queries = 0;
+  r->want_ttls = want_ttls;
+  r->min_ttl_seconds = -1;
   GRPC_CARES_TRACE_LOG(
       "request:%p c-ares grpc_dns_lookup_ares_locked_impl name=%s, "
       "default_port=%s",
@@ -683,6 +750,34 @@ static grpc_ares_request* grpc_dns_lookup_ares_locked_impl(
   return r;
 }
 
+static grpc_ares_request* grpc_dns_lookup_ares_locked_impl(
+    const char* dns_server, const char* name, const char* default_port,
+    grpc_pollset_set* interested_parties, grpc_closure* on_done,
+    std::unique_ptr<grpc_core::ServerAddressList>* addrs,
+    std::unique_ptr<grpc_core::ServerAddressList>* balancer_addrs,
+    char** service_config_json, int query_timeout_ms,
+    std::shared_ptr<grpc_core::WorkSerializer> work_serializer) {
+  return dns_lookup_ares_locked(dns_server, name, default_port,
+                                interested_parties, on_done, addrs,
+                                balancer_addrs, service_config_json,
+                                query_timeout_ms, std::move(work_serializer),
+                                /*want_ttls=*/false);
+}
+
+grpc_ares_request* grpc_dns_lookup_ares_with_ttls_locked(
+    const char* dns_server, const char* name, const char* default_port,
+    grpc_pollset_set* interested_parties, grpc_closure* on_done,
+    std::unique_ptr<grpc_core::ServerAddressList>* addrs,
+    std::unique_ptr<grpc_core::ServerAddressList>* balancer_addrs,
+    char** service_config_json, int query_timeout_ms,
+    std::shared_ptr<grpc_core::WorkSerializer> work_serializer) {
+  return dns_lookup_ares_locked(dns_server, name, default_port,
+                                interested_parties, on_done, addrs,
+                                balancer_addrs, service_config_json,
+                                query_timeout_ms, std::move(work_serializer),
+                                /*want_ttls=*/true);
+}
+
 grpc_ares_request* (*grpc_dns_lookup_ares_locked)(
     const char* dns_server, const char* name, const char* default_port,
     grpc_pollset_set* interested_parties, grpc_closure* on_done,
@@ -702,6 +797,10 @@ static void grpc_cancel_ares_request_locked_impl(grpc_ares_request* r) {
 void (*grpc_cancel_ares_request_locked)(grpc_ares_request* r) =
     grpc_cancel_ares_request_locked_impl;
 
+int grpc_ares_request_min_ttl_seconds(const grpc_ares_request* r) {
+  return r == nullptr ? -1 : r->min_ttl_seconds;
+}
+
 // ares_library_init and ares_library_cleanup are currently no-op except under
 // Windows. Calling them may cause race conditions when other parts of the
 // binary calls these functions concurrently.
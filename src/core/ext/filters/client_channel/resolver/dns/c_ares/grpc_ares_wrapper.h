@@ -69,9 +69,28 @@ extern grpc_ares_request* (*grpc_dns_lookup_ares_locked)(
     char** service_config_json, int query_timeout_ms,
     std::shared_ptr<grpc_core::WorkSerializer> work_serializer);
 
+/* Like grpc_dns_lookup_ares_locked, but looks up addresses in a way that
+   keeps their TTLs, for grpc_ares_request_min_ttl_seconds(). Unlike the
+   ares_gethostbyname lookups done otherwise, this ignores the resolver's
+   sortlist and lookup order: the hosts file is always consulted before DNS. */
+grpc_ares_request* grpc_dns_lookup_ares_with_ttls_locked(
+    const char* dns_server, const char* name, const char* default_port,
+    grpc_pollset_set* interested_parties, grpc_closure* on_done,
+    std::unique_ptr<grpc_core::ServerAddressList>* addresses,
+    std::unique_ptr<grpc_core::ServerAddressList>* balancer_addresses,
+    char** service_config_json, int query_timeout_ms,
+    std::shared_ptr<grpc_core::WorkSerializer> work_serializer);
+
 /* Cancel the pending grpc_ares_request \a request */
 extern void (*grpc_cancel_ares_request_locked)(grpc_ares_request* request);
 
+/* Returns the smallest TTL, in seconds, of the DNS address records behind the
+   addresses returned by \a request, or -1 if none of them came with a TTL
+   (e.g. \a request was not started by grpc_dns_lookup_ares_with_ttls_locked,
+   the addresses were read from the hosts file, or \a request is null). Only
+   meaningful once the request's on_done has been invoked. */
+int grpc_ares_request_min_ttl_seconds(const grpc_ares_request* request);
+
 /* Initialize gRPC ares wrapper. Must be called at least once before
    grpc_resolve_address_ares(). */
 grpc_error* grpc_ares_init(void);
@@ -31,6 +31,7 @@
 #include "src/core/ext/filters/client_channel/server_address.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/gpr/string.h"
+#include "src/core/lib/iomgr/endpoint_shm.h"
 #include "src/core/lib/iomgr/resolve_address.h"
 #include "src/core/lib/iomgr/unix_sockets_posix.h"
 #include "src/core/lib/iomgr/work_serializer.h"
@@ -170,6 +171,42 @@ class UnixResolverFactory : public ResolverFactory {
 };
 #endif  // GRPC_HAVE_UNIX_SOCKET
 
+#ifdef GRPC_HAVE_SHM_ENDPOINT
+// "shm:path" connects to the Unix domain socket at path and then moves the
+// connection onto shared memory.
+bool ParseShm(const grpc_uri* uri, grpc_resolved_address* resolved_addr) {
+  grpc_uri unix_uri = *uri;
+  unix_uri.scheme = const_cast<char*>("unix");
+  return grpc_parse_unix(&unix_uri, resolved_addr);
+}
+
+class ShmResolverFactory : public ResolverFactory {
+ public:
+  bool IsValidUri(const grpc_uri* uri) const override {
+    return ParseUri(uri, ParseShm, nullptr);
+  }
+
+  OrphanablePtr<Resolver> CreateResolver(ResolverArgs args) const override {
+    grpc_arg arg = grpc_channel_arg_integer_create(
+        const_cast<char*>(GRPC_ARG_UNIX_SOCKET_SHARED_MEMORY), 1);
+    grpc_channel_args* new_args =
+        grpc_channel_args_copy_and_add(args.args, &arg, 1);
+    args.args = new_args;
+    OrphanablePtr<Resolver> resolver =
+        CreateSockaddrResolver(std::move(args), ParseShm);
+    grpc_channel_args_destroy(new_args);
+    return resolver;
+  }
+
+  grpc_core::UniquePtr<char> GetDefaultAuthority(
+      grpc_uri* /*uri*/) const override {
+    return grpc_core::UniquePtr<char>(gpr_strdup("localhost"));
+  }
+
+  const char* scheme() const override { return "shm"; }
+};
+#endif  // GRPC_HAVE_SHM_ENDPOINT
+
 }  // namespace
 
 }  // namespace grpc_core
@@ -183,6 +220,10 @@ void grpc_resolver_sockaddr_init() {
   grpc_core::ResolverRegistry::Builder::RegisterResolverFactory(
       absl::make_unique<grpc_core::UnixResolverFactory>());
 #endif
+#ifdef GRPC_HAVE_SHM_ENDPOINT
+  grpc_core::ResolverRegistry::Builder::RegisterResolverFactory(
+      absl::make_unique<grpc_core::ShmResolverFactory>());
+#endif
 }
 
 void grpc_resolver_sockaddr_shutdown() {}
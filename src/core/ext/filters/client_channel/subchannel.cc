@@ -314,7 +314,8 @@ class Subchannel::ConnectedSubchannelStateWatcher
     : public AsyncConnectivityStateWatcherInterface {
  public:
   // Must be instantiated while holding c->mu.
-  explicit ConnectedSubchannelStateWatcher(Subchannel* c) : subchannel_(c) {
+  ConnectedSubchannelStateWatcher(Subchannel* c, uint64_t connection_id)
+      : subchannel_(c), connection_id_(connection_id) {
     // Steal subchannel ref for connecting.
     GRPC_SUBCHANNEL_WEAK_REF(subchannel_, "state_watcher");
     GRPC_SUBCHANNEL_WEAK_UNREF(subchannel_, "connecting");
@@ -328,6 +329,23 @@ class Subchannel::ConnectedSubchannelStateWatcher
   void OnConnectivityStateChange(grpc_connectivity_state new_state) override {
     Subchannel* c = subchannel_;
     MutexLock lock(&c->mu_);
+    if (c->connected_subchannel_ == nullptr ||
+        c->connected_subchannel_id_ != connection_id_) {
+      // One of the additional connections, or one the subchannel has
+      // already dropped.  Drop it and open a replacement.
+      if (new_state == GRPC_CHANNEL_TRANSIENT_FAILURE ||
+          new_state == GRPC_CHANNEL_SHUTDOWN) {
+        auto& connections = c->additional_connections_;
+        for (auto it = connections.begin(); it != connections.end(); ++it) {
+          if (it->id == connection_id_) {
+            connections.erase(it);
+            c->MaybeStartAdditionalConnectionLocked();
+            break;
+          }
+        }
+      }
+      return;
+    }
     switch (new_state) {
       case GRPC_CHANNEL_TRANSIENT_FAILURE:
       case GRPC_CHANNEL_SHUTDOWN: {
@@ -339,6 +357,9 @@ class Subchannel::ConnectedSubchannelStateWatcher
                     c->connected_subchannel_.get(), c,
                     ConnectivityStateName(new_state));
           }
+          // While other connections are still up, the subchannel stays
+          // READY on one of them.
+          if (c->PromoteAdditionalConnectionLocked()) break;
           c->connected_subchannel_.reset();
           if (c->channelz_node() != nullptr) {
             c->channelz_node()->SetChildSocket(nullptr);
@@ -360,6 +381,10 @@ class Subchannel::ConnectedSubchannelStateWatcher
   }
 
   Subchannel* subchannel_;
+  // The connection being watched.  An id rather than a pointer, since the
+  // subchannel may have dropped the connection and allocated a new one at
+  // the same address.
+  const uint64_t connection_id_;
 };
 
 // Asynchronously notifies the \a watcher of a change in the connectvity state
@@ -473,8 +498,11 @@ class Subchannel::HealthWatcherMap::HealthWatcher
         watcher_list_.NotifyLocked(subchannel_, state_);
       }
       // If we've become connected, start health checking.
+      keep_state_until_checked_ = false;
+      health_check_client_.reset();
       StartHealthCheckingLocked();
     } else {
+      keep_state_until_checked_ = false;
       state_ = state;
       watcher_list_.NotifyLocked(subchannel_, state_);
       // We're not connected, so stop health checking.
@@ -482,6 +510,21 @@ class Subchannel::HealthWatcherMap::HealthWatcher
     }
   }
 
+  // Moves health checking to the subchannel's new connection after one of
+  // its additional connections was promoted.  The backend has not changed,
+  // so the last reported health state stands until the health check call
+  // on the new connection reports a result.
+  void OnConnectionPromotedLocked() {
+    if (health_check_client_ == nullptr) return;
+    keep_state_until_checked_ = true;
+    health_check_client_.reset();
+    StartHealthCheckingLocked();
+    // Watchers that saw READY must move on to the new connection.
+    if (state_ == GRPC_CHANNEL_READY) {
+      watcher_list_.NotifyLocked(subchannel_, state_);
+    }
+  }
+
   void Orphan() override {
     watcher_list_.Clear();
     health_check_client_.reset();
@@ -492,6 +535,11 @@ class Subchannel::HealthWatcherMap::HealthWatcher
   void OnConnectivityStateChange(grpc_connectivity_state new_state) override {
     MutexLock lock(&subchannel_->mu_);
     if (new_state != GRPC_CHANNEL_SHUTDOWN && health_check_client_ != nullptr) {
+      if (keep_state_until_checked_) {
+        // The new health check call has only started.
+        if (new_state == GRPC_CHANNEL_CONNECTING) return;
+        keep_state_until_checked_ = false;
+      }
       state_ = new_state;
       watcher_list_.NotifyLocked(subchannel_, new_state);
     }
@@ -508,6 +556,9 @@ class Subchannel::HealthWatcherMap::HealthWatcher
   grpc_core::UniquePtr<char> health_check_service_name_;
   OrphanablePtr<HealthCheckClient> health_check_client_;
   grpc_connectivity_state state_;
+  // Set by OnConnectionPromotedLocked() until the new health check call
+  // reports something other than CONNECTING.
+  bool keep_state_until_checked_ = false;
   ConnectivityStateWatcherList watcher_list_;
 };
 
@@ -553,6 +604,12 @@ void Subchannel::HealthWatcherMap::NotifyLocked(grpc_connectivity_state state) {
   }
 }
 
+void Subchannel::HealthWatcherMap::OnConnectionPromotedLocked() {
+  for (const auto& p : map_) {
+    p.second->OnConnectionPromotedLocked();
+  }
+}
+
 grpc_connectivity_state
 Subchannel::HealthWatcherMap::CheckConnectivityStateLocked(
     Subchannel* subchannel, const char* health_check_service_name) {
@@ -648,7 +705,9 @@ Subchannel::Subchannel(SubchannelKey* key,
                        const grpc_channel_args* args)
     : key_(key),
       connector_(std::move(connector)),
-      backoff_(ParseArgsForBackoffValues(args, &min_connect_timeout_ms_)) {
+      backoff_(ParseArgsForBackoffValues(args, &min_connect_timeout_ms_)),
+      additional_backoff_(
+          ParseArgsForBackoffValues(args, &min_connect_timeout_ms_)) {
   GRPC_STATS_INC_CLIENT_SUBCHANNELS_CREATED();
   gpr_atm_no_barrier_store(&ref_pair_, 1 << INTERNAL_REF_BITS);
   pollset_set_ = grpc_pollset_set_create();
@@ -672,6 +731,8 @@ Subchannel::Subchannel(SubchannelKey* key,
   if (new_args != nullptr) grpc_channel_args_destroy(new_args);
   GRPC_CLOSURE_INIT(&on_connecting_finished_, OnConnectingFinished, this,
                     grpc_schedule_on_exec_ctx);
+  max_connections_ = grpc_channel_args_find_integer(
+      args_, GRPC_ARG_SUBCHANNEL_CONNECTIONS, {1, 1, 64});
   const grpc_arg* arg = grpc_channel_args_find(args_, GRPC_ARG_ENABLE_CHANNELZ);
   const bool channelz_enabled =
       grpc_channel_arg_get_bool(arg, GRPC_ENABLE_CHANNELZ_DEFAULT);
@@ -851,6 +912,19 @@ void Subchannel::CancelConnectivityStateWatch(
   }
 }
 
+RefCountedPtr<ConnectedSubchannel> Subchannel::PickConnectedSubchannel(
+    ConnectedSubchannel* primary) {
+  if (max_connections_ > 1) {
+    MutexLock lock(&mu_);
+    const size_t index = next_connected_subchannel_++ %
+                         (additional_connections_.size() + 1);
+    if (index > 0) {
+      return additional_connections_[index - 1].connected_subchannel;
+    }
+  }
+  return primary->Ref();
+}
+
 void Subchannel::AttemptToConnect() {
   MutexLock lock(&mu_);
   MaybeStartConnectingLocked();
@@ -859,6 +933,7 @@ void Subchannel::AttemptToConnect() {
 void Subchannel::ResetBackoff() {
   MutexLock lock(&mu_);
   backoff_.Reset();
+  additional_backoff_.Reset();
   if (have_retry_alarm_) {
     retry_immediately_ = true;
     grpc_timer_cancel(&retry_alarm_);
@@ -978,6 +1053,66 @@ void Subchannel::MaybeStartConnectingLocked() {
   }
 }
 
+void Subchannel::MaybeStartAdditionalConnectionLocked() {
+  if (disconnected_ || connecting_ || have_additional_retry_alarm_ ||
+      connected_subchannel_ == nullptr) {
+    return;
+  }
+  if (additional_connections_.size() + 1 >=
+      static_cast<size_t>(max_connections_)) {
+    return;
+  }
+  connecting_ = true;
+  connecting_additional_ = true;
+  GRPC_SUBCHANNEL_WEAK_REF(this, "connecting");
+  // The subchannel is already READY, so this does not change the
+  // connectivity state.  Failures back off on additional_backoff_.
+  SubchannelConnector::Args args;
+  args.interested_parties = pollset_set_;
+  args.deadline = min_connect_timeout_ms_ + ExecCtx::Get()->Now();
+  args.channel_args = args_;
+  connector_->Connect(args, &connecting_result_, &on_connecting_finished_);
+}
+
+bool Subchannel::PromoteAdditionalConnectionLocked() {
+  if (additional_connections_.empty()) return false;
+  AdditionalConnection& promoted = additional_connections_.front();
+  connected_subchannel_ = std::move(promoted.connected_subchannel);
+  connected_subchannel_id_ = promoted.id;
+  if (channelz_node_ != nullptr) {
+    channelz_node_->SetChildSocket(std::move(promoted.socket_node));
+  }
+  additional_connections_.erase(additional_connections_.begin());
+  gpr_log(GPR_INFO, "Promoted connected subchannel %p for subchannel %p",
+          connected_subchannel_.get(), this);
+  // Still READY, so the state is not set again: that would restart health
+  // checking from CONNECTING.  Watchers only move on to the new connection.
+  watcher_list_.NotifyLocked(this, GRPC_CHANNEL_READY);
+  health_watcher_map_.OnConnectionPromotedLocked();
+  MaybeStartAdditionalConnectionLocked();
+  return true;
+}
+
+void Subchannel::StartAdditionalRetryAlarmLocked() {
+  have_additional_retry_alarm_ = true;
+  GRPC_SUBCHANNEL_WEAK_REF(this, "additional_retry_alarm");
+  GRPC_CLOSURE_INIT(&on_additional_retry_alarm_, OnAdditionalRetryAlarm, this,
+                    grpc_schedule_on_exec_ctx);
+  grpc_timer_init(&additional_retry_alarm_,
+                  additional_backoff_.NextAttemptTime(),
+                  &on_additional_retry_alarm_);
+}
+
+void Subchannel::OnAdditionalRetryAlarm(void* arg, grpc_error* error) {
+  Subchannel* c = static_cast<Subchannel*>(arg);
+  {
+    MutexLock lock(&c->mu_);
+    c->have_additional_retry_alarm_ = false;
+    if (error == GRPC_ERROR_NONE) c->MaybeStartAdditionalConnectionLocked();
+  }
+  GRPC_SUBCHANNEL_WEAK_UNREF(c, "additional_retry_alarm");
+}
+
 void Subchannel::OnRetryAlarm(void* arg, grpc_error* error) {
   Subchannel* c = static_cast<Subchannel*>(arg);
   // TODO(soheilhy): Once subchannel refcounting is simplified, we can get use
@@ -1024,11 +1159,26 @@ void Subchannel::OnConnectingFinished(void* arg, grpc_error* error) {
   {
     MutexLock lock(&c->mu_);
     c->connecting_ = false;
+    const bool additional = c->connecting_additional_;
+    c->connecting_additional_ = false;
     if (c->connecting_result_.transport != nullptr &&
         c->PublishTransportLocked()) {
       // Do nothing, transport was published.
     } else if (c->disconnected_) {
       GRPC_SUBCHANNEL_WEAK_UNREF(c, "connecting");
+    } else if (additional) {
+      gpr_log(GPR_INFO, "Additional connect failed: %s",
+              grpc_error_string(error));
+      GRPC_SUBCHANNEL_WEAK_UNREF(c, "connecting");
+      if (c->connected_subchannel_ == nullptr) {
+        // The primary connection was lost meanwhile, and its reconnect was
+        // skipped because this attempt was in flight.  Start it now.
+        c->MaybeStartConnectingLocked();
+      } else {
+        // Retry with backoff, so that a backend refusing extra connections
+        // is not hammered with them.
+        c->StartAdditionalRetryAlarmLocked();
+      }
     } else {
       gpr_log(GPR_INFO, "Connect failed: %s", grpc_error_string(error));
       c->SetConnectivityStateLocked(GRPC_CHANNEL_TRANSIENT_FAILURE);
@@ -1079,9 +1229,26 @@ bool Subchannel::PublishTransportLocked() {
     gpr_free(stk);
     return false;
   }
+  if (connected_subchannel_ != nullptr) {
+    // An additional connection.  The subchannel is already READY, so there
+    // is nothing to report; just make it available to new calls.
+    AdditionalConnection connection;
+    connection.id = next_connection_id_++;
+    connection.connected_subchannel.reset(
+        new ConnectedSubchannel(stk, args_, channelz_node_));
+    connection.socket_node = std::move(socket);
+    connection.connected_subchannel->StartWatch(
+        pollset_set_,
+        MakeOrphanable<ConnectedSubchannelStateWatcher>(this, connection.id));
+    additional_connections_.push_back(std::move(connection));
+    additional_backoff_.Reset();
+    MaybeStartAdditionalConnectionLocked();
+    return true;
+  }
   // Publish.
   connected_subchannel_.reset(
       new ConnectedSubchannel(stk, args_, channelz_node_));
+  connected_subchannel_id_ = next_connection_id_++;
   gpr_log(GPR_INFO, "New connected subchannel at %p for subchannel %p",
           connected_subchannel_.get(), this);
   if (channelz_node_ != nullptr) {
@@ -1089,9 +1256,11 @@ bool Subchannel::PublishTransportLocked() {
   }
   // Start watching connected subchannel.
   connected_subchannel_->StartWatch(
-      pollset_set_, MakeOrphanable<ConnectedSubchannelStateWatcher>(this));
+      pollset_set_, MakeOrphanable<ConnectedSubchannelStateWatcher>(
+                        this, connected_subchannel_id_));
   // Report initial state.
   SetConnectivityStateLocked(GRPC_CHANNEL_READY);
+  MaybeStartAdditionalConnectionLocked();
   return true;
 }
 
@@ -1107,6 +1276,8 @@ void Subchannel::Disconnect() {
   disconnected_ = true;
   connector_.reset();
   connected_subchannel_.reset();
+  additional_connections_.clear();
+  if (have_additional_retry_alarm_) grpc_timer_cancel(&additional_retry_alarm_);
   health_watcher_map_.ShutdownLocked();
 }
 
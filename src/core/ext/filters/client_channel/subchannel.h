@@ -22,6 +22,7 @@
 #include <grpc/support/port_platform.h>
 
 #include <deque>
+#include <vector>
 
 #include "src/core/ext/filters/client_channel/client_channel_channelz.h"
 #include "src/core/ext/filters/client_channel/connector.h"
@@ -272,6 +273,13 @@ class Subchannel {
   void CancelConnectivityStateWatch(const char* health_check_service_name,
                                     ConnectivityStateWatcherInterface* watcher);
 
+  // Returns the connection a new call should use.  \a primary is the
+  // connected subchannel from the caller's last READY notification.  When
+  // GRPC_ARG_SUBCHANNEL_CONNECTIONS is greater than 1, calls are instead
+  // spread round-robin over \a primary and the additional connections.
+  RefCountedPtr<ConnectedSubchannel> PickConnectedSubchannel(
+      ConnectedSubchannel* primary);
+
   // Attempt to connect to the backend.  Has no effect if already connected.
   void AttemptToConnect();
 
@@ -341,6 +349,9 @@ class Subchannel {
     // Notifies the watcher when the subchannel's state changes.
     void NotifyLocked(grpc_connectivity_state state);
 
+    // Moves health checking to a promoted additional connection.
+    void OnConnectionPromotedLocked();
+
     grpc_connectivity_state CheckConnectivityStateLocked(
         Subchannel* subchannel, const char* health_check_service_name);
 
@@ -356,11 +367,22 @@ class Subchannel {
 
   class AsyncWatcherNotifierLocked;
 
+  struct AdditionalConnection {
+    // Identifies the connection to its state watcher.
+    uint64_t id;
+    RefCountedPtr<ConnectedSubchannel> connected_subchannel;
+    RefCountedPtr<channelz::SocketNode> socket_node;
+  };
+
   // Sets the subchannel's connectivity state to \a state.
   void SetConnectivityStateLocked(grpc_connectivity_state state);
 
   // Methods for connection.
   void MaybeStartConnectingLocked();
+  void MaybeStartAdditionalConnectionLocked();
+  bool PromoteAdditionalConnectionLocked();
+  void StartAdditionalRetryAlarmLocked();
+  static void OnAdditionalRetryAlarm(void* arg, grpc_error* error);
   static void OnRetryAlarm(void* arg, grpc_error* error);
   void ContinueConnectingLocked();
   static void OnConnectingFinished(void* arg, grpc_error* error);
@@ -395,7 +417,19 @@ class Subchannel {
   grpc_closure on_connecting_finished_;
   // Active connection, or null.
   RefCountedPtr<ConnectedSubchannel> connected_subchannel_;
+  uint64_t connected_subchannel_id_ = 0;
+  // Connections opened after connected_subchannel_ when
+  // GRPC_ARG_SUBCHANNEL_CONNECTIONS asks for more than one.  They are opened
+  // one at a time through connector_, and only while connected_subchannel_
+  // is set.  If connected_subchannel_ fails, the oldest one takes its place.
+  int max_connections_;
+  std::vector<AdditionalConnection> additional_connections_;
+  size_t next_connected_subchannel_ = 0;
+  uint64_t next_connection_id_ = 1;
   bool connecting_ = false;
+  // Whether the connection attempt in flight is for an additional
+  // connection.
+  bool connecting_additional_ = false;
   bool disconnected_ = false;
 
   // Connectivity state tracking.
@@ -418,6 +452,13 @@ class Subchannel {
   // reset_backoff() was called while alarm was pending.
   bool retry_immediately_ = false;
 
+  // Backoff and retry alarm for additional connections, kept apart from the
+  // primary connection's so that neither delays the other.
+  BackOff additional_backoff_;
+  grpc_timer additional_retry_alarm_;
+  grpc_closure on_additional_retry_alarm_;
+  bool have_additional_retry_alarm_ = false;
+
   // Channelz tracking.
   RefCountedPtr<channelz::SubchannelNode> channelz_node_;
 };
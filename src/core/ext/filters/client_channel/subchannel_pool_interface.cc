@@ -31,32 +31,24 @@ namespace grpc_core {
 
 TraceFlag grpc_subchannel_pool_trace(false, "subchannel_pool");
 
-SubchannelKey::SubchannelKey(const grpc_channel_args* args) {
-  Init(args, grpc_channel_args_normalize);
-}
+SubchannelKey::SubchannelKey(const grpc_channel_args* args)
+    : args_(MakeRefCounted<SharedArgs>(args)) {}
 
-SubchannelKey::~SubchannelKey() {
-  grpc_channel_args_destroy(const_cast<grpc_channel_args*>(args_));
-}
+SubchannelKey::~SubchannelKey() {}
 
-SubchannelKey::SubchannelKey(const SubchannelKey& other) {
-  Init(other.args_, grpc_channel_args_copy);
-}
+SubchannelKey::SubchannelKey(const SubchannelKey& other)
+    : args_(other.args_) {}
 
 SubchannelKey& SubchannelKey::operator=(const SubchannelKey& other) {
-  grpc_channel_args_destroy(const_cast<grpc_channel_args*>(args_));
-  Init(other.args_, grpc_channel_args_copy);
+  args_ = other.args_;
   return *this;
 }
 
 int SubchannelKey::Cmp(const SubchannelKey& other) const {
-  return grpc_channel_args_compare(args_, other.args_);
-}
-
-void SubchannelKey::Init(
-    const grpc_channel_args* args,
-    grpc_channel_args* (*copy_channel_args)(const grpc_channel_args* args)) {
-  args_ = copy_channel_args(args);
+  if (args_ == other.args_) return 0;
+  int c = GPR_ICMP(args_->hash(), other.args_->hash());
+  if (c != 0) return c;
+  return grpc_channel_args_compare(args_->args(), other.args_->args());
 }
 
 namespace {
@@ -44,16 +44,33 @@ class SubchannelKey {
   SubchannelKey(SubchannelKey&&) = delete;
   SubchannelKey& operator=(SubchannelKey&&) = delete;
 
+  // Orders keys by hash first, so most comparisons between distinct keys
+  // don't have to walk their args.
   int Cmp(const SubchannelKey& other) const;
 
- private:
-  // Initializes the subchannel key with the given \a args and the function to
-  // copy channel args.
-  void Init(
-      const grpc_channel_args* args,
-      grpc_channel_args* (*copy_channel_args)(const grpc_channel_args* args));
+  // Hash of the normalized args, computed once when the key is created.
+  size_t Hash() const { return args_->hash(); }
 
-  const grpc_channel_args* args_;
+ private:
+  // The normalized args and their hash. Immutable, and shared by all copies
+  // of a key: the subchannel pools copy keys on every AVL insertion and
+  // removal, which used to deep-copy the args each time.
+  class SharedArgs : public RefCounted<SharedArgs> {
+   public:
+    explicit SharedArgs(const grpc_channel_args* args)
+        : args_(grpc_channel_args_normalize(args)),
+          hash_(grpc_channel_args_hash(args_)) {}
+    ~SharedArgs() { grpc_channel_args_destroy(args_); }
+
+    const grpc_channel_args* args() const { return args_; }
+    size_t hash() const { return hash_; }
+
+   private:
+    grpc_channel_args* args_;
+    const size_t hash_;
+  };
+
+  RefCountedPtr<SharedArgs> args_;
 };
 
 // Interface for subchannel pool.
@@ -21,6 +21,8 @@
 #include <algorithm>
 #include <cctype>
 #include <cstdlib>
+#include <map>
+#include <memory>
 
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_join.h"
@@ -34,6 +36,7 @@
 #include "src/core/lib/gpr/env.h"
 #include "src/core/lib/gpr/string.h"
 #include "src/core/lib/gpr/useful.h"
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/iomgr/error.h"
 #include "src/core/lib/iomgr/sockaddr_utils.h"
 
@@ -1476,6 +1479,82 @@ grpc_error* DropParseAndAppend(
   return GRPC_ERROR_NONE;
 }
 
+// Process-wide cache of parsed EDS resources, keyed by type URL, resource
+// name and the serialized ClusterLoadAssignment itself.  Entries are held
+// weakly: a parsed update lives as long as some XdsClient (or the policy it
+// was handed to) still uses it, and a control plane that sends the same
+// resource to N channels causes it to be converted and stored once rather
+// than N times.
+class EdsResourceCache {
+ public:
+  struct Resource {
+    std::string eds_service_name;
+    XdsApi::EdsUpdate update;
+  };
+
+  static EdsResourceCache* Get() {
+    // Intentionally leaked, since XdsClients may outlive static destructors.
+    static EdsResourceCache* cache = new EdsResourceCache();
+    return cache;
+  }
+
+  // The key holds the serialized bytes, so a hit is only ever an identical
+  // resource: a hash alone could let a control plane that controls the bytes
+  // make two different versions of a resource collide.  The name is length
+  // prefixed, so that name and bytes cannot run into each other.
+  static std::string Key(absl::string_view eds_service_name,
+                         absl::string_view serialized) {
+    return absl::StrCat(XdsApi::kEdsTypeUrl, "/", eds_service_name.size(), "/",
+                        eds_service_name, "/", serialized);
+  }
+
+  std::shared_ptr<const Resource> Lookup(const std::string& key) {
+    MutexLock lock(&mu_);
+    auto it = map_.find(key);
+    if (it == map_.end()) return nullptr;
+    std::shared_ptr<const Resource> resource = it->second.lock();
+    if (resource == nullptr) map_.erase(it);
+    return resource;
+  }
+
+  // Returns the cached instance if another thread inserted an identical
+  // resource in the meantime, otherwise caches and returns resource.
+  std::shared_ptr<const Resource> Insert(
+      std::string key, std::shared_ptr<const Resource> resource) {
+    MutexLock lock(&mu_);
+    auto it = map_.find(key);
+    if (it != map_.end()) {
+      std::shared_ptr<const Resource> existing = it->second.lock();
+      if (existing != nullptr) return existing;
+      it->second = resource;
+      return resource;
+    }
+    // Entries for superseded versions of a resource are never looked up
+    // again, so sweep them out whenever the map has doubled in size.
+    if (map_.size() >= sweep_threshold_) {
+      for (it = map_.begin(); it != map_.end();) {
+        if (it->second.expired()) {
+          it = map_.erase(it);
+        } else {
+          ++it;
+        }
+      }
+      sweep_threshold_ = GPR_MAX(kMinSweepThreshold, 2 * map_.size());
+    }
+    map_.emplace(std::move(key), resource);
+    return resource;
+  }
+
+ private:
+  static constexpr size_t kMinSweepThreshold = 64;
+
+  Mutex mu_;
+  std::map<std::string /*key*/, std::weak_ptr<const Resource>> map_;
+  size_t sweep_threshold_ = kMinSweepThreshold;
+};
+
+constexpr size_t EdsResourceCache::kMinSweepThreshold;
+
 grpc_error* EdsResponseParse(
     XdsClient* client, TraceFlag* tracer,
     const envoy_api_v2_DiscoveryResponse* response,
@@ -1486,15 +1565,14 @@ grpc_error* EdsResponseParse(
   const google_protobuf_Any* const* resources =
       envoy_api_v2_DiscoveryResponse_resources(response, &size);
   for (size_t i = 0; i < size; ++i) {
-    XdsApi::EdsUpdate eds_update;
     // Check the type_url of the resource.
     upb_strview type_url = google_protobuf_Any_type_url(resources[i]);
     if (!upb_strview_eql(type_url, upb_strview_makez(XdsApi::kEdsTypeUrl))) {
       return GRPC_ERROR_CREATE_FROM_STATIC_STRING("Resource is not EDS.");
     }
-    // Get the cluster_load_assignment.
     upb_strview encoded_cluster_load_assignment =
         google_protobuf_Any_value(resources[i]);
+    // Get the cluster_load_assignment.
     envoy_api_v2_ClusterLoadAssignment* cluster_load_assignment =
         envoy_api_v2_ClusterLoadAssignment_parse(
             encoded_cluster_load_assignment.data,
@@ -1514,6 +1592,25 @@ grpc_error* EdsResponseParse(
         expected_eds_service_names.end()) {
       continue;
     }
+    // If some other channel has already parsed this exact resource, share
+    // its result.
+    std::string cache_key = EdsResourceCache::Key(
+        cluster_name_strview,
+        absl::string_view(encoded_cluster_load_assignment.data,
+                          encoded_cluster_load_assignment.size));
+    std::shared_ptr<const EdsResourceCache::Resource> resource =
+        EdsResourceCache::Get()->Lookup(cache_key);
+    if (resource != nullptr) {
+      if (GRPC_TRACE_FLAG_ENABLED(*tracer)) {
+        gpr_log(GPR_INFO, "[xds_client %p] EDS resource %s: cache hit", client,
+                resource->eds_service_name.c_str());
+      }
+      eds_update_map->emplace(resource->eds_service_name,
+                              std::shared_ptr<const XdsApi::EdsUpdate>(
+                                  resource, &resource->update));
+      continue;
+    }
+    XdsApi::EdsUpdate eds_update;
     // Get the endpoints.
     size_t locality_size;
     const envoy_api_v2_endpoint_LocalityLbEndpoints* const* endpoints =
@@ -1551,8 +1648,16 @@ grpc_error* EdsResponseParse(
         if (error != GRPC_ERROR_NONE) return error;
       }
     }
-    eds_update_map->emplace(UpbStringToStdString(cluster_name),
-                            std::move(eds_update));
+    // Allocated separately from its control block, so that an expired cache
+    // entry does not pin the memory of the resource itself.
+    resource = EdsResourceCache::Get()->Insert(
+        std::move(cache_key),
+        std::shared_ptr<const EdsResourceCache::Resource>(
+            new EdsResourceCache::Resource{UpbStringToStdString(cluster_name),
+                                           std::move(eds_update)}));
+    eds_update_map->emplace(resource->eds_service_name,
+                            std::shared_ptr<const XdsApi::EdsUpdate>(
+                                resource, &resource->update));
   }
   return GRPC_ERROR_NONE;
 }
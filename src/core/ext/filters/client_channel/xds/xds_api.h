@@ -23,6 +23,8 @@
 
 #include <stdint.h>
 
+#include <map>
+#include <memory>
 #include <set>
 
 #include "absl/container/inlined_vector.h"
@@ -215,7 +217,12 @@ class XdsApi {
     RefCountedPtr<DropConfig> drop_config;
   };
 
-  using EdsUpdateMap = std::map<std::string /*eds_service_name*/, EdsUpdate>;
+  // Parsed EDS updates are immutable.  Every XdsClient in the process that
+  // receives a given resource (i.e., the same serialized bytes) gets the
+  // same EdsUpdate instance, so the resource is parsed and stored only once
+  // no matter how many channels watch it.
+  using EdsUpdateMap = std::map<std::string /*eds_service_name*/,
+                                std::shared_ptr<const EdsUpdate>>;
 
   struct ClusterLoadReport {
     XdsClusterDropStats::DroppedRequestsMap dropped_requests;
@@ -1071,7 +1071,7 @@ void XdsClient::ChannelState::AdsCallState::AcceptEdsUpdate(
   auto& eds_state = state_map_[XdsApi::kEdsTypeUrl];
   for (auto& p : eds_update_map) {
     const char* eds_service_name = p.first.c_str();
-    XdsApi::EdsUpdate& eds_update = p.second;
+    const XdsApi::EdsUpdate& eds_update = *p.second;
     auto& state = eds_state.subscribed_resources[eds_service_name];
     if (state != nullptr) state->Finish();
     if (GRPC_TRACE_FLAG_ENABLED(grpc_xds_client_trace)) {
@@ -1123,15 +1123,18 @@ void XdsClient::ChannelState::AdsCallState::AcceptEdsUpdate(
     }
     EndpointState& endpoint_state =
         xds_client()->endpoint_map_[eds_service_name];
-    // Ignore identical update.
-    if (endpoint_state.update.has_value()) {
-      const XdsApi::EdsUpdate& prev_update = endpoint_state.update.value();
-      const bool priority_list_changed =
-          prev_update.priority_list_update != eds_update.priority_list_update;
-      const bool drop_config_changed =
-          prev_update.drop_config == nullptr ||
-          *prev_update.drop_config != *eds_update.drop_config;
-      if (!priority_list_changed && !drop_config_changed) {
+    // Ignore identical update.  Resources that are byte-for-byte the same
+    // are parsed into the same shared instance, so most repeats are caught by
+    // the pointer comparison.
+    if (endpoint_state.update != nullptr) {
+      const XdsApi::EdsUpdate& prev_update = *endpoint_state.update;
+      const bool changed =
+          endpoint_state.update != p.second &&
+          (prev_update.priority_list_update !=
+               eds_update.priority_list_update ||
+           prev_update.drop_config == nullptr ||
+           *prev_update.drop_config != *eds_update.drop_config);
+      if (!changed) {
         if (GRPC_TRACE_FLAG_ENABLED(grpc_xds_client_trace)) {
           gpr_log(GPR_INFO,
                   "[xds_client %p] EDS update identical to current, ignoring.",
@@ -1141,10 +1144,10 @@ void XdsClient::ChannelState::AdsCallState::AcceptEdsUpdate(
       }
     }
     // Update the cluster state.
-    endpoint_state.update = std::move(eds_update);
+    endpoint_state.update = std::move(p.second);
     // Notify all watchers.
     for (const auto& p : endpoint_state.watchers) {
-      p.first->OnEndpointChanged(endpoint_state.update.value());
+      p.first->OnEndpointChanged(endpoint_state.update);
     }
   }
 }
@@ -1887,12 +1890,12 @@ void XdsClient::WatchEndpointData(
   endpoint_state.watchers[w] = std::move(watcher);
   // If we've already received an EDS update, notify the new watcher
   // immediately.
-  if (endpoint_state.update.has_value()) {
+  if (endpoint_state.update != nullptr) {
     if (GRPC_TRACE_FLAG_ENABLED(grpc_xds_client_trace)) {
       gpr_log(GPR_INFO, "[xds_client %p] returning cached endpoint data for %s",
               this, eds_service_name_str.c_str());
     }
-    w->OnEndpointChanged(endpoint_state.update.value());
+    w->OnEndpointChanged(endpoint_state.update);
   }
   chand_->Subscribe(XdsApi::kEdsTypeUrl, eds_service_name_str);
 }
@@ -19,6 +19,7 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <memory>
 #include <set>
 
 #include "absl/strings/string_view.h"
@@ -71,7 +72,10 @@ class XdsClient : public InternallyRefCounted<XdsClient> {
    public:
     virtual ~EndpointWatcherInterface() = default;
 
-    virtual void OnEndpointChanged(XdsApi::EdsUpdate update) = 0;
+    // The update is shared with every other watcher of the same resource
+    // and must not be modified.
+    virtual void OnEndpointChanged(
+        std::shared_ptr<const XdsApi::EdsUpdate> update) = 0;
 
     virtual void OnError(grpc_error* error) = 0;
 
@@ -214,7 +218,7 @@ class XdsClient : public InternallyRefCounted<XdsClient> {
              std::unique_ptr<EndpointWatcherInterface>>
         watchers;
     // The latest data seen from EDS.
-    absl::optional<XdsApi::EdsUpdate> update;
+    std::shared_ptr<const XdsApi::EdsUpdate> update;
   };
 
   struct LoadReportState {
@@ -23,6 +23,7 @@
 
 #include <map>
 
+#include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
 
 #include <grpc/support/string_util.h>
@@ -56,7 +57,12 @@ class XdsLocalityName : public RefCounted<XdsLocalityName> {
   XdsLocalityName(std::string region, std::string zone, std::string subzone)
       : region_(std::move(region)),
         zone_(std::move(zone)),
-        sub_zone_(std::move(subzone)) {}
+        sub_zone_(std::move(subzone)),
+        // Built eagerly, since names are shared by every channel that
+        // receives the same EDS resource and may be read concurrently.
+        human_readable_string_(
+            absl::StrCat("{region=\"", region_, "\", zone=\"", zone_,
+                         "\", sub_zone=\"", sub_zone_, "\"}")) {}
 
   bool operator==(const XdsLocalityName& other) const {
     return region_ == other.region_ && zone_ == other.zone_ &&
@@ -79,21 +85,15 @@ class XdsLocalityName : public RefCounted<XdsLocalityName> {
   const std::string& zone() const { return zone_; }
   const std::string& sub_zone() const { return sub_zone_; }
 
-  const char* AsHumanReadableString() {
-    if (human_readable_string_ == nullptr) {
-      char* tmp;
-      gpr_asprintf(&tmp, "{region=\"%s\", zone=\"%s\", sub_zone=\"%s\"}",
-                   region_.c_str(), zone_.c_str(), sub_zone_.c_str());
-      human_readable_string_.reset(tmp);
-    }
-    return human_readable_string_.get();
+  const char* AsHumanReadableString() const {
+    return human_readable_string_.c_str();
   }
 
  private:
   std::string region_;
   std::string zone_;
   std::string sub_zone_;
-  UniquePtr<char> human_readable_string_;
+  const std::string human_readable_string_;
 };
 
 // Drop stats for an xds cluster.
@@ -31,6 +31,7 @@
 #include <grpc/support/string_util.h>
 #include <grpc/support/sync.h>
 
+#include "absl/strings/str_cat.h"
 #include "absl/strings/str_format.h"
 
 #include "src/core/ext/filters/http/server/http_server_filter.h"
@@ -40,6 +41,7 @@
 #include "src/core/lib/channel/handshaker.h"
 #include "src/core/lib/channel/handshaker_registry.h"
 #include "src/core/lib/iomgr/endpoint.h"
+#include "src/core/lib/iomgr/endpoint_shm.h"
 #include "src/core/lib/iomgr/resolve_address.h"
 #include "src/core/lib/iomgr/resource_quota.h"
 #include "src/core/lib/iomgr/tcp_server.h"
@@ -348,6 +350,7 @@ grpc_error* grpc_chttp2_server_add_port(grpc_server* server, const char* addr,
   grpc_error** errors = nullptr;
   size_t naddrs = 0;
   const grpc_arg* arg = nullptr;
+  std::string unix_addr;
 
   *port_num = -1;
 
@@ -355,6 +358,21 @@ grpc_error* grpc_chttp2_server_add_port(grpc_server* server, const char* addr,
     return chttp2_server_add_acceptor(server, addr, args);
   }
 
+#ifdef GRPC_HAVE_SHM_ENDPOINT
+  if (strncmp(addr, "shm:", 4) == 0) {
+    /* listen on the Unix domain socket, and have the handshaker move each
+       accepted connection onto shared memory */
+    unix_addr = absl::StrCat("unix:", addr + 4);
+    addr = unix_addr.c_str();
+    grpc_arg shm_arg = grpc_channel_arg_integer_create(
+        const_cast<char*>(GRPC_ARG_UNIX_SOCKET_SHARED_MEMORY), 1);
+    grpc_channel_args* new_args =
+        grpc_channel_args_copy_and_add(args, &shm_arg, 1);
+    grpc_channel_args_destroy(args);
+    args = new_args;
+  }
+#endif
+
   /* resolve address */
   err = grpc_blocking_resolve_address(addr, "https", &resolved);
   if (err != GRPC_ERROR_NONE) {
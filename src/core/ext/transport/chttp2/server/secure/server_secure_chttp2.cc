@@ -54,7 +54,7 @@ int grpc_server_add_secure_http2_port(grpc_server* server, const char* addr,
         "No credentials specified for secure server port (creds==NULL)");
     goto done;
   }
-  sc = creds->create_security_connector();
+  sc = creds->create_security_connector(grpc_server_get_channel_args(server));
   if (sc == nullptr) {
     char* msg;
     gpr_asprintf(&msg,
@@ -320,6 +320,22 @@ static bool read_channel_args(grpc_chttp2_transport* t,
                            GRPC_ARG_KEEPALIVE_PERMIT_WITHOUT_CALLS)) {
       t->keepalive_permit_without_calls = static_cast<uint32_t>(
           grpc_channel_arg_get_integer(&channel_args->args[i], {0, 0, 1}));
+    } else if (0 == strcmp(channel_args->args[i].key,
+                           GRPC_ARG_HTTP2_WRITE_LATENCY_SAMPLE_ONE_IN)) {
+      t->write_latency_sample_one_in = static_cast<uint32_t>(
+          grpc_channel_arg_get_integer(&channel_args->args[i],
+                                       {0, 0, INT_MAX}));
+      // Sampled writes reach the ContextList through the process-wide TCP
+      // timestamps callback, so install it now unless something else owns it.
+      if (t->write_latency_sample_one_in != 0 &&
+          !grpc_core::grpc_tcp_set_write_timestamps_callback_if_unset(
+              grpc_core::ContextList::Execute)) {
+        gpr_log(GPR_ERROR,
+                "%s: TCP write timestamps are unavailable; ignoring %s",
+                t->peer_string,
+                GRPC_ARG_HTTP2_WRITE_LATENCY_SAMPLE_ONE_IN);
+        t->write_latency_sample_one_in = 0;
+      }
     } else if (0 == strcmp(channel_args->args[i].key,
                            GRPC_ARG_OPTIMIZATION_TARGET)) {
       gpr_log(GPR_INFO, "GRPC_ARG_OPTIMIZATION_TARGET is deprecated");
@@ -1354,6 +1370,18 @@ static void perform_stream_op_locked(void* stream_op,
 
   s->context = op->payload->context;
   s->traced = op->is_traced;
+  if (op->send_initial_metadata && t->write_latency_sample_one_in != 0 &&
+      ++t->write_latency_sample_counter >= t->write_latency_sample_one_in) {
+    t->write_latency_sample_counter = 0;
+    s->write_latency_sampled = true;
+  }
+  if (s->write_latency_sampled &&
+      (op->send_initial_metadata || op->send_message ||
+       op->send_trailing_metadata) &&
+      gpr_time_cmp(s->write_latency_enqueue_time,
+                   gpr_inf_past(GPR_CLOCK_REALTIME)) == 0) {
+    s->write_latency_enqueue_time = gpr_now(GPR_CLOCK_REALTIME);
+  }
   if (GRPC_TRACE_FLAG_ENABLED(grpc_http_trace)) {
     gpr_log(GPR_INFO, "perform_stream_op_locked: %s; on_complete = %p",
             grpc_transport_stream_op_batch_string(op).c_str(), op->on_complete);
@@ -20,6 +20,8 @@
 
 #include "src/core/ext/transport/chttp2/transport/context_list.h"
 
+#include "src/core/lib/debug/stats.h"
+
 namespace {
 void (*write_timestamps_callback_g)(void*, grpc_core::Timestamps*,
                                     grpc_error* error) = nullptr;
@@ -28,29 +30,77 @@ void* (*get_copied_context_fn_g)(void*) = nullptr;
 
 namespace grpc_core {
 void ContextList::Append(ContextList** head, grpc_chttp2_stream* s) {
-  if (get_copied_context_fn_g == nullptr ||
-      write_timestamps_callback_g == nullptr) {
+  const bool traced = s->traced && get_copied_context_fn_g != nullptr &&
+                      write_timestamps_callback_g != nullptr;
+  /* Only writes carrying a send op have a meaningful queueing delay */
+  const bool sampled =
+      s->write_latency_sampled &&
+      gpr_time_cmp(s->write_latency_enqueue_time,
+                   gpr_inf_past(GPR_CLOCK_REALTIME)) != 0;
+  if (!traced && !sampled) {
     return;
   }
   /* Create a new element in the list and add it at the front */
   ContextList* elem = new ContextList();
-  elem->trace_context_ = get_copied_context_fn_g(s->context);
+  if (traced) {
+    elem->traced_ = true;
+    elem->trace_context_ = get_copied_context_fn_g(s->context);
+  }
+  if (sampled) {
+    elem->sampled_ = true;
+    elem->enqueue_time_ = s->write_latency_enqueue_time;
+    elem->socket_node_ = s->t->channelz_socket;
+    s->write_latency_enqueue_time = gpr_inf_past(GPR_CLOCK_REALTIME);
+  }
   elem->byte_offset_ = s->byte_counter;
   elem->next_ = *head;
   *head = elem;
 }
 
+namespace {
+/* Returns the number of microseconds from \a start to \a end, or -1 if either
+ * was not recorded. */
+int64_t MicrosBetween(gpr_timespec start, gpr_timespec end) {
+  if (gpr_time_cmp(start, gpr_inf_past(GPR_CLOCK_REALTIME)) == 0 ||
+      gpr_time_cmp(end, gpr_inf_past(GPR_CLOCK_REALTIME)) == 0) {
+    return -1;
+  }
+  gpr_timespec elapsed = gpr_time_sub(end, start);
+  int64_t micros =
+      elapsed.tv_sec * GPR_US_PER_SEC + elapsed.tv_nsec / GPR_NS_PER_US;
+  return GPR_MAX(micros, 0);
+}
+}  // namespace
+
+void ContextList::RecordWriteLatency(const grpc_core::Timestamps& ts) {
+  int64_t queued_us = MicrosBetween(enqueue_time_, ts.sendmsg_time.time);
+  int64_t kernel_us = MicrosBetween(ts.sendmsg_time.time, ts.sent_time.time);
+  int64_t wire_us = MicrosBetween(ts.sent_time.time, ts.acked_time.time);
+  if (queued_us < 0 || kernel_us < 0 || wire_us < 0) {
+    return;
+  }
+  GRPC_STATS_INC_HTTP2_WRITE_QUEUED_LATENCY(queued_us);
+  GRPC_STATS_INC_HTTP2_WRITE_KERNEL_LATENCY(kernel_us);
+  GRPC_STATS_INC_HTTP2_WRITE_WIRE_LATENCY(wire_us);
+  if (socket_node_ != nullptr) {
+    socket_node_->RecordWriteLatency(queued_us, kernel_us, wire_us);
+  }
+}
+
 void ContextList::Execute(void* arg, grpc_core::Timestamps* ts,
                           grpc_error* error) {
   ContextList* head = static_cast<ContextList*>(arg);
   ContextList* to_be_freed;
   while (head != nullptr) {
-    if (write_timestamps_callback_g) {
+    if (head->traced_ && write_timestamps_callback_g) {
       if (ts) {
         ts->byte_offset = static_cast<uint32_t>(head->byte_offset_);
       }
       write_timestamps_callback_g(head->trace_context_, ts, error);
     }
+    if (head->sampled_ && ts != nullptr && error == GRPC_ERROR_NONE) {
+      head->RecordWriteLatency(*ts);
+    }
     to_be_freed = head;
     head = head->next_;
     delete to_be_freed;
@@ -33,15 +33,22 @@ class ContextList {
    * list. */
   static void Append(ContextList** head, grpc_chttp2_stream* s);
 
-  /* Executes a function \a fn with each context in the list and \a ts. It also
-   * frees up the entire list after this operation. It is intended as a callback
-   * and hence does not take a ref on \a error */
+  /* Executes a function \a fn with each context in the list and \a ts, and
+   * records the write latency breakdown of sampled streams. It also frees up
+   * the entire list after this operation. It is intended as a callback and
+   * hence does not take a ref on \a error */
   static void Execute(void* arg, grpc_core::Timestamps* ts, grpc_error* error);
 
  private:
+  void RecordWriteLatency(const grpc_core::Timestamps& ts);
+
   void* trace_context_ = nullptr;
   ContextList* next_ = nullptr;
   size_t byte_offset_ = 0;
+  bool traced_ = false;
+  bool sampled_ = false;
+  gpr_timespec enqueue_time_;
+  RefCountedPtr<channelz::SocketNode> socket_node_;
 };
 
 void grpc_http2_set_write_timestamps_callback(void (*fn)(void*,
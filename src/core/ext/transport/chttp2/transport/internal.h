@@ -481,6 +481,10 @@ struct grpc_chttp2_transport {
   /** keep-alive state machine state */
   grpc_chttp2_keepalive_state keepalive_state;
   grpc_core::ContextList* cl = nullptr;
+  /** sample the write latency of one in this many streams (0 disables) */
+  uint32_t write_latency_sample_one_in = 0;
+  /** streams started since the last write latency sample */
+  uint32_t write_latency_sample_counter = 0;
   grpc_core::RefCountedPtr<grpc_core::channelz::SocketNode> channelz_socket;
   uint32_t num_messages_in_next_write = 0;
   /** The number of pending induced frames (SETTINGS_ACK, PINGS_ACK and
@@ -642,6 +646,12 @@ struct grpc_chttp2_stream {
   bool unprocessed_incoming_frames_decompressed = false;
   /** Whether the bytes needs to be traced using Fathom */
   bool traced = false;
+  /** Whether the write latency breakdown of this stream is sampled */
+  bool write_latency_sampled = false;
+  /** When the oldest send op not yet handed to the endpoint reached the
+   * transport, or gpr_inf_past if there is none */
+  gpr_timespec write_latency_enqueue_time =
+      gpr_inf_past(GPR_CLOCK_REALTIME);
   /** gRPC header bytes that are already decompressed */
   size_t decompressed_header_bytes = 0;
   /** Byte counter for number of bytes written */
@@ -0,0 +1,395 @@
+/*
+ *
+ * Copyright 2020 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/ext/transport/chttp2/transport/shm_handshaker.h"
+
+#include "src/core/lib/iomgr/endpoint_shm.h"
+
+#ifdef GRPC_HAVE_SHM_ENDPOINT
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <string>
+
+#include "absl/strings/match.h"
+
+#include <grpc/support/alloc.h>
+#include <grpc/support/log.h>
+
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/channel/handshaker.h"
+#include "src/core/lib/channel/handshaker_registry.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/iomgr/tcp_posix.h"
+#include "src/core/lib/slice/slice_internal.h"
+
+namespace grpc_core {
+
+namespace {
+
+// The only message ever sent on the socket: the server tells the client the
+// ring size, and passes the region and the two doorbells alongside.
+struct ShmHello {
+  char magic[8];
+  uint32_t ring_size;
+  uint32_t reserved;
+};
+
+constexpr char kShmHelloMagic[8] = {'G', 'R', 'P', 'C', 'S', 'H', 'M', '1'};
+constexpr size_t kShmHelloFds = 3;
+
+class ShmHandshaker : public Handshaker {
+ public:
+  ShmHandshaker(bool is_client, grpc_pollset_set* interested_parties)
+      : is_client_(is_client), interested_parties_(interested_parties) {}
+  void Shutdown(grpc_error* why) override;
+  void DoHandshake(grpc_tcp_server_acceptor* acceptor,
+                   grpc_closure* on_handshake_done,
+                   HandshakerArgs* args) override;
+  const char* name() const override { return "shm"; }
+
+ private:
+  static void OnFdReleased(void* arg, grpc_error* error);
+  static void OnSocketReadable(void* arg, grpc_error* error);
+  grpc_error* SendHelloLocked(grpc_shm_endpoint_fds* fds);
+  // Returns false if the hello has not arrived yet.
+  bool ReceiveHelloLocked(grpc_shm_endpoint_fds* fds, grpc_error** error);
+  void FinishLocked(grpc_shm_endpoint_fds* fds);
+  void HandshakeFailedLocked(grpc_error* error);
+
+  const bool is_client_;
+  grpc_pollset_set* const interested_parties_;
+
+  Mutex mu_;
+  bool is_shutdown_ = false;
+
+  // State saved while performing the handshake.
+  HandshakerArgs* args_ = nullptr;
+  grpc_closure* on_handshake_done_ = nullptr;
+  std::string peer_;
+  int fd_ = -1;
+  grpc_fd* socket_ = nullptr;
+  grpc_closure on_fd_released_;
+  grpc_closure on_socket_readable_;
+};
+
+void ShmHandshaker::Shutdown(grpc_error* why) {
+  {
+    MutexLock lock(&mu_);
+    if (!is_shutdown_) {
+      is_shutdown_ = true;
+      // Any pending step notices is_shutdown_ when it runs; only the wait
+      // for the hello needs to be cut short.
+      if (socket_ != nullptr) {
+        grpc_fd_shutdown(socket_, GRPC_ERROR_REF(why));
+      }
+    }
+  }
+  GRPC_ERROR_UNREF(why);
+}
+
+void ShmHandshaker::DoHandshake(grpc_tcp_server_acceptor* /*acceptor*/,
+                                grpc_closure* on_handshake_done,
+                                HandshakerArgs* args) {
+  // Only plain Unix domain socket connections can be moved.  Anything that
+  // has already been read from the socket would be lost.
+  char* peer = grpc_endpoint_get_peer(args->endpoint);
+  const bool applicable = absl::StartsWith(peer, "unix:") &&
+                          grpc_endpoint_get_fd(args->endpoint) >= 0 &&
+                          args->read_buffer->length == 0;
+  MutexLock lock(&mu_);
+  if (!applicable) {
+    gpr_free(peer);
+    is_shutdown_ = true;
+    ExecCtx::Run(DEBUG_LOCATION, on_handshake_done, GRPC_ERROR_NONE);
+    return;
+  }
+  args_ = args;
+  on_handshake_done_ = on_handshake_done;
+  peer_ = peer;
+  gpr_free(peer);
+  // Take the socket back from the TCP endpoint.  The callback holds a ref.
+  Ref().release();
+  grpc_endpoint* endpoint = args->endpoint;
+  args->endpoint = nullptr;
+  grpc_tcp_destroy_and_release_fd(
+      endpoint, &fd_,
+      GRPC_CLOSURE_INIT(&on_fd_released_, &ShmHandshaker::OnFdReleased, this,
+                        grpc_schedule_on_exec_ctx));
+}
+
+void ShmHandshaker::OnFdReleased(void* arg, grpc_error* error) {
+  auto* handshaker = static_cast<ShmHandshaker*>(arg);
+  ReleasableMutexLock lock(&handshaker->mu_);
+  if (error != GRPC_ERROR_NONE || handshaker->is_shutdown_) {
+    handshaker->HandshakeFailedLocked(GRPC_ERROR_REF(error));
+    lock.Unlock();
+    handshaker->Unref();
+    return;
+  }
+  std::string name = "shm_handshaker:" + handshaker->peer_;
+  handshaker->socket_ = grpc_fd_create(handshaker->fd_, name.c_str(), false);
+  handshaker->fd_ = -1;
+  grpc_shm_endpoint_fds fds;
+  if (handshaker->is_client_) {
+    // Wait for the server's hello.  The callback inherits our ref.
+    grpc_pollset_set_add_fd(handshaker->interested_parties_,
+                            handshaker->socket_);
+    grpc_fd_notify_on_read(
+        handshaker->socket_,
+        GRPC_CLOSURE_INIT(&handshaker->on_socket_readable_,
+                          &ShmHandshaker::OnSocketReadable, handshaker,
+                          grpc_schedule_on_exec_ctx));
+    return;
+  }
+  error = grpc_shm_endpoint_fds_create(GRPC_SHM_ENDPOINT_DEFAULT_RING_SIZE,
+                                       &fds);
+  if (error == GRPC_ERROR_NONE) {
+    error = handshaker->SendHelloLocked(&fds);
+  }
+  if (error != GRPC_ERROR_NONE) {
+    grpc_shm_endpoint_fds_close(&fds);
+    handshaker->HandshakeFailedLocked(error);
+  } else {
+    handshaker->FinishLocked(&fds);
+  }
+  lock.Unlock();
+  handshaker->Unref();
+}
+
+void ShmHandshaker::OnSocketReadable(void* arg, grpc_error* error) {
+  auto* handshaker = static_cast<ShmHandshaker*>(arg);
+  ReleasableMutexLock lock(&handshaker->mu_);
+  if (error != GRPC_ERROR_NONE || handshaker->is_shutdown_) {
+    handshaker->HandshakeFailedLocked(GRPC_ERROR_REF(error));
+    lock.Unlock();
+    handshaker->Unref();
+    return;
+  }
+  grpc_shm_endpoint_fds fds;
+  if (!handshaker->ReceiveHelloLocked(&fds, &error)) {
+    grpc_fd_notify_on_read(handshaker->socket_,
+                           &handshaker->on_socket_readable_);
+    return;
+  }
+  if (error != GRPC_ERROR_NONE) {
+    handshaker->HandshakeFailedLocked(error);
+  } else {
+    handshaker->FinishLocked(&fds);
+  }
+  lock.Unlock();
+  handshaker->Unref();
+}
+
+grpc_error* ShmHandshaker::SendHelloLocked(grpc_shm_endpoint_fds* fds) {
+  ShmHello hello;
+  memcpy(hello.magic, kShmHelloMagic, sizeof(hello.magic));
+  hello.ring_size = static_cast<uint32_t>(fds->ring_size);
+  hello.reserved = 0;
+  struct iovec iov;
+  iov.iov_base = &hello;
+  iov.iov_len = sizeof(hello);
+  union {
+    char buf[CMSG_SPACE(kShmHelloFds * sizeof(int))];
+    struct cmsghdr align;
+  } control;
+  memset(&control, 0, sizeof(control));
+  struct msghdr msg;
+  memset(&msg, 0, sizeof(msg));
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = control.buf;
+  msg.msg_controllen = sizeof(control.buf);
+  struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+  cmsg->cmsg_level = SOL_SOCKET;
+  cmsg->cmsg_type = SCM_RIGHTS;
+  cmsg->cmsg_len = CMSG_LEN(kShmHelloFds * sizeof(int));
+  const int fd_list[kShmHelloFds] = {fds->memfd, fds->client_doorbell,
+                                     fds->server_doorbell};
+  memcpy(CMSG_DATA(cmsg), fd_list, sizeof(fd_list));
+  ssize_t sent;
+  do {
+    sent = sendmsg(grpc_fd_wrapped_fd(socket_), &msg, MSG_NOSIGNAL);
+  } while (sent < 0 && errno == EINTR);
+  // The socket is fresh, so the few bytes of the hello always fit.
+  if (sent < 0) return GRPC_OS_ERROR(errno, "sendmsg");
+  if (static_cast<size_t>(sent) != sizeof(hello)) {
+    return GRPC_ERROR_CREATE_FROM_STATIC_STRING("Short write of shm hello");
+  }
+  return GRPC_ERROR_NONE;
+}
+
+bool ShmHandshaker::ReceiveHelloLocked(grpc_shm_endpoint_fds* fds,
+                                       grpc_error** error) {
+  ShmHello hello;
+  struct iovec iov;
+  iov.iov_base = &hello;
+  iov.iov_len = sizeof(hello);
+  union {
+    char buf[CMSG_SPACE(kShmHelloFds * sizeof(int))];
+    struct cmsghdr align;
+  } control;
+  struct msghdr msg;
+  memset(&msg, 0, sizeof(msg));
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = control.buf;
+  msg.msg_controllen = sizeof(control.buf);
+  ssize_t received;
+  do {
+    received = recvmsg(grpc_fd_wrapped_fd(socket_), &msg, MSG_CMSG_CLOEXEC);
+  } while (received < 0 && errno == EINTR);
+  if (received < 0 && errno == EAGAIN) return false;
+  // Take ownership of whatever descriptors arrived before validating.
+  for (struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr;
+       cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+    if (cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS) {
+      continue;
+    }
+    const size_t count = (cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+    int fd_list[kShmHelloFds + 1];
+    for (size_t i = 0; i < count; ++i) {
+      int fd;
+      memcpy(&fd, CMSG_DATA(cmsg) + i * sizeof(int), sizeof(fd));
+      if (i < GPR_ARRAY_SIZE(fd_list)) fd_list[i] = fd;
+      if (count != kShmHelloFds || fds->memfd >= 0) close(fd);
+    }
+    if (count == kShmHelloFds && fds->memfd < 0) {
+      fds->memfd = fd_list[0];
+      fds->client_doorbell = fd_list[1];
+      fds->server_doorbell = fd_list[2];
+    }
+  }
+  if (received < 0) {
+    *error = GRPC_OS_ERROR(errno, "recvmsg");
+  } else if (received == 0) {
+    *error = GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+        "Socket closed during shm handshake");
+  } else if (static_cast<size_t>(received) != sizeof(hello) ||
+             memcmp(hello.magic, kShmHelloMagic, sizeof(hello.magic)) != 0 ||
+             (msg.msg_flags & MSG_CTRUNC) != 0 || fds->memfd < 0) {
+    *error = GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+        "Invalid shm hello; is GRPC_ARG_UNIX_SOCKET_SHARED_MEMORY set on the "
+        "server?");
+  } else {
+    // Without these seals the peer could resize the region after we map it.
+    const int seals = fcntl(fds->memfd, F_GET_SEALS);
+    if (seals < 0) {
+      *error = GRPC_OS_ERROR(errno, "fcntl(F_GET_SEALS)");
+    } else if ((seals & GRPC_SHM_ENDPOINT_REQUIRED_SEALS) !=
+               GRPC_SHM_ENDPOINT_REQUIRED_SEALS) {
+      *error = GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+          "shm region is not sealed against resizing");
+    } else {
+      fds->ring_size = hello.ring_size;
+    }
+  }
+  if (*error != GRPC_ERROR_NONE) grpc_shm_endpoint_fds_close(fds);
+  return true;
+}
+
+void ShmHandshaker::FinishLocked(grpc_shm_endpoint_fds* fds) {
+  // The endpoint takes over the socket, and the transport will add it to
+  // its own pollsets.
+  grpc_fd* socket = socket_;
+  socket_ = nullptr;
+  if (is_client_) grpc_pollset_set_del_fd(interested_parties_, socket);
+  grpc_endpoint* endpoint = nullptr;
+  grpc_error* error =
+      grpc_shm_endpoint_create(fds, is_client_, socket, args_->args,
+                               peer_.c_str(), &endpoint);
+  if (error != GRPC_ERROR_NONE) {
+    HandshakeFailedLocked(error);
+    return;
+  }
+  args_->endpoint = endpoint;
+  is_shutdown_ = true;
+  ExecCtx::Run(DEBUG_LOCATION, on_handshake_done_, GRPC_ERROR_NONE);
+}
+
+// The TCP endpoint is already gone by the time anything can fail, so clean
+// up the remaining args and the socket before invoking the callback.
+void ShmHandshaker::HandshakeFailedLocked(grpc_error* error) {
+  if (error == GRPC_ERROR_NONE) {
+    error = GRPC_ERROR_CREATE_FROM_STATIC_STRING("Handshaker shutdown");
+  }
+  if (socket_ != nullptr) {
+    if (is_client_) grpc_pollset_set_del_fd(interested_parties_, socket_);
+    grpc_fd_orphan(socket_, nullptr, nullptr, "shm_handshake_failed");
+    socket_ = nullptr;
+  } else if (fd_ >= 0) {
+    close(fd_);
+    fd_ = -1;
+  }
+  grpc_channel_args_destroy(args_->args);
+  args_->args = nullptr;
+  grpc_slice_buffer_destroy_internal(args_->read_buffer);
+  gpr_free(args_->read_buffer);
+  args_->read_buffer = nullptr;
+  is_shutdown_ = true;
+  ExecCtx::Run(DEBUG_LOCATION, on_handshake_done_, error);
+}
+
+//
+// handshaker factory
+//
+
+class ShmHandshakerFactory : public HandshakerFactory {
+ public:
+  explicit ShmHandshakerFactory(bool is_client) : is_client_(is_client) {}
+  void AddHandshakers(const grpc_channel_args* args,
+                      grpc_pollset_set* interested_parties,
+                      HandshakeManager* handshake_mgr) override {
+    if (grpc_channel_args_find_bool(args, GRPC_ARG_UNIX_SOCKET_SHARED_MEMORY,
+                                    false)) {
+      handshake_mgr->Add(
+          MakeRefCounted<ShmHandshaker>(is_client_, interested_parties));
+    }
+  }
+  ~ShmHandshakerFactory() override = default;
+
+ private:
+  const bool is_client_;
+};
+
+}  // namespace
+
+}  // namespace grpc_core
+
+void grpc_shm_register_handshaker_factory() {
+  using namespace grpc_core;
+  // Runs before any security handshaker, which then works over the rings.
+  HandshakerRegistry::RegisterHandshakerFactory(
+      true /* at_start */, HANDSHAKER_CLIENT,
+      absl::make_unique<ShmHandshakerFactory>(true /* is_client */));
+  HandshakerRegistry::RegisterHandshakerFactory(
+      true /* at_start */, HANDSHAKER_SERVER,
+      absl::make_unique<ShmHandshakerFactory>(false /* is_client */));
+}
+
+#else /* GRPC_HAVE_SHM_ENDPOINT */
+
+void grpc_shm_register_handshaker_factory() {}
+
+#endif /* GRPC_HAVE_SHM_ENDPOINT */
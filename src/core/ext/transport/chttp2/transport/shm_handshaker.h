@@ -0,0 +1,30 @@
+/*
+ *
+ * Copyright 2020 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef GRPC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_SHM_HANDSHAKER_H
+#define GRPC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_SHM_HANDSHAKER_H
+
+#include <grpc/support/port_platform.h>
+
+/// Registers the client and server handshakers that move Unix domain socket
+/// connections with GRPC_ARG_UNIX_SOCKET_SHARED_MEMORY set onto a
+/// shared-memory endpoint.  The server creates the rings and passes them to
+/// the client over the socket; HTTP/2 then runs over the rings.
+void grpc_shm_register_handshaker_factory();
+
+#endif /* GRPC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_SHM_HANDSHAKER_H */
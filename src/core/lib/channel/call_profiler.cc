@@ -0,0 +1,397 @@
+/*
+ *
+ * Copyright 2020 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/channel/call_profiler.h"
+
+#include <grpc/grpc.h>
+#include <grpc/support/cpu.h>
+#include <grpc/support/string_util.h>
+#include <grpc/support/sync.h>
+
+#include "src/core/lib/gprpp/arena.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/slice/slice_internal.h"
+#include "src/core/lib/slice/slice_utils.h"
+#include "src/core/lib/transport/metadata_batch.h"
+
+namespace grpc_core {
+
+//
+// CallProfileHistogram
+//
+
+namespace {
+
+int BucketForValue(uint64_t value) {
+  int bucket = 0;
+  while (value != 0 && bucket < CallProfileHistogram::kNumBuckets - 1) {
+    value >>= 1;
+    ++bucket;
+  }
+  return bucket;
+}
+
+uint64_t BucketUpperBound(int bucket) {
+  return bucket == 0 ? 0 : (uint64_t(1) << bucket) - 1;
+}
+
+}  // namespace
+
+void CallProfileHistogram::Add(uint64_t value) {
+  buckets_[BucketForValue(value)].FetchAdd(1, MemoryOrder::RELAXED);
+  sum_.FetchAdd(value, MemoryOrder::RELAXED);
+}
+
+void CallProfileHistogram::Merge(const CallProfileHistogram& other) {
+  for (int i = 0; i < kNumBuckets; ++i) {
+    buckets_[i].FetchAdd(other.buckets_[i].Load(MemoryOrder::RELAXED),
+                         MemoryOrder::RELAXED);
+  }
+  sum_.FetchAdd(other.Sum(), MemoryOrder::RELAXED);
+}
+
+uint64_t CallProfileHistogram::Count() const {
+  uint64_t count = 0;
+  for (int i = 0; i < kNumBuckets; ++i) {
+    count += buckets_[i].Load(MemoryOrder::RELAXED);
+  }
+  return count;
+}
+
+uint64_t CallProfileHistogram::Percentile(double percentile) const {
+  uint64_t counts[kNumBuckets];
+  uint64_t count = 0;
+  for (int i = 0; i < kNumBuckets; ++i) {
+    counts[i] = buckets_[i].Load(MemoryOrder::RELAXED);
+    count += counts[i];
+  }
+  if (count == 0) return 0;
+  const double threshold = count * percentile / 100.0;
+  uint64_t seen = 0;
+  for (int i = 0; i < kNumBuckets; ++i) {
+    seen += counts[i];
+    if (seen >= threshold && counts[i] != 0) return BucketUpperBound(i);
+  }
+  return BucketUpperBound(kNumBuckets - 1);
+}
+
+Json CallProfileHistogram::ToJson() const {
+  return Json::Object{
+      {"count", std::to_string(Count())},
+      {"sum", std::to_string(Sum())},
+      {"p50", std::to_string(Percentile(50))},
+      {"p90", std::to_string(Percentile(90))},
+      {"p99", std::to_string(Percentile(99))},
+  };
+}
+
+//
+// CallProfile
+//
+
+int64_t CallProfile::CyclesToNanos(gpr_cycle_counter start,
+                                   gpr_cycle_counter end) {
+  gpr_timespec elapsed = gpr_cycle_counter_sub(end, start);
+  int64_t nanos = elapsed.tv_sec * GPR_NS_PER_SEC + elapsed.tv_nsec;
+  return nanos < 0 ? 0 : nanos;
+}
+
+void CallProfile::BatchStarted() {
+  gpr_cycle_counter last_completion =
+      last_completion_.Exchange(0, MemoryOrder::RELAXED);
+  if (last_completion != 0) {
+    application_nanos_.FetchAdd(
+        CyclesToNanos(last_completion, gpr_get_cycle_counter()),
+        MemoryOrder::RELAXED);
+  }
+}
+
+//
+// CallProfiler
+//
+
+namespace {
+
+gpr_once g_profiler_once = GPR_ONCE_INIT;
+CallProfiler* g_profiler;
+
+}  // namespace
+
+void CallProfiler::MethodProfile::Merge(const MethodProfile& other) {
+  calls.FetchAdd(other.calls.Load(MemoryOrder::RELAXED), MemoryOrder::RELAXED);
+  arena_bytes.Merge(other.arena_bytes);
+  arena_allocations.Merge(other.arena_allocations);
+  latency_nanos.Merge(other.latency_nanos);
+  filter_nanos.Merge(other.filter_nanos);
+  transport_nanos.Merge(other.transport_nanos);
+  application_nanos.Merge(other.application_nanos);
+  bytes_sent.Merge(other.bytes_sent);
+  bytes_received.Merge(other.bytes_received);
+}
+
+CallProfiler::CallProfiler()
+    : num_shards_(GPR_MAX(1, gpr_cpu_num_cores())),
+      shards_(new Shard[num_shards_]) {}
+
+CallProfiler* CallProfiler::Default() {
+  // Never destroyed: calls may outlive grpc_shutdown().
+  gpr_once_init(&g_profiler_once, []() { g_profiler = new CallProfiler(); });
+  return g_profiler;
+}
+
+void CallProfiler::Record(const std::string& method, bool is_client,
+                          const CallRecord& record) {
+  CallProfiler* profiler = Default();
+  Shard& shard =
+      profiler->shards_[ExecCtx::Get()->starting_cpu() % profiler->num_shards_];
+  MethodProfile* profile;
+  {
+    MutexLock lock(&shard.mu);
+    std::unique_ptr<MethodProfile>& entry =
+        shard.methods[Key(method, is_client)];
+    if (entry == nullptr) entry.reset(new MethodProfile());
+    profile = entry.get();
+  }
+  profile->calls.FetchAdd(1, MemoryOrder::RELAXED);
+  profile->arena_bytes.Add(record.arena_bytes);
+  profile->arena_allocations.Add(record.arena_allocations);
+  profile->latency_nanos.Add(record.latency_nanos);
+  profile->filter_nanos.Add(record.filter_nanos);
+  profile->transport_nanos.Add(record.transport_nanos);
+  profile->application_nanos.Add(record.application_nanos);
+  profile->bytes_sent.Add(record.bytes_sent);
+  profile->bytes_received.Add(record.bytes_received);
+}
+
+std::map<CallProfiler::Key, std::unique_ptr<CallProfiler::MethodProfile>>
+CallProfiler::Snapshot() {
+  std::map<Key, std::unique_ptr<MethodProfile>> merged;
+  for (size_t i = 0; i < num_shards_; ++i) {
+    MutexLock lock(&shards_[i].mu);
+    for (const auto& p : shards_[i].methods) {
+      std::unique_ptr<MethodProfile>& profile = merged[p.first];
+      if (profile == nullptr) profile.reset(new MethodProfile());
+      profile->Merge(*p.second);
+    }
+  }
+  return merged;
+}
+
+std::unique_ptr<CallProfiler::MethodProfile> CallProfiler::Get(
+    const std::string& method, bool is_client) {
+  CallProfiler* profiler = Default();
+  const Key key(method, is_client);
+  std::unique_ptr<MethodProfile> merged;
+  for (size_t i = 0; i < profiler->num_shards_; ++i) {
+    MutexLock lock(&profiler->shards_[i].mu);
+    auto it = profiler->shards_[i].methods.find(key);
+    if (it == profiler->shards_[i].methods.end()) continue;
+    if (merged == nullptr) merged.reset(new MethodProfile());
+    merged->Merge(*it->second);
+  }
+  return merged;
+}
+
+Json CallProfiler::RenderJson() {
+  Json::Object json;
+  for (const auto& p : Default()->Snapshot()) {
+    const MethodProfile& profile = *p.second;
+    Json::Object profile_json = {
+        {"calls", std::to_string(profile.calls.Load(MemoryOrder::RELAXED))},
+        {"arenaBytes", profile.arena_bytes.ToJson()},
+        {"arenaAllocations", profile.arena_allocations.ToJson()},
+        {"latencyNanos", profile.latency_nanos.ToJson()},
+        {"filterNanos", profile.filter_nanos.ToJson()},
+        {"transportNanos", profile.transport_nanos.ToJson()},
+        {"applicationNanos", profile.application_nanos.ToJson()},
+        {"bytesSent", profile.bytes_sent.ToJson()},
+        {"bytesReceived", profile.bytes_received.ToJson()},
+    };
+    Json& method_json = json[p.first.first];
+    if (method_json.type() != Json::Type::OBJECT) method_json = Json::Object();
+    (*method_json.mutable_object())[p.first.second ? "client" : "server"] =
+        std::move(profile_json);
+  }
+  return json;
+}
+
+void CallProfiler::ResetForTesting() {
+  CallProfiler* profiler = Default();
+  for (size_t i = 0; i < profiler->num_shards_; ++i) {
+    MutexLock lock(&profiler->shards_[i].mu);
+    profiler->shards_[i].methods.clear();
+  }
+}
+
+}  // namespace grpc_core
+
+char* grpc_call_profiler_get_profiles(void) {
+  return gpr_strdup(grpc_core::CallProfiler::RenderJson().Dump().c_str());
+}
+
+//
+// grpc_client_call_profiler_filter and grpc_server_call_profiler_filter
+//
+
+namespace {
+
+uint64_t TotalBytes(const grpc_transport_one_way_stats& stats) {
+  return stats.framing_bytes + stats.data_bytes + stats.header_bytes;
+}
+
+struct call_data {
+  call_data(const grpc_call_element_args* args, bool is_client)
+      : is_client(is_client),
+        call_stack(args->call_stack),
+        arena(args->arena),
+        path(grpc_slice_ref_internal(args->path)) {
+    arena->EnableAllocationCounting();
+    if (args->context != nullptr) {
+      args->context[GRPC_CONTEXT_CALL_PROFILE].value = &profile;
+    }
+    GRPC_CLOSURE_INIT(&recv_initial_metadata_ready, RecvInitialMetadataReady,
+                      this, grpc_schedule_on_exec_ctx);
+  }
+
+  ~call_data() { grpc_slice_unref_internal(path); }
+
+  // Server calls learn their method from the received initial metadata.
+  static void RecvInitialMetadataReady(void* arg, grpc_error* error) {
+    call_data* calld = static_cast<call_data*>(arg);
+    grpc_linked_mdelem* path_md = calld->recv_initial_metadata->idx.named.path;
+    if (error == GRPC_ERROR_NONE && path_md != nullptr &&
+        GRPC_SLICE_LENGTH(calld->path) == 0) {
+      grpc_slice_unref_internal(calld->path);
+      calld->path = grpc_slice_ref_internal(GRPC_MDVALUE(path_md->md));
+    }
+    grpc_core::Closure::Run(DEBUG_LOCATION,
+                            calld->original_recv_initial_metadata_ready,
+                            GRPC_ERROR_REF(error));
+  }
+
+  const bool is_client;
+  grpc_call_stack* call_stack;
+  grpc_core::Arena* arena;
+  grpc_slice path;
+  grpc_core::CallProfile profile;
+  grpc_metadata_batch* recv_initial_metadata = nullptr;
+  grpc_closure recv_initial_metadata_ready;
+  grpc_closure* original_recv_initial_metadata_ready = nullptr;
+};
+
+void call_profiler_start_transport_stream_op_batch(
+    grpc_call_element* elem, grpc_transport_stream_op_batch* batch) {
+  call_data* calld = static_cast<call_data*>(elem->call_data);
+  if (batch->recv_initial_metadata && GRPC_SLICE_LENGTH(calld->path) == 0) {
+    calld->recv_initial_metadata =
+        batch->payload->recv_initial_metadata.recv_initial_metadata;
+    calld->original_recv_initial_metadata_ready =
+        batch->payload->recv_initial_metadata.recv_initial_metadata_ready;
+    batch->payload->recv_initial_metadata.recv_initial_metadata_ready =
+        &calld->recv_initial_metadata_ready;
+  }
+  // The batch may complete (and the call be destroyed) before
+  // grpc_call_next_op() returns, so hold a reference to the call stack while
+  // timing it.
+  grpc_core::CallProfile* profile = &calld->profile;
+  grpc_call_stack* call_stack = calld->call_stack;
+  GRPC_CALL_STACK_REF(call_stack, "call_profiler");
+  gpr_cycle_counter start = gpr_get_cycle_counter();
+  grpc_call_next_op(elem, batch);
+  profile->AddStackTime(start, gpr_get_cycle_counter());
+  GRPC_CALL_STACK_UNREF(call_stack, "call_profiler");
+}
+
+grpc_error* client_call_profiler_init_call_elem(
+    grpc_call_element* elem, const grpc_call_element_args* args) {
+  new (elem->call_data) call_data(args, /*is_client=*/true);
+  return GRPC_ERROR_NONE;
+}
+
+grpc_error* server_call_profiler_init_call_elem(
+    grpc_call_element* elem, const grpc_call_element_args* args) {
+  new (elem->call_data) call_data(args, /*is_client=*/false);
+  return GRPC_ERROR_NONE;
+}
+
+void call_profiler_destroy_call_elem(grpc_call_element* elem,
+                                     const grpc_call_final_info* final_info,
+                                     grpc_closure* /*ignored*/) {
+  call_data* calld = static_cast<call_data*>(elem->call_data);
+  grpc_core::CallProfiler::CallRecord record;
+  record.arena_bytes = calld->arena->TotalUsed();
+  record.arena_allocations = calld->arena->AllocationCount();
+  record.latency_nanos = static_cast<uint64_t>(
+      final_info->stats.latency.tv_sec * GPR_NS_PER_SEC +
+      final_info->stats.latency.tv_nsec);
+  const int64_t stack_nanos = calld->profile.stack_nanos();
+  const int64_t transport_nanos = calld->profile.transport_nanos();
+  record.filter_nanos = stack_nanos > transport_nanos
+                            ? static_cast<uint64_t>(stack_nanos - transport_nanos)
+                            : 0;
+  record.transport_nanos = static_cast<uint64_t>(transport_nanos);
+  record.application_nanos =
+      static_cast<uint64_t>(calld->profile.application_nanos());
+  record.bytes_sent =
+      TotalBytes(final_info->stats.transport_stream_stats.outgoing);
+  record.bytes_received =
+      TotalBytes(final_info->stats.transport_stream_stats.incoming);
+  grpc_core::CallProfiler::Record(
+      grpc_core::StringViewFromSlice(calld->path).empty()
+          ? std::string("<unknown>")
+          : std::string(grpc_core::StringViewFromSlice(calld->path)),
+      calld->is_client, record);
+  calld->~call_data();
+}
+
+grpc_error* call_profiler_init_channel_elem(
+    grpc_channel_element* /*elem*/, grpc_channel_element_args* /*args*/) {
+  return GRPC_ERROR_NONE;
+}
+
+void call_profiler_destroy_channel_elem(grpc_channel_element* /*elem*/) {}
+
+}  // namespace
+
+const grpc_channel_filter grpc_client_call_profiler_filter = {
+    call_profiler_start_transport_stream_op_batch,
+    grpc_channel_next_op,
+    sizeof(call_data),
+    client_call_profiler_init_call_elem,
+    grpc_call_stack_ignore_set_pollset_or_pollset_set,
+    call_profiler_destroy_call_elem,
+    0,  // sizeof(channel_data)
+    call_profiler_init_channel_elem,
+    call_profiler_destroy_channel_elem,
+    grpc_channel_next_get_info,
+    "client_call_profiler"};
+
+const grpc_channel_filter grpc_server_call_profiler_filter = {
+    call_profiler_start_transport_stream_op_batch,
+    grpc_channel_next_op,
+    sizeof(call_data),
+    server_call_profiler_init_call_elem,
+    grpc_call_stack_ignore_set_pollset_or_pollset_set,
+    call_profiler_destroy_call_elem,
+    0,  // sizeof(channel_data)
+    call_profiler_init_channel_elem,
+    call_profiler_destroy_channel_elem,
+    grpc_channel_next_get_info,
+    "server_call_profiler"};
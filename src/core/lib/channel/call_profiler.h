@@ -0,0 +1,186 @@
+/*
+ *
+ * Copyright 2020 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef GRPC_CORE_LIB_CHANNEL_CALL_PROFILER_H
+#define GRPC_CORE_LIB_CHANNEL_CALL_PROFILER_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stdint.h>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "src/core/lib/channel/channel_stack.h"
+#include "src/core/lib/channel/context.h"
+#include "src/core/lib/gpr/time_precise.h"
+#include "src/core/lib/gprpp/atomic.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/json/json.h"
+
+namespace grpc_core {
+
+// A histogram with power-of-two buckets: bucket 0 holds zero, and bucket i > 0
+// holds values in [2^(i-1), 2^i). Adding a value is lock free.
+class CallProfileHistogram {
+ public:
+  static constexpr int kNumBuckets = 48;
+
+  void Add(uint64_t value);
+  // Adds the values recorded in \a other.
+  void Merge(const CallProfileHistogram& other);
+
+  uint64_t Count() const;
+  uint64_t Sum() const { return sum_.Load(MemoryOrder::RELAXED); }
+  // Returns an upper bound for the given percentile (in [0, 100]).
+  uint64_t Percentile(double percentile) const;
+
+  // Renders count, sum and a few percentiles.
+  Json ToJson() const;
+
+ private:
+  Atomic<uint64_t> buckets_[kNumBuckets];
+  Atomic<uint64_t> sum_{0};
+};
+
+// Per-call accumulator. Owned by the call profiler filter's call data and
+// published in the GRPC_CONTEXT_CALL_PROFILE call context element,
+// so that the surface and the connected channel can contribute timings. All
+// methods are thread safe.
+class CallProfile {
+ public:
+  // Returns the profile of the call owning \a context, or nullptr if the call
+  // is not being profiled.
+  static CallProfile* FromContext(const grpc_call_context_element* context) {
+    if (context == nullptr) return nullptr;
+    return static_cast<CallProfile*>(context[GRPC_CONTEXT_CALL_PROFILE].value);
+  }
+
+  // Synchronous time spent passing a batch down the call stack, including the
+  // transport.
+  void AddStackTime(gpr_cycle_counter start, gpr_cycle_counter end) {
+    stack_nanos_.FetchAdd(CyclesToNanos(start, end), MemoryOrder::RELAXED);
+  }
+  // Synchronous time spent inside the transport's perform_stream_op.
+  void AddTransportTime(gpr_cycle_counter start, gpr_cycle_counter end) {
+    transport_nanos_.FetchAdd(CyclesToNanos(start, end), MemoryOrder::RELAXED);
+  }
+
+  // Called by the surface when a batch completes, and when the application
+  // starts the next batch: the time in between is attributed to the
+  // application.
+  void BatchCompleted() {
+    last_completion_.Store(gpr_get_cycle_counter(), MemoryOrder::RELAXED);
+  }
+  void BatchStarted();
+
+  int64_t stack_nanos() const { return stack_nanos_.Load(MemoryOrder::RELAXED); }
+  int64_t transport_nanos() const {
+    return transport_nanos_.Load(MemoryOrder::RELAXED);
+  }
+  int64_t application_nanos() const {
+    return application_nanos_.Load(MemoryOrder::RELAXED);
+  }
+
+  static int64_t CyclesToNanos(gpr_cycle_counter start, gpr_cycle_counter end);
+
+ private:
+  Atomic<int64_t> stack_nanos_{0};
+  Atomic<int64_t> transport_nanos_{0};
+  Atomic<int64_t> application_nanos_{0};
+  Atomic<gpr_cycle_counter> last_completion_{0};
+};
+
+// Process-wide registry of per-method profiles. Client and server calls to
+// the same method are profiled separately, since a process may be both.
+// Calls are recorded into per-CPU shards, like grpc_stats, so that calls
+// finishing on different CPUs do not contend; readers merge the shards.
+class CallProfiler {
+ public:
+  // What a profiled call reports when it is destroyed.
+  struct CallRecord {
+    uint64_t arena_bytes = 0;
+    uint64_t arena_allocations = 0;
+    uint64_t latency_nanos = 0;
+    uint64_t filter_nanos = 0;
+    uint64_t transport_nanos = 0;
+    uint64_t application_nanos = 0;
+    uint64_t bytes_sent = 0;
+    uint64_t bytes_received = 0;
+  };
+
+  struct MethodProfile {
+    Atomic<uint64_t> calls{0};
+    CallProfileHistogram arena_bytes;
+    CallProfileHistogram arena_allocations;
+    CallProfileHistogram latency_nanos;
+    CallProfileHistogram filter_nanos;
+    CallProfileHistogram transport_nanos;
+    CallProfileHistogram application_nanos;
+    CallProfileHistogram bytes_sent;
+    CallProfileHistogram bytes_received;
+
+    // Adds the calls recorded in \a other.
+    void Merge(const MethodProfile& other);
+  };
+
+  // Records one client or server call against \a method.
+  static void Record(const std::string& method, bool is_client,
+                     const CallRecord& record);
+
+  // Returns a snapshot of the client or server profile of \a method, or
+  // nullptr if no such call to it has been recorded.
+  static std::unique_ptr<MethodProfile> Get(const std::string& method,
+                                            bool is_client);
+
+  // Renders all method profiles as a JSON object keyed by method name, each
+  // holding a "client" and/or a "server" profile.
+  static Json RenderJson();
+
+  static void ResetForTesting();
+
+ private:
+  // Method name and whether the calls are client calls.
+  typedef std::pair<std::string, bool> Key;
+
+  struct Shard {
+    Mutex mu;
+    std::map<Key, std::unique_ptr<MethodProfile>> methods;
+  };
+
+  CallProfiler();
+
+  static CallProfiler* Default();
+
+  // Returns the profiles of all shards merged by key.
+  std::map<Key, std::unique_ptr<MethodProfile>> Snapshot();
+
+  const size_t num_shards_;
+  std::unique_ptr<Shard[]> shards_;
+};
+
+}  // namespace grpc_core
+
+// Filters that profile calls on client channels and servers with
+// GRPC_ARG_ENABLE_CALL_PROFILING.
+extern const grpc_channel_filter grpc_client_call_profiler_filter;
+extern const grpc_channel_filter grpc_server_call_profiler_filter;
+
+#endif /* GRPC_CORE_LIB_CHANNEL_CALL_PROFILER_H */
@@ -34,6 +34,7 @@
 #include <grpc/support/string_util.h>
 
 #include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/gpr/murmur_hash.h"
 #include "src/core/lib/gpr/string.h"
 #include "src/core/lib/gpr/useful.h"
 
@@ -232,6 +233,30 @@ int grpc_channel_args_compare(const grpc_channel_args* a,
   return 0;
 }
 
+static uint32_t hash_string(const char* s, uint32_t seed) {
+  return gpr_murmur_hash3(s, strlen(s), seed);
+}
+
+size_t grpc_channel_args_hash(const grpc_channel_args* args) {
+  if (args == nullptr) return 0;
+  uint32_t h = static_cast<uint32_t>(args->num_args);
+  for (size_t i = 0; i < args->num_args; i++) {
+    const grpc_arg& arg = args->args[i];
+    h = hash_string(arg.key, h ^ static_cast<uint32_t>(arg.type));
+    switch (arg.type) {
+      case GRPC_ARG_STRING:
+        h = hash_string(arg.value.string, h);
+        break;
+      case GRPC_ARG_INTEGER:
+        h = gpr_murmur_hash3(&arg.value.integer, sizeof(arg.value.integer), h);
+        break;
+      case GRPC_ARG_POINTER:
+        break;
+    }
+  }
+  return h;
+}
+
 const grpc_arg* grpc_channel_args_find(const grpc_channel_args* args,
                                        const char* name) {
   if (args != nullptr) {
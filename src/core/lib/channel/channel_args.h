@@ -65,6 +65,12 @@ inline void grpc_channel_args_destroy(const grpc_channel_args* a) {
 int grpc_channel_args_compare(const grpc_channel_args* a,
                               const grpc_channel_args* b);
 
+/** Returns a hash of \a args that is consistent with
+ * grpc_channel_args_compare(): args that compare equal hash to the same value.
+ * Pointer args contribute only their key, since their vtable's cmp may
+ * consider distinct pointers equal. */
+size_t grpc_channel_args_hash(const grpc_channel_args* args);
+
 /** Returns the value of argument \a name from \a args, or NULL if not found. */
 const grpc_arg* grpc_channel_args_find(const grpc_channel_args* args,
                                        const char* name);
@@ -443,6 +443,14 @@ void SocketNode::RecordMessageReceived() {
                                      MemoryOrder::RELAXED);
 }
 
+void SocketNode::RecordWriteLatency(int64_t queued_us, int64_t kernel_us,
+                                    int64_t wire_us) {
+  write_queued_us_.FetchAdd(queued_us, MemoryOrder::RELAXED);
+  write_kernel_us_.FetchAdd(kernel_us, MemoryOrder::RELAXED);
+  write_wire_us_.FetchAdd(wire_us, MemoryOrder::RELAXED);
+  write_latency_samples_.FetchAdd(1, MemoryOrder::RELAXED);
+}
+
 Json SocketNode::RenderJson() {
   // Create and fill the data child.
   Json::Object data;
@@ -505,6 +513,34 @@ Json SocketNode::RenderJson() {
   if (keepalives_sent != 0) {
     data["keepAlivesSent"] = std::to_string(keepalives_sent);
   }
+  // SocketData has no latency fields, so the sampled write latency breakdown
+  // is reported as socket options.
+  int64_t write_latency_samples =
+      write_latency_samples_.Load(MemoryOrder::RELAXED);
+  if (write_latency_samples != 0) {
+    auto average = [write_latency_samples](const Atomic<int64_t>& sum) {
+      return std::to_string(sum.Load(MemoryOrder::RELAXED) /
+                            write_latency_samples);
+    };
+    data["option"] = Json::Array{
+        Json::Object{
+            {"name", "grpc.write_latency.samples"},
+            {"value", std::to_string(write_latency_samples)},
+        },
+        Json::Object{
+            {"name", "grpc.write_latency.queued_avg_us"},
+            {"value", average(write_queued_us_)},
+        },
+        Json::Object{
+            {"name", "grpc.write_latency.kernel_avg_us"},
+            {"value", average(write_kernel_us_)},
+        },
+        Json::Object{
+            {"name", "grpc.write_latency.wire_avg_us"},
+            {"value", average(write_wire_us_)},
+        },
+    };
+  }
   // Create and fill the parent object.
   Json::Object object = {
       {"ref",
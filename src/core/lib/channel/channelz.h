@@ -298,6 +298,9 @@ class SocketNode : public BaseNode {
   void RecordKeepaliveSent() {
     keepalives_sent_.FetchAdd(1, MemoryOrder::RELAXED);
   }
+  // Records a sampled write latency breakdown, in microseconds.
+  void RecordWriteLatency(int64_t queued_us, int64_t kernel_us,
+                          int64_t wire_us);
 
   const std::string& remote() { return remote_; }
 
@@ -308,6 +311,10 @@ class SocketNode : public BaseNode {
   Atomic<int64_t> messages_sent_{0};
   Atomic<int64_t> messages_received_{0};
   Atomic<int64_t> keepalives_sent_{0};
+  Atomic<int64_t> write_latency_samples_{0};
+  Atomic<int64_t> write_queued_us_{0};
+  Atomic<int64_t> write_kernel_us_{0};
+  Atomic<int64_t> write_wire_us_{0};
   Atomic<gpr_cycle_counter> last_local_stream_created_cycle_{0};
   Atomic<gpr_cycle_counter> last_remote_stream_created_cycle_{0};
   Atomic<gpr_cycle_counter> last_message_sent_cycle_{0};
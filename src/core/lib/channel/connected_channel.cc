@@ -28,6 +28,7 @@
 #include <grpc/slice_buffer.h>
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
+#include "src/core/lib/channel/call_profiler.h"
 #include "src/core/lib/gpr/string.h"
 #include "src/core/lib/profiling/timers.h"
 #include "src/core/lib/transport/transport.h"
@@ -46,6 +47,7 @@ struct callback_state {
 };
 typedef struct connected_channel_call_data {
   grpc_core::CallCombiner* call_combiner;
+  grpc_call_context_element* context;
   // Closures used for returning results on the call combiner.
   callback_state on_complete[6];  // Max number of pending batches.
   callback_state recv_initial_metadata_ready;
@@ -134,8 +136,17 @@ static void connected_channel_start_transport_stream_op_batch(
     callback_state* state = get_state_for_batch(calld, batch);
     intercept_callback(calld, state, false, "on_complete", &batch->on_complete);
   }
-  grpc_transport_perform_stream_op(
-      chand->transport, TRANSPORT_STREAM_FROM_CALL_DATA(calld), batch);
+  grpc_core::CallProfile* profile =
+      grpc_core::CallProfile::FromContext(calld->context);
+  if (GPR_UNLIKELY(profile != nullptr)) {
+    gpr_cycle_counter start = gpr_get_cycle_counter();
+    grpc_transport_perform_stream_op(
+        chand->transport, TRANSPORT_STREAM_FROM_CALL_DATA(calld), batch);
+    profile->AddTransportTime(start, gpr_get_cycle_counter());
+  } else {
+    grpc_transport_perform_stream_op(
+        chand->transport, TRANSPORT_STREAM_FROM_CALL_DATA(calld), batch);
+  }
   GRPC_CALL_COMBINER_STOP(calld->call_combiner, "passed batch to transport");
 }
 
@@ -151,6 +162,7 @@ static grpc_error* connected_channel_init_call_elem(
   call_data* calld = static_cast<call_data*>(elem->call_data);
   channel_data* chand = static_cast<channel_data*>(elem->channel_data);
   calld->call_combiner = args->call_combiner;
+  calld->context = args->context;
   int r = grpc_transport_init_stream(
       chand->transport, TRANSPORT_STREAM_FROM_CALL_DATA(calld),
       &args->call_stack->refcount, args->server_transport_data, args->arena);
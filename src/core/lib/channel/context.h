@@ -38,6 +38,10 @@ typedef enum {
   /// Holds a pointer to ServiceConfigCallData associated with this call.
   GRPC_CONTEXT_SERVICE_CONFIG_CALL_DATA,
 
+  /// Value is a \a grpc_core::CallProfile, present only on channels with
+  /// call profiling enabled.
+  GRPC_CONTEXT_CALL_PROFILE,
+
   GRPC_CONTEXT_COUNT
 } grpc_context_index;
 
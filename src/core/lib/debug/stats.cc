@@ -25,6 +25,7 @@
 
 #include <vector>
 
+#include "absl/strings/str_cat.h"
 #include "absl/strings/str_format.h"
 #include "absl/strings/str_join.h"
 
@@ -43,7 +44,10 @@ void grpc_stats_init(void) {
       gpr_zalloc(sizeof(grpc_stats_data) * g_num_cores));
 }
 
-void grpc_stats_shutdown(void) { gpr_free(grpc_stats_per_cpu_storage); }
+void grpc_stats_shutdown(void) {
+  gpr_free(grpc_stats_per_cpu_storage);
+  grpc_stats_per_cpu_storage = nullptr;
+}
 
 void grpc_stats_collect(grpc_stats_data* output) {
   memset(output, 0, sizeof(*output));
@@ -170,3 +174,50 @@ std::string grpc_stats_data_as_json(const grpc_stats_data* data) {
   parts.push_back("}");
   return absl::StrJoin(parts, "");
 }
+
+std::string grpc_stats_data_as_sparse_json(const grpc_stats_data* data) {
+  std::vector<std::string> entries;
+  for (size_t i = 0; i < GRPC_STATS_COUNTER_COUNT; i++) {
+    if (data->counters[i] == 0) continue;
+    entries.push_back(absl::StrFormat(
+        "\"%s\": %" PRIdPTR, grpc_stats_counter_name[i], data->counters[i]));
+  }
+  for (size_t i = 0; i < GRPC_STATS_HISTOGRAM_COUNT; i++) {
+    if (grpc_stats_histo_count(data, static_cast<grpc_stats_histograms>(i)) ==
+        0) {
+      continue;
+    }
+    std::vector<std::string> buckets;
+    std::vector<std::string> boundaries;
+    for (int j = 0; j < grpc_stats_histo_buckets[i]; j++) {
+      buckets.push_back(absl::StrFormat(
+          "%" PRIdPTR, data->histograms[grpc_stats_histo_start[i] + j]));
+      boundaries.push_back(
+          absl::StrFormat("%d", grpc_stats_histo_bucket_boundaries[i][j]));
+    }
+    entries.push_back(absl::StrFormat(
+        "\"%s\": [%s], \"%s_bkt\": [%s]", grpc_stats_histogram_name[i],
+        absl::StrJoin(buckets, ","), grpc_stats_histogram_name[i],
+        absl::StrJoin(boundaries, ",")));
+  }
+  return absl::StrCat("{", absl::StrJoin(entries, ", "), "}");
+}
+
+void grpc_stats_exporter_init(grpc_stats_exporter* exporter) {
+  grpc_stats_collect(&exporter->last);
+}
+
+void grpc_stats_exporter_collect_delta(grpc_stats_exporter* exporter,
+                                       grpc_stats_data* delta) {
+  grpc_stats_collect(delta);
+  for (size_t i = 0; i < GRPC_STATS_COUNTER_COUNT; i++) {
+    gpr_atm now = delta->counters[i];
+    delta->counters[i] -= exporter->last.counters[i];
+    exporter->last.counters[i] = now;
+  }
+  for (size_t i = 0; i < GRPC_STATS_HISTOGRAM_BUCKETS; i++) {
+    gpr_atm now = delta->histograms[i];
+    delta->histograms[i] -= exporter->last.histograms[i];
+    exporter->last.histograms[i] = now;
+  }
+}
@@ -59,6 +59,24 @@ void grpc_stats_collect(grpc_stats_data* output);
 void grpc_stats_diff(const grpc_stats_data* b, const grpc_stats_data* a,
                      grpc_stats_data* c);
 std::string grpc_stats_data_as_json(const grpc_stats_data* data);
+
+/* Exports the global stats as a series of deltas: each collection reports
+   only what changed since the previous one, at the cost of a single pass over
+   the per-cpu storage. Not thread-safe: use one exporter per exporting
+   thread. */
+typedef struct grpc_stats_exporter {
+  grpc_stats_data last;
+} grpc_stats_exporter;
+
+void grpc_stats_exporter_init(grpc_stats_exporter* exporter);
+// Stores the stats accumulated since the last call (or since init) in delta.
+void grpc_stats_exporter_collect_delta(grpc_stats_exporter* exporter,
+                                       grpc_stats_data* delta);
+// Renders data as valid JSON, with its entries separated by commas. Zero
+// counters and empty histograms are omitted, which keeps frequent delta
+// exports small. grpc_stats_data_as_json() keeps its original format for
+// existing consumers.
+std::string grpc_stats_data_as_sparse_json(const grpc_stats_data* data);
 int grpc_stats_histo_find_bucket_slow(int value, const int* table,
                                       int table_size);
 double grpc_stats_histo_percentile(const grpc_stats_data* data,
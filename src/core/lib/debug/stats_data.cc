@@ -124,6 +124,12 @@ const char* grpc_stats_counter_name[GRPC_STATS_COUNTER_COUNT] = {
     "cq_ev_queue_trylock_failures",
     "cq_ev_queue_trylock_successes",
     "cq_ev_queue_transient_pop_failures",
+    "handshake_steps_offloaded",
+    "handshake_offload_rejected",
+    "ssl_client_handshakes",
+    "ssl_client_sessions_resumed",
+    "ssl_server_handshakes",
+    "ssl_server_sessions_resumed",
 };
 const char* grpc_stats_counter_doc[GRPC_STATS_COUNTER_COUNT] = {
     "Number of client side calls created by this process",
@@ -251,6 +257,14 @@ const char* grpc_stats_counter_doc[GRPC_STATS_COUNTER_COUNT] = {
     "queue.",
     "Number of times NULL was popped out of completion queue's event queue "
     "even though the event queue was not empty",
+    "Number of security handshake steps run on the handshake thread pool",
+    "Number of security handshakes failed because the handshake thread pool "
+    "queue was full",
+    "Number of completed client-side SSL handshakes",
+    "Number of client-side SSL handshakes that resumed a cached session",
+    "Number of completed server-side SSL handshakes",
+    "Number of server-side SSL handshakes that resumed a session from a "
+    "session ticket",
 };
 const char* grpc_stats_histogram_name[GRPC_STATS_HISTOGRAM_COUNT] = {
     "call_initial_size",
@@ -265,7 +279,15 @@ const char* grpc_stats_histogram_name[GRPC_STATS_HISTOGRAM_COUNT] = {
     "http2_send_message_per_write",
     "http2_send_trailing_metadata_per_write",
     "http2_send_flowctl_per_write",
+    "http2_write_queued_latency",
+    "http2_write_kernel_latency",
+    "http2_write_wire_latency",
+    "combiner_locks_queue_length",
+    "exec_ctx_closures_per_flush",
     "server_cqs_checked",
+    "handshake_offload_queue_time",
+    "handshake_step_time",
+    "handshake_duration",
 };
 const char* grpc_stats_histogram_doc[GRPC_STATS_HISTOGRAM_COUNT] = {
     "Initial size of the grpc_call arena created at call start",
@@ -280,8 +302,24 @@ const char* grpc_stats_histogram_doc[GRPC_STATS_HISTOGRAM_COUNT] = {
     "Number of streams whose payload was written per TCP write",
     "Number of streams terminated per TCP write",
     "Number of flow control updates written per TCP write",
+    "Microseconds a sampled HTTP2 write spent queued in gRPC between the send "
+    "op reaching the transport and sendmsg",
+    "Microseconds a sampled HTTP2 write spent in the kernel send queue between "
+    "sendmsg and the packet leaving the host",
+    "Microseconds a sampled HTTP2 write spent on the wire between the packet "
+    "leaving the host and the peer acknowledging it",
+    "Number of items already queued on a combiner lock when more items are "
+    "scheduled against it",
+    "Number of closures run by each ExecCtx flush that ran any, including "
+    "those run by the combiners it drained; work offloaded to the executor is "
+    "not counted",
     "How many completion queues were checked looking for a CQ that had "
     "requested the incoming call",
+    "Microseconds an offloaded security handshake step waited for a handshake "
+    "thread",
+    "Microseconds spent computing each security handshake step",
+    "Microseconds from the start of a security handshake to its successful "
+    "completion",
 };
 const int grpc_stats_table_0[65] = {
     0,      1,      2,      3,      4,     5,     7,     9,     11,    14,
@@ -348,8 +386,42 @@ const uint8_t grpc_stats_table_7[102] = {
     23, 24, 24, 24, 25, 26, 27, 27, 28, 28, 29, 29, 30, 30, 31, 31, 32,
     32, 33, 33, 34, 35, 35, 36, 37, 37, 38, 38, 39, 39, 40, 40, 41, 41,
     42, 42, 43, 44, 44, 45, 46, 46, 47, 48, 48, 49, 49, 50, 50, 51, 51};
-const int grpc_stats_table_8[9] = {0, 1, 2, 4, 7, 13, 23, 39, 64};
-const uint8_t grpc_stats_table_9[9] = {0, 0, 1, 2, 2, 3, 4, 4, 5};
+const int grpc_stats_table_8[65] = {
+    0,      1,      2,      3,      4,      5,      7,      9,      12,
+    15,     19,     24,     30,     37,     46,     57,     70,     86,
+    105,    129,    158,    193,    236,    288,    352,    430,    525,
+    641,    782,    954,    1164,   1420,   1733,   2114,   2579,   3146,
+    3838,   4682,   5711,   6967,   8499,   10367,  12646,  15426,  18816,
+    22951,  27995,  34148,  41653,  50807,  61972,  75591,  92203,  112465,
+    137180, 167326, 204096, 248947, 303653, 370381, 451772, 551049, 672141,
+    819843, 1000000};
+const uint8_t grpc_stats_table_9[139] = {
+    0,  0,  0,  1,  1,  1,  2,  2,  2,  3,  3,  3,  4,  4,  5,  5,  5,  6,
+    6,  6,  7,  7,  8,  8,  9,  9,  9,  10, 10, 11, 11, 12, 12, 12, 13, 13,
+    13, 14, 15, 15, 15, 16, 16, 17, 17, 17, 18, 18, 19, 19, 20, 20, 20, 21,
+    21, 22, 22, 23, 23, 24, 24, 24, 25, 25, 26, 26, 27, 27, 27, 28, 28, 29,
+    29, 30, 30, 31, 31, 31, 32, 32, 33, 33, 34, 34, 34, 35, 35, 36, 36, 37,
+    37, 37, 38, 38, 39, 39, 40, 40, 41, 41, 41, 42, 42, 43, 43, 44, 44, 44,
+    45, 45, 46, 46, 47, 47, 48, 48, 48, 49, 49, 50, 50, 51, 51, 51, 52, 52,
+    53, 53, 54, 54, 55, 55, 55, 56, 56, 57, 57, 58, 58};
+const int grpc_stats_table_10[9] = {0, 1, 2, 4, 7, 13, 23, 39, 64};
+const uint8_t grpc_stats_table_11[9] = {0, 0, 1, 2, 2, 3, 4, 4, 5};
+const int grpc_stats_table_12[65] = {
+    0,       1,       2,       3,       4,       6,       8,       11,
+    14,      18,      23,      30,      39,      50,      64,      82,
+    105,     134,     171,     218,     277,     352,     447,     568,
+    721,     916,     1163,    1477,    1875,    2380,    3021,    3835,
+    4868,    6179,    7843,    9955,    12635,   16036,   20353,   25832,
+    32785,   41610,   52810,   67024,   85064,   107959,  137017,  173895,
+    220699,  280100,  355489,  451169,  572601,  726716,  922311,  1170550,
+    1485602, 1885449, 2392914, 3036962, 3854353, 4891743, 6208344, 7879305,
+    10000000};
+const uint8_t grpc_stats_table_13[83] = {
+    0,  0,  1,  1,  2,  3,  3,  4,  5,  6,  6,  7,  8,  8,  9,  9,  10,
+    11, 12, 12, 13, 14, 15, 15, 16, 17, 18, 18, 19, 20, 20, 21, 22, 23,
+    23, 24, 25, 26, 26, 27, 28, 28, 29, 30, 31, 31, 32, 33, 34, 34, 35,
+    35, 36, 37, 38, 38, 39, 40, 41, 41, 42, 43, 44, 44, 45, 46, 47, 47,
+    48, 49, 49, 50, 51, 52, 52, 53, 54, 55, 55, 56, 57, 58, 58};
 void grpc_stats_inc_call_initial_size(int value) {
   value = GPR_CLAMP(value, 0, 262144);
   if (value < 6) {
@@ -638,6 +710,131 @@ void grpc_stats_inc_http2_send_flowctl_per_write(int value) {
       GRPC_STATS_HISTOGRAM_HTTP2_SEND_FLOWCTL_PER_WRITE,
       grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_6, 64));
 }
+void grpc_stats_inc_http2_write_queued_latency(int value) {
+  value = GPR_CLAMP(value, 0, 1000000);
+  if (value < 6) {
+    GRPC_STATS_INC_HISTOGRAM(GRPC_STATS_HISTOGRAM_HTTP2_WRITE_QUEUED_LATENCY,
+                             value);
+    return;
+  }
+  union {
+    double dbl;
+    uint64_t uint;
+  } _val, _bkt;
+  _val.dbl = value;
+  if (_val.uint < 4651092515166879744ull) {
+    int bucket =
+        grpc_stats_table_9[((_val.uint - 4618441417868443648ull) >> 49)] + 6;
+    _bkt.dbl = grpc_stats_table_8[bucket];
+    bucket -= (_val.uint < _bkt.uint);
+    GRPC_STATS_INC_HISTOGRAM(GRPC_STATS_HISTOGRAM_HTTP2_WRITE_QUEUED_LATENCY,
+                             bucket);
+    return;
+  }
+  GRPC_STATS_INC_HISTOGRAM(
+      GRPC_STATS_HISTOGRAM_HTTP2_WRITE_QUEUED_LATENCY,
+      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_8, 64));
+}
+void grpc_stats_inc_http2_write_kernel_latency(int value) {
+  value = GPR_CLAMP(value, 0, 1000000);
+  if (value < 6) {
+    GRPC_STATS_INC_HISTOGRAM(GRPC_STATS_HISTOGRAM_HTTP2_WRITE_KERNEL_LATENCY,
+                             value);
+    return;
+  }
+  union {
+    double dbl;
+    uint64_t uint;
+  } _val, _bkt;
+  _val.dbl = value;
+  if (_val.uint < 4651092515166879744ull) {
+    int bucket =
+        grpc_stats_table_9[((_val.uint - 4618441417868443648ull) >> 49)] + 6;
+    _bkt.dbl = grpc_stats_table_8[bucket];
+    bucket -= (_val.uint < _bkt.uint);
+    GRPC_STATS_INC_HISTOGRAM(GRPC_STATS_HISTOGRAM_HTTP2_WRITE_KERNEL_LATENCY,
+                             bucket);
+    return;
+  }
+  GRPC_STATS_INC_HISTOGRAM(
+      GRPC_STATS_HISTOGRAM_HTTP2_WRITE_KERNEL_LATENCY,
+      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_8, 64));
+}
+void grpc_stats_inc_http2_write_wire_latency(int value) {
+  value = GPR_CLAMP(value, 0, 1000000);
+  if (value < 6) {
+    GRPC_STATS_INC_HISTOGRAM(GRPC_STATS_HISTOGRAM_HTTP2_WRITE_WIRE_LATENCY,
+                             value);
+    return;
+  }
+  union {
+    double dbl;
+    uint64_t uint;
+  } _val, _bkt;
+  _val.dbl = value;
+  if (_val.uint < 4651092515166879744ull) {
+    int bucket =
+        grpc_stats_table_9[((_val.uint - 4618441417868443648ull) >> 49)] + 6;
+    _bkt.dbl = grpc_stats_table_8[bucket];
+    bucket -= (_val.uint < _bkt.uint);
+    GRPC_STATS_INC_HISTOGRAM(GRPC_STATS_HISTOGRAM_HTTP2_WRITE_WIRE_LATENCY,
+                             bucket);
+    return;
+  }
+  GRPC_STATS_INC_HISTOGRAM(
+      GRPC_STATS_HISTOGRAM_HTTP2_WRITE_WIRE_LATENCY,
+      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_8, 64));
+}
+void grpc_stats_inc_combiner_locks_queue_length(int value) {
+  value = GPR_CLAMP(value, 0, 1024);
+  if (value < 13) {
+    GRPC_STATS_INC_HISTOGRAM(GRPC_STATS_HISTOGRAM_COMBINER_LOCKS_QUEUE_LENGTH,
+                             value);
+    return;
+  }
+  union {
+    double dbl;
+    uint64_t uint;
+  } _val, _bkt;
+  _val.dbl = value;
+  if (_val.uint < 4637863191261478912ull) {
+    int bucket =
+        grpc_stats_table_7[((_val.uint - 4623507967449235456ull) >> 48)] + 13;
+    _bkt.dbl = grpc_stats_table_6[bucket];
+    bucket -= (_val.uint < _bkt.uint);
+    GRPC_STATS_INC_HISTOGRAM(GRPC_STATS_HISTOGRAM_COMBINER_LOCKS_QUEUE_LENGTH,
+                             bucket);
+    return;
+  }
+  GRPC_STATS_INC_HISTOGRAM(
+      GRPC_STATS_HISTOGRAM_COMBINER_LOCKS_QUEUE_LENGTH,
+      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_6, 64));
+}
+void grpc_stats_inc_exec_ctx_closures_per_flush(int value) {
+  value = GPR_CLAMP(value, 0, 1024);
+  if (value < 13) {
+    GRPC_STATS_INC_HISTOGRAM(GRPC_STATS_HISTOGRAM_EXEC_CTX_CLOSURES_PER_FLUSH,
+                             value);
+    return;
+  }
+  union {
+    double dbl;
+    uint64_t uint;
+  } _val, _bkt;
+  _val.dbl = value;
+  if (_val.uint < 4637863191261478912ull) {
+    int bucket =
+        grpc_stats_table_7[((_val.uint - 4623507967449235456ull) >> 48)] + 13;
+    _bkt.dbl = grpc_stats_table_6[bucket];
+    bucket -= (_val.uint < _bkt.uint);
+    GRPC_STATS_INC_HISTOGRAM(GRPC_STATS_HISTOGRAM_EXEC_CTX_CLOSURES_PER_FLUSH,
+                             bucket);
+    return;
+  }
+  GRPC_STATS_INC_HISTOGRAM(
+      GRPC_STATS_HISTOGRAM_EXEC_CTX_CLOSURES_PER_FLUSH,
+      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_6, 64));
+}
 void grpc_stats_inc_server_cqs_checked(int value) {
   value = GPR_CLAMP(value, 0, 64);
   if (value < 3) {
@@ -651,27 +848,102 @@ void grpc_stats_inc_server_cqs_checked(int value) {
   _val.dbl = value;
   if (_val.uint < 4625196817309499392ull) {
     int bucket =
-        grpc_stats_table_9[((_val.uint - 4613937818241073152ull) >> 51)] + 3;
-    _bkt.dbl = grpc_stats_table_8[bucket];
+        grpc_stats_table_11[((_val.uint - 4613937818241073152ull) >> 51)] + 3;
+    _bkt.dbl = grpc_stats_table_10[bucket];
     bucket -= (_val.uint < _bkt.uint);
     GRPC_STATS_INC_HISTOGRAM(GRPC_STATS_HISTOGRAM_SERVER_CQS_CHECKED, bucket);
     return;
   }
   GRPC_STATS_INC_HISTOGRAM(
       GRPC_STATS_HISTOGRAM_SERVER_CQS_CHECKED,
-      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_8, 8));
+      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_10, 8));
+}
+void grpc_stats_inc_handshake_offload_queue_time(int value) {
+  value = GPR_CLAMP(value, 0, 1000000);
+  if (value < 6) {
+    GRPC_STATS_INC_HISTOGRAM(GRPC_STATS_HISTOGRAM_HANDSHAKE_OFFLOAD_QUEUE_TIME,
+                             value);
+    return;
+  }
+  union {
+    double dbl;
+    uint64_t uint;
+  } _val, _bkt;
+  _val.dbl = value;
+  if (_val.uint < 4651092515166879744ull) {
+    int bucket =
+        grpc_stats_table_9[((_val.uint - 4618441417868443648ull) >> 49)] + 6;
+    _bkt.dbl = grpc_stats_table_8[bucket];
+    bucket -= (_val.uint < _bkt.uint);
+    GRPC_STATS_INC_HISTOGRAM(GRPC_STATS_HISTOGRAM_HANDSHAKE_OFFLOAD_QUEUE_TIME,
+                             bucket);
+    return;
+  }
+  GRPC_STATS_INC_HISTOGRAM(
+      GRPC_STATS_HISTOGRAM_HANDSHAKE_OFFLOAD_QUEUE_TIME,
+      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_8, 64));
+}
+void grpc_stats_inc_handshake_step_time(int value) {
+  value = GPR_CLAMP(value, 0, 1000000);
+  if (value < 6) {
+    GRPC_STATS_INC_HISTOGRAM(GRPC_STATS_HISTOGRAM_HANDSHAKE_STEP_TIME, value);
+    return;
+  }
+  union {
+    double dbl;
+    uint64_t uint;
+  } _val, _bkt;
+  _val.dbl = value;
+  if (_val.uint < 4651092515166879744ull) {
+    int bucket =
+        grpc_stats_table_9[((_val.uint - 4618441417868443648ull) >> 49)] + 6;
+    _bkt.dbl = grpc_stats_table_8[bucket];
+    bucket -= (_val.uint < _bkt.uint);
+    GRPC_STATS_INC_HISTOGRAM(GRPC_STATS_HISTOGRAM_HANDSHAKE_STEP_TIME, bucket);
+    return;
+  }
+  GRPC_STATS_INC_HISTOGRAM(
+      GRPC_STATS_HISTOGRAM_HANDSHAKE_STEP_TIME,
+      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_8, 64));
+}
+void grpc_stats_inc_handshake_duration(int value) {
+  value = GPR_CLAMP(value, 0, 10000000);
+  if (value < 5) {
+    GRPC_STATS_INC_HISTOGRAM(GRPC_STATS_HISTOGRAM_HANDSHAKE_DURATION, value);
+    return;
+  }
+  union {
+    double dbl;
+    uint64_t uint;
+  } _val, _bkt;
+  _val.dbl = value;
+  if (_val.uint < 4682617712558473216ull) {
+    int bucket =
+        grpc_stats_table_13[((_val.uint - 4617315517961601024ull) >> 50)] + 5;
+    _bkt.dbl = grpc_stats_table_12[bucket];
+    bucket -= (_val.uint < _bkt.uint);
+    GRPC_STATS_INC_HISTOGRAM(GRPC_STATS_HISTOGRAM_HANDSHAKE_DURATION, bucket);
+    return;
+  }
+  GRPC_STATS_INC_HISTOGRAM(
+      GRPC_STATS_HISTOGRAM_HANDSHAKE_DURATION,
+      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_12, 64));
 }
-const int grpc_stats_histo_buckets[13] = {64, 128, 64, 64, 64, 64, 64,
-                                          64, 64,  64, 64, 64, 8};
-const int grpc_stats_histo_start[13] = {0,   64,  192, 256, 320, 384, 448,
-                                        512, 576, 640, 704, 768, 832};
-const int* const grpc_stats_histo_bucket_boundaries[13] = {
+const int grpc_stats_histo_buckets[21] = {64, 128, 64, 64, 64, 64, 64,
+                                          64, 64,  64, 64, 64, 64, 64,
+                                          64, 64,  64, 8,  64, 64, 64};
+const int grpc_stats_histo_start[21] = {
+    0,   64,  192, 256, 320,  384,  448,  512,  576,  640, 704,
+    768, 832, 896, 960, 1024, 1088, 1152, 1160, 1224, 1288};
+const int* const grpc_stats_histo_bucket_boundaries[21] = {
     grpc_stats_table_0, grpc_stats_table_2, grpc_stats_table_4,
     grpc_stats_table_6, grpc_stats_table_4, grpc_stats_table_4,
     grpc_stats_table_6, grpc_stats_table_4, grpc_stats_table_6,
     grpc_stats_table_6, grpc_stats_table_6, grpc_stats_table_6,
-    grpc_stats_table_8};
-void (*const grpc_stats_inc_histogram[13])(int x) = {
+    grpc_stats_table_8, grpc_stats_table_8, grpc_stats_table_8,
+    grpc_stats_table_6, grpc_stats_table_6, grpc_stats_table_10,
+    grpc_stats_table_8, grpc_stats_table_8, grpc_stats_table_12};
+void (*const grpc_stats_inc_histogram[21])(int x) = {
     grpc_stats_inc_call_initial_size,
     grpc_stats_inc_poll_events_returned,
     grpc_stats_inc_tcp_write_size,
@@ -684,4 +956,12 @@ void (*const grpc_stats_inc_histogram[13])(int x) = {
     grpc_stats_inc_http2_send_message_per_write,
     grpc_stats_inc_http2_send_trailing_metadata_per_write,
     grpc_stats_inc_http2_send_flowctl_per_write,
-    grpc_stats_inc_server_cqs_checked};
+    grpc_stats_inc_http2_write_queued_latency,
+    grpc_stats_inc_http2_write_kernel_latency,
+    grpc_stats_inc_http2_write_wire_latency,
+    grpc_stats_inc_combiner_locks_queue_length,
+    grpc_stats_inc_exec_ctx_closures_per_flush,
+    grpc_stats_inc_server_cqs_checked,
+    grpc_stats_inc_handshake_offload_queue_time,
+    grpc_stats_inc_handshake_step_time,
+    grpc_stats_inc_handshake_duration};
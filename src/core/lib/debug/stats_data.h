@@ -125,6 +125,12 @@ typedef enum {
   GRPC_STATS_COUNTER_CQ_EV_QUEUE_TRYLOCK_FAILURES,
   GRPC_STATS_COUNTER_CQ_EV_QUEUE_TRYLOCK_SUCCESSES,
   GRPC_STATS_COUNTER_CQ_EV_QUEUE_TRANSIENT_POP_FAILURES,
+  GRPC_STATS_COUNTER_HANDSHAKE_STEPS_OFFLOADED,
+  GRPC_STATS_COUNTER_HANDSHAKE_OFFLOAD_REJECTED,
+  GRPC_STATS_COUNTER_SSL_CLIENT_HANDSHAKES,
+  GRPC_STATS_COUNTER_SSL_CLIENT_SESSIONS_RESUMED,
+  GRPC_STATS_COUNTER_SSL_SERVER_HANDSHAKES,
+  GRPC_STATS_COUNTER_SSL_SERVER_SESSIONS_RESUMED,
   GRPC_STATS_COUNTER_COUNT
 } grpc_stats_counters;
 extern const char* grpc_stats_counter_name[GRPC_STATS_COUNTER_COUNT];
@@ -142,7 +148,15 @@ typedef enum {
   GRPC_STATS_HISTOGRAM_HTTP2_SEND_MESSAGE_PER_WRITE,
   GRPC_STATS_HISTOGRAM_HTTP2_SEND_TRAILING_METADATA_PER_WRITE,
   GRPC_STATS_HISTOGRAM_HTTP2_SEND_FLOWCTL_PER_WRITE,
+  GRPC_STATS_HISTOGRAM_HTTP2_WRITE_QUEUED_LATENCY,
+  GRPC_STATS_HISTOGRAM_HTTP2_WRITE_KERNEL_LATENCY,
+  GRPC_STATS_HISTOGRAM_HTTP2_WRITE_WIRE_LATENCY,
+  GRPC_STATS_HISTOGRAM_COMBINER_LOCKS_QUEUE_LENGTH,
+  GRPC_STATS_HISTOGRAM_EXEC_CTX_CLOSURES_PER_FLUSH,
   GRPC_STATS_HISTOGRAM_SERVER_CQS_CHECKED,
+  GRPC_STATS_HISTOGRAM_HANDSHAKE_OFFLOAD_QUEUE_TIME,
+  GRPC_STATS_HISTOGRAM_HANDSHAKE_STEP_TIME,
+  GRPC_STATS_HISTOGRAM_HANDSHAKE_DURATION,
   GRPC_STATS_HISTOGRAM_COUNT
 } grpc_stats_histograms;
 extern const char* grpc_stats_histogram_name[GRPC_STATS_HISTOGRAM_COUNT];
@@ -172,9 +186,25 @@ typedef enum {
   GRPC_STATS_HISTOGRAM_HTTP2_SEND_TRAILING_METADATA_PER_WRITE_BUCKETS = 64,
   GRPC_STATS_HISTOGRAM_HTTP2_SEND_FLOWCTL_PER_WRITE_FIRST_SLOT = 768,
   GRPC_STATS_HISTOGRAM_HTTP2_SEND_FLOWCTL_PER_WRITE_BUCKETS = 64,
-  GRPC_STATS_HISTOGRAM_SERVER_CQS_CHECKED_FIRST_SLOT = 832,
+  GRPC_STATS_HISTOGRAM_HTTP2_WRITE_QUEUED_LATENCY_FIRST_SLOT = 832,
+  GRPC_STATS_HISTOGRAM_HTTP2_WRITE_QUEUED_LATENCY_BUCKETS = 64,
+  GRPC_STATS_HISTOGRAM_HTTP2_WRITE_KERNEL_LATENCY_FIRST_SLOT = 896,
+  GRPC_STATS_HISTOGRAM_HTTP2_WRITE_KERNEL_LATENCY_BUCKETS = 64,
+  GRPC_STATS_HISTOGRAM_HTTP2_WRITE_WIRE_LATENCY_FIRST_SLOT = 960,
+  GRPC_STATS_HISTOGRAM_HTTP2_WRITE_WIRE_LATENCY_BUCKETS = 64,
+  GRPC_STATS_HISTOGRAM_COMBINER_LOCKS_QUEUE_LENGTH_FIRST_SLOT = 1024,
+  GRPC_STATS_HISTOGRAM_COMBINER_LOCKS_QUEUE_LENGTH_BUCKETS = 64,
+  GRPC_STATS_HISTOGRAM_EXEC_CTX_CLOSURES_PER_FLUSH_FIRST_SLOT = 1088,
+  GRPC_STATS_HISTOGRAM_EXEC_CTX_CLOSURES_PER_FLUSH_BUCKETS = 64,
+  GRPC_STATS_HISTOGRAM_SERVER_CQS_CHECKED_FIRST_SLOT = 1152,
   GRPC_STATS_HISTOGRAM_SERVER_CQS_CHECKED_BUCKETS = 8,
-  GRPC_STATS_HISTOGRAM_BUCKETS = 840
+  GRPC_STATS_HISTOGRAM_HANDSHAKE_OFFLOAD_QUEUE_TIME_FIRST_SLOT = 1160,
+  GRPC_STATS_HISTOGRAM_HANDSHAKE_OFFLOAD_QUEUE_TIME_BUCKETS = 64,
+  GRPC_STATS_HISTOGRAM_HANDSHAKE_STEP_TIME_FIRST_SLOT = 1224,
+  GRPC_STATS_HISTOGRAM_HANDSHAKE_STEP_TIME_BUCKETS = 64,
+  GRPC_STATS_HISTOGRAM_HANDSHAKE_DURATION_FIRST_SLOT = 1288,
+  GRPC_STATS_HISTOGRAM_HANDSHAKE_DURATION_BUCKETS = 64,
+  GRPC_STATS_HISTOGRAM_BUCKETS = 1352
 } grpc_stats_histogram_constants;
 #if defined(GRPC_COLLECT_STATS) || !defined(NDEBUG)
 #define GRPC_STATS_INC_CLIENT_CALLS_CREATED() \
@@ -395,6 +425,18 @@ typedef enum {
   GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_CQ_EV_QUEUE_TRYLOCK_SUCCESSES)
 #define GRPC_STATS_INC_CQ_EV_QUEUE_TRANSIENT_POP_FAILURES() \
   GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_CQ_EV_QUEUE_TRANSIENT_POP_FAILURES)
+#define GRPC_STATS_INC_HANDSHAKE_STEPS_OFFLOADED() \
+  GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_HANDSHAKE_STEPS_OFFLOADED)
+#define GRPC_STATS_INC_HANDSHAKE_OFFLOAD_REJECTED() \
+  GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_HANDSHAKE_OFFLOAD_REJECTED)
+#define GRPC_STATS_INC_SSL_CLIENT_HANDSHAKES() \
+  GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_SSL_CLIENT_HANDSHAKES)
+#define GRPC_STATS_INC_SSL_CLIENT_SESSIONS_RESUMED() \
+  GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_SSL_CLIENT_SESSIONS_RESUMED)
+#define GRPC_STATS_INC_SSL_SERVER_HANDSHAKES() \
+  GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_SSL_SERVER_HANDSHAKES)
+#define GRPC_STATS_INC_SSL_SERVER_SESSIONS_RESUMED() \
+  GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_SSL_SERVER_SESSIONS_RESUMED)
 #define GRPC_STATS_INC_CALL_INITIAL_SIZE(value) \
   grpc_stats_inc_call_initial_size((int)(value))
 void grpc_stats_inc_call_initial_size(int x);
@@ -431,9 +473,33 @@ void grpc_stats_inc_http2_send_trailing_metadata_per_write(int x);
 #define GRPC_STATS_INC_HTTP2_SEND_FLOWCTL_PER_WRITE(value) \
   grpc_stats_inc_http2_send_flowctl_per_write((int)(value))
 void grpc_stats_inc_http2_send_flowctl_per_write(int x);
+#define GRPC_STATS_INC_HTTP2_WRITE_QUEUED_LATENCY(value) \
+  grpc_stats_inc_http2_write_queued_latency((int)(value))
+void grpc_stats_inc_http2_write_queued_latency(int x);
+#define GRPC_STATS_INC_HTTP2_WRITE_KERNEL_LATENCY(value) \
+  grpc_stats_inc_http2_write_kernel_latency((int)(value))
+void grpc_stats_inc_http2_write_kernel_latency(int x);
+#define GRPC_STATS_INC_HTTP2_WRITE_WIRE_LATENCY(value) \
+  grpc_stats_inc_http2_write_wire_latency((int)(value))
+void grpc_stats_inc_http2_write_wire_latency(int x);
+#define GRPC_STATS_INC_COMBINER_LOCKS_QUEUE_LENGTH(value) \
+  grpc_stats_inc_combiner_locks_queue_length((int)(value))
+void grpc_stats_inc_combiner_locks_queue_length(int x);
+#define GRPC_STATS_INC_EXEC_CTX_CLOSURES_PER_FLUSH(value) \
+  grpc_stats_inc_exec_ctx_closures_per_flush((int)(value))
+void grpc_stats_inc_exec_ctx_closures_per_flush(int x);
 #define GRPC_STATS_INC_SERVER_CQS_CHECKED(value) \
   grpc_stats_inc_server_cqs_checked((int)(value))
 void grpc_stats_inc_server_cqs_checked(int x);
+#define GRPC_STATS_INC_HANDSHAKE_OFFLOAD_QUEUE_TIME(value) \
+  grpc_stats_inc_handshake_offload_queue_time((int)(value))
+void grpc_stats_inc_handshake_offload_queue_time(int x);
+#define GRPC_STATS_INC_HANDSHAKE_STEP_TIME(value) \
+  grpc_stats_inc_handshake_step_time((int)(value))
+void grpc_stats_inc_handshake_step_time(int x);
+#define GRPC_STATS_INC_HANDSHAKE_DURATION(value) \
+  grpc_stats_inc_handshake_duration((int)(value))
+void grpc_stats_inc_handshake_duration(int x);
 #else
 #define GRPC_STATS_INC_CLIENT_CALLS_CREATED()
 #define GRPC_STATS_INC_SERVER_CALLS_CREATED()
@@ -533,6 +599,12 @@ void grpc_stats_inc_server_cqs_checked(int x);
 #define GRPC_STATS_INC_CQ_EV_QUEUE_TRYLOCK_FAILURES()
 #define GRPC_STATS_INC_CQ_EV_QUEUE_TRYLOCK_SUCCESSES()
 #define GRPC_STATS_INC_CQ_EV_QUEUE_TRANSIENT_POP_FAILURES()
+#define GRPC_STATS_INC_HANDSHAKE_STEPS_OFFLOADED()
+#define GRPC_STATS_INC_HANDSHAKE_OFFLOAD_REJECTED()
+#define GRPC_STATS_INC_SSL_CLIENT_HANDSHAKES()
+#define GRPC_STATS_INC_SSL_CLIENT_SESSIONS_RESUMED()
+#define GRPC_STATS_INC_SSL_SERVER_HANDSHAKES()
+#define GRPC_STATS_INC_SSL_SERVER_SESSIONS_RESUMED()
 #define GRPC_STATS_INC_CALL_INITIAL_SIZE(value)
 #define GRPC_STATS_INC_POLL_EVENTS_RETURNED(value)
 #define GRPC_STATS_INC_TCP_WRITE_SIZE(value)
@@ -545,11 +617,19 @@ void grpc_stats_inc_server_cqs_checked(int x);
 #define GRPC_STATS_INC_HTTP2_SEND_MESSAGE_PER_WRITE(value)
 #define GRPC_STATS_INC_HTTP2_SEND_TRAILING_METADATA_PER_WRITE(value)
 #define GRPC_STATS_INC_HTTP2_SEND_FLOWCTL_PER_WRITE(value)
+#define GRPC_STATS_INC_HTTP2_WRITE_QUEUED_LATENCY(value)
+#define GRPC_STATS_INC_HTTP2_WRITE_KERNEL_LATENCY(value)
+#define GRPC_STATS_INC_HTTP2_WRITE_WIRE_LATENCY(value)
+#define GRPC_STATS_INC_COMBINER_LOCKS_QUEUE_LENGTH(value)
+#define GRPC_STATS_INC_EXEC_CTX_CLOSURES_PER_FLUSH(value)
 #define GRPC_STATS_INC_SERVER_CQS_CHECKED(value)
+#define GRPC_STATS_INC_HANDSHAKE_OFFLOAD_QUEUE_TIME(value)
+#define GRPC_STATS_INC_HANDSHAKE_STEP_TIME(value)
+#define GRPC_STATS_INC_HANDSHAKE_DURATION(value)
 #endif /* defined(GRPC_COLLECT_STATS) || !defined(NDEBUG) */
-extern const int grpc_stats_histo_buckets[13];
-extern const int grpc_stats_histo_start[13];
-extern const int* const grpc_stats_histo_bucket_boundaries[13];
-extern void (*const grpc_stats_inc_histogram[13])(int x);
+extern const int grpc_stats_histo_buckets[21];
+extern const int grpc_stats_histo_start[21];
+extern const int* const grpc_stats_histo_bucket_boundaries[21];
+extern void (*const grpc_stats_inc_histogram[21])(int x);
 
 #endif /* GRPC_CORE_LIB_DEBUG_STATS_DATA_H */
@@ -95,4 +95,10 @@ server_requested_calls_per_iteration:FLOAT,
 server_slowpath_requests_queued_per_iteration:FLOAT,
 cq_ev_queue_trylock_failures_per_iteration:FLOAT,
 cq_ev_queue_trylock_successes_per_iteration:FLOAT,
-cq_ev_queue_transient_pop_failures_per_iteration:FLOAT
+cq_ev_queue_transient_pop_failures_per_iteration:FLOAT,
+handshake_steps_offloaded_per_iteration:FLOAT,
+handshake_offload_rejected_per_iteration:FLOAT,
+ssl_client_handshakes_per_iteration:FLOAT,
+ssl_client_sessions_resumed_per_iteration:FLOAT,
+ssl_server_handshakes_per_iteration:FLOAT,
+ssl_server_sessions_resumed_per_iteration:FLOAT
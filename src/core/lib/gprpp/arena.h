@@ -59,6 +59,9 @@ class Arena {
     static constexpr size_t base_size =
         GPR_ROUND_UP_TO_ALIGNMENT_SIZE(sizeof(Arena));
     size = GPR_ROUND_UP_TO_ALIGNMENT_SIZE(size);
+    if (GPR_UNLIKELY(count_allocations_)) {
+      allocation_count_.FetchAdd(1, MemoryOrder::RELAXED);
+    }
     size_t begin = total_used_.FetchAdd(size, MemoryOrder::RELAXED);
     if (begin + size <= initial_zone_size_) {
       return reinterpret_cast<char*>(this) + base_size + begin;
@@ -67,6 +70,19 @@ class Arena {
     }
   }
 
+  // Returns the number of bytes allocated so far.
+  size_t TotalUsed() const { return total_used_.Load(MemoryOrder::RELAXED); }
+
+  // Start counting calls to Alloc(). Counting costs an extra atomic increment
+  // per allocation, so it is only done for arenas that are being profiled.
+  // Must be called before the arena is shared with other threads.
+  void EnableAllocationCounting() { count_allocations_ = true; }
+
+  // Returns the number of allocations made since EnableAllocationCounting().
+  size_t AllocationCount() const {
+    return allocation_count_.Load(MemoryOrder::RELAXED);
+  }
+
   // TODO(roth): We currently assume that all callers need alignment of 16
   // bytes, which may be wrong in some cases. When we have time, we should
   // change this to instead use the alignment of the type being allocated by
@@ -106,6 +122,8 @@ class Arena {
   // hysteresis.
   Atomic<size_t> total_used_;
   size_t initial_zone_size_;
+  bool count_allocations_ = false;
+  Atomic<size_t> allocation_count_{0};
   gpr_spinlock arena_growth_spinlock_ = GPR_SPINLOCK_STATIC_INITIALIZER;
   // If the initial arena allocation wasn't enough, we allocate additional zones
   // in a reverse linked list. Each additional zone consists of (1) a pointer to
@@ -29,6 +29,7 @@
 #include <time.h>
 
 #include "src/core/lib/gprpp/memory.h"
+#include "src/core/lib/gprpp/sync.h"
 
 namespace grpc_core {
 namespace {
@@ -289,6 +290,17 @@ void grpc_tcp_set_write_timestamps_callback(void (*fn)(void*,
                                                        grpc_error* error)) {
   timestamps_callback = fn;
 }
+
+bool grpc_tcp_set_write_timestamps_callback_if_unset(
+    void (*fn)(void*, grpc_core::Timestamps*, grpc_error* error)) {
+  // Serializes concurrent callers; never destroyed.
+  static Mutex* mu = new Mutex();
+  MutexLock lock(mu);
+  if (timestamps_callback == default_timestamps_callback) {
+    timestamps_callback = fn;
+  }
+  return timestamps_callback == fn;
+}
 } /* namespace grpc_core */
 
 #else /* GRPC_LINUX_ERRQUEUE */
@@ -303,6 +315,12 @@ void grpc_tcp_set_write_timestamps_callback(void (*fn)(void*,
   (void)fn;
   gpr_log(GPR_DEBUG, "Timestamps callback is not enabled for this platform");
 }
+
+bool grpc_tcp_set_write_timestamps_callback_if_unset(
+    void (*fn)(void*, grpc_core::Timestamps*, grpc_error* error)) {
+  (void)fn;
+  return false;
+}
 } /* namespace grpc_core */
 
 #endif /* GRPC_LINUX_ERRQUEUE */
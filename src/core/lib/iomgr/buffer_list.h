@@ -160,6 +160,12 @@ void grpc_tcp_set_write_timestamps_callback(void (*fn)(void*,
                                                        grpc_core::Timestamps*,
                                                        grpc_error* error));
 
+/** Sets the callback like grpc_tcp_set_write_timestamps_callback(), unless a
+ *  different one has already been set. Returns true if \a fn is the callback
+ *  afterwards; always false on platforms without timestamps support. */
+bool grpc_tcp_set_write_timestamps_callback_if_unset(
+    void (*fn)(void*, grpc_core::Timestamps*, grpc_error* error));
+
 } /* namespace grpc_core */
 
 #endif /* GRPC_CORE_LIB_IOMGR_BUFFER_LIST_H */
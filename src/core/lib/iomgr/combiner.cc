@@ -133,6 +133,7 @@ static void combiner_exec(grpc_core::Combiner* lock, grpc_closure* cl,
   GRPC_COMBINER_TRACE(gpr_log(GPR_INFO,
                               "C:%p grpc_combiner_execute c=%p last=%" PRIdPTR,
                               lock, cl, last));
+  GRPC_STATS_INC_COMBINER_LOCKS_QUEUE_LENGTH(last / STATE_ELEM_COUNT_LOW_BIT);
   if (last == 1) {
     GRPC_STATS_INC_COMBINER_LOCKS_INITIATED();
     GPR_TIMER_MARK("combiner.initiated", 0);
@@ -178,7 +179,26 @@ static void queue_offload(grpc_core::Combiner* lock) {
   grpc_core::Executor::Run(&lock->offload, GRPC_ERROR_NONE);
 }
 
-bool grpc_combiner_continue_exec_ctx() {
+// Returns true if the closure that was just run as element \a executed of the
+// current batch may be followed by another queued closure without first
+// returning to the exec_ctx. The batch stops whenever the one-at-a-time path
+// would have done something other than immediately run the next queued
+// closure on this combiner: run exec_ctx closures, offload, execute the final
+// list or release the lock.
+static bool combiner_can_continue_batch(grpc_core::Combiner* lock,
+                                        gpr_atm executed) {
+  grpc_core::ExecCtx* exec_ctx = grpc_core::ExecCtx::Get();
+  if (exec_ctx->combiner_data()->active_combiner != lock) return false;
+  if (!grpc_closure_list_empty(*exec_ctx->closure_list())) return false;
+  if (gpr_atm_no_barrier_load(&lock->initiating_exec_ctx_or_null) == 0 &&
+      exec_ctx->IsReadyToFinish()) {
+    return false;
+  }
+  // More than one element must remain once the executed ones are retired.
+  return (gpr_atm_acq_load(&lock->state) >> 1) - executed > 1;
+}
+
+bool grpc_combiner_continue_exec_ctx(int* closures_run) {
   GPR_TIMER_SCOPE("combiner.continue_exec_ctx", 0);
   grpc_core::Combiner* lock =
       grpc_core::ExecCtx::Get()->combiner_data()->active_combiner;
@@ -213,6 +233,7 @@ bool grpc_combiner_continue_exec_ctx() {
     return true;
   }
 
+  gpr_atm executed = 0;
   if (!lock->time_to_execute_final_list ||
       // peek to see if something new has shown up, and execute that with
       // priority
@@ -227,18 +248,31 @@ bool grpc_combiner_continue_exec_ctx() {
       queue_offload(lock);
       return true;
     }
-    GPR_TIMER_SCOPE("combiner.exec1", 0);
-    grpc_closure* cl = reinterpret_cast<grpc_closure*>(n);
-    grpc_error* cl_err = cl->error_data.error;
+    // Drain a batch of queued closures before settling the element count, so
+    // a burst of closures costs one atomic decrement of the state instead of
+    // one per closure.
+    for (;;) {
+      GPR_TIMER_SCOPE("combiner.exec1", 0);
+      grpc_closure* cl = reinterpret_cast<grpc_closure*>(n);
+      grpc_error* cl_err = cl->error_data.error;
 #ifndef NDEBUG
-    cl->scheduled = false;
+      cl->scheduled = false;
 #endif
-    cl->cb(cl->cb_arg, cl_err);
-    GRPC_ERROR_UNREF(cl_err);
+      cl->cb(cl->cb_arg, cl_err);
+      GRPC_ERROR_UNREF(cl_err);
+      ++executed;
+      if (!combiner_can_continue_batch(lock, executed)) break;
+      n = lock->queue.Pop();
+      if (n == nullptr) break;
+    }
+    *closures_run += static_cast<int>(executed);
+    GRPC_COMBINER_TRACE(gpr_log(GPR_INFO, "C:%p executed batch of %" PRIdPTR,
+                                lock, executed));
   } else {
     grpc_closure* c = lock->final_list.head;
     GPR_ASSERT(c != nullptr);
     grpc_closure_list_init(&lock->final_list);
+    executed = 1;
     int loops = 0;
     while (c != nullptr) {
       GPR_TIMER_SCOPE("combiner.exec_1final", 0);
@@ -251,6 +285,7 @@ bool grpc_combiner_continue_exec_ctx() {
 #endif
       c->cb(c->cb_arg, error);
       GRPC_ERROR_UNREF(error);
+      ++*closures_run;
       c = next;
     }
   }
@@ -258,8 +293,11 @@ bool grpc_combiner_continue_exec_ctx() {
   GPR_TIMER_MARK("unref", 0);
   move_next();
   lock->time_to_execute_final_list = false;
-  gpr_atm old_state =
-      gpr_atm_full_fetch_add(&lock->state, -STATE_ELEM_COUNT_LOW_BIT);
+  gpr_atm old_state = gpr_atm_full_fetch_add(
+      &lock->state, -executed * STATE_ELEM_COUNT_LOW_BIT);
+  // Decide what to do next as if the batch had been retired one element at a
+  // time: only the final decrement can observe the interesting transitions.
+  old_state -= (executed - 1) * STATE_ELEM_COUNT_LOW_BIT;
   GRPC_COMBINER_TRACE(
       gpr_log(GPR_INFO, "C:%p finish old_state=%" PRIdPTR, lock, old_state));
 // Define a macro to ease readability of the following switch statement.
@@ -81,7 +81,10 @@ grpc_core::Combiner* grpc_combiner_ref(
     grpc_core::Combiner* lock GRPC_COMBINER_DEBUG_ARGS);
 void grpc_combiner_unref(grpc_core::Combiner* lock GRPC_COMBINER_DEBUG_ARGS);
 
-bool grpc_combiner_continue_exec_ctx();
+// Runs the next step of the active combiner, if any; returns false if there
+// is none. Adds the number of closures run to \a closures_run: zero when the
+// remaining work was offloaded to the executor.
+bool grpc_combiner_continue_exec_ctx(int* closures_run);
 
 extern grpc_core::DebugOnlyTraceFlag grpc_combiner_trace;
 
@@ -0,0 +1,94 @@
+/*
+ *
+ * Copyright 2020 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef GRPC_CORE_LIB_IOMGR_ENDPOINT_SHM_H
+#define GRPC_CORE_LIB_IOMGR_ENDPOINT_SHM_H
+
+/*
+   Shared-memory endpoint
+
+   Connects two endpoints, usually in different processes on the same host,
+   through a pair of single-producer/single-consumer byte rings in a
+   memfd-backed region.  Each side owns an eventfd "doorbell" that the peer
+   rings when it has produced data into, or freed space in, a ring that this
+   side is blocked on.  No syscalls are made while both sides keep up with
+   each other.
+
+   The endpoint carries an opaque byte stream, exactly like a TCP endpoint, so
+   chttp2 runs over it unchanged.
+*/
+
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+
+#include "src/core/lib/iomgr/endpoint.h"
+#include "src/core/lib/iomgr/endpoint_pair.h"
+#include "src/core/lib/iomgr/port.h"
+
+#if defined(GRPC_LINUX_MEMFD) && defined(GRPC_LINUX_EVENTFD)
+#define GRPC_HAVE_SHM_ENDPOINT 1
+#endif
+
+#ifdef GRPC_HAVE_SHM_ENDPOINT
+
+#include <fcntl.h>
+
+#include "src/core/lib/iomgr/ev_posix.h"
+
+/* Seals that the region must carry before it is mapped.  They stop either
+   side from resizing the region under the other's mapping. */
+#define GRPC_SHM_ENDPOINT_REQUIRED_SEALS \
+  (F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_SEAL)
+
+/* Default capacity of each of the two rings. */
+#define GRPC_SHM_ENDPOINT_DEFAULT_RING_SIZE (1024 * 1024)
+
+/* The file descriptors that make up one shared-memory connection. */
+struct grpc_shm_endpoint_fds {
+  int memfd = -1;
+  int client_doorbell = -1;
+  int server_doorbell = -1;
+  size_t ring_size = 0;
+};
+
+/* Creates, sizes and seals the region and creates the two doorbells for a new
+   connection.  ring_size must be a power of two. */
+grpc_error* grpc_shm_endpoint_fds_create(size_t ring_size,
+                                         grpc_shm_endpoint_fds* fds);
+
+/* Closes every valid descriptor in fds. */
+void grpc_shm_endpoint_fds_close(grpc_shm_endpoint_fds* fds);
+
+/* Maps the region described by fds and creates one side of the connection.
+   Takes ownership of all descriptors in fds and, if non-null, of
+   peer_socket: a socket that is kept open for the lifetime of the
+   connection only so that the death of the peer process is noticed. */
+grpc_error* grpc_shm_endpoint_create(grpc_shm_endpoint_fds* fds,
+                                     bool is_client, grpc_fd* peer_socket,
+                                     const grpc_channel_args* args,
+                                     const char* peer_string,
+                                     grpc_endpoint** endpoint);
+
+/* Creates both sides of a shared-memory connection within this process. */
+grpc_endpoint_pair grpc_shm_endpoint_create_pair(const char* name,
+                                                 grpc_channel_args* args);
+
+#endif /* GRPC_HAVE_SHM_ENDPOINT */
+
+#endif /* GRPC_CORE_LIB_IOMGR_ENDPOINT_SHM_H */
@@ -0,0 +1,639 @@
+/*
+ *
+ * Copyright 2020 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/iomgr/endpoint_shm.h"
+
+#ifdef GRPC_HAVE_SHM_ENDPOINT
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <string>
+
+#include "absl/strings/str_cat.h"
+
+#include <grpc/support/alloc.h>
+#include <grpc/support/log.h>
+#include <grpc/support/string_util.h>
+#include <grpc/support/sync.h>
+
+#include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/iomgr/error.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/iomgr/resource_quota.h"
+#include "src/core/lib/slice/slice_internal.h"
+
+namespace {
+
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2 && ATOMIC_INT_LOCK_FREE == 2,
+              "shared-memory rings need address-free atomics");
+
+// Control block of one ring.  Positions count bytes ever produced or
+// consumed, so the ring is empty when they are equal and full when they are
+// ring_size apart.  Fields written by different sides live in different
+// cache lines.
+struct ShmRing {
+  std::atomic<uint64_t> head;  // Written by the producer.
+  char pad0[64 - sizeof(std::atomic<uint64_t>)];
+  std::atomic<uint64_t> tail;  // Written by the consumer.
+  char pad1[64 - sizeof(std::atomic<uint64_t>)];
+  // Set by a side before it waits on its doorbell, so that the other side
+  // knows to ring it.
+  std::atomic<uint32_t> consumer_waiting;
+  std::atomic<uint32_t> producer_waiting;
+  // Set by the producer once it will not write any more.
+  std::atomic<uint32_t> closed;
+  char pad2[64 - 3 * sizeof(std::atomic<uint32_t>)];
+};
+
+// Region layout: the client-to-server and server-to-client control blocks,
+// followed by the two data rings in the same order.
+size_t RegionSize(size_t ring_size) {
+  return 2 * sizeof(ShmRing) + 2 * ring_size;
+}
+
+struct ShmEndpoint {
+  grpc_endpoint base;
+  grpc_core::RefCount refs;
+  gpr_mu mu;
+
+  char* region = nullptr;
+  size_t region_size = 0;
+  size_t ring_size = 0;
+  // The ring this side reads from and the one it writes to.
+  ShmRing* in = nullptr;
+  char* in_data = nullptr;
+  ShmRing* out = nullptr;
+  char* out_data = nullptr;
+  // Private copies of the ring positions.  The peer can write anything to the
+  // shared control blocks, so this side never reads back its own positions
+  // and only accepts peer positions that move forward within bounds.
+  uint64_t in_head = 0;
+  uint64_t in_tail = 0;
+  uint64_t out_head = 0;
+  uint64_t out_tail = 0;
+
+  grpc_fd* doorbell = nullptr;
+  int peer_doorbell = -1;
+  grpc_fd* peer_socket = nullptr;
+  bool doorbell_armed = false;
+  grpc_closure on_doorbell;
+  grpc_closure on_peer_socket;
+  bool peer_gone = false;
+
+  grpc_slice_buffer* read_buffer = nullptr;
+  grpc_closure* read_cb = nullptr;
+  // Reads are charged to the resource quota before they leave the ring.
+  grpc_resource_user_slice_allocator slice_allocator;
+  grpc_slice_buffer read_staging;
+  bool read_allocating = false;
+  grpc_slice_buffer* write_buffer = nullptr;
+  grpc_closure* write_cb = nullptr;
+  // Progress through write_buffer.
+  size_t write_slice = 0;
+  size_t write_offset = 0;
+
+  grpc_error* shutdown_error = GRPC_ERROR_NONE;
+  std::string peer;
+  grpc_resource_user* resource_user = nullptr;
+};
+
+void Unref(ShmEndpoint* ep) {
+  if (!ep->refs.Unref()) return;
+  munmap(ep->region, ep->region_size);
+  close(ep->peer_doorbell);
+  grpc_slice_buffer_destroy_internal(&ep->read_staging);
+  grpc_resource_user_unref(ep->resource_user);
+  GRPC_ERROR_UNREF(ep->shutdown_error);
+  gpr_mu_destroy(&ep->mu);
+  delete ep;
+}
+
+void RingPeer(ShmEndpoint* ep) {
+  const uint64_t one = 1;
+  ssize_t result;
+  do {
+    result = write(ep->peer_doorbell, &one, sizeof(one));
+  } while (result < 0 && errno == EINTR);
+  // EAGAIN means the counter is saturated, i.e. the peer is already due to
+  // wake up.
+}
+
+// Copies count bytes at stream position pos out of a ring.
+void CopyFromRing(const char* data, size_t ring_size, uint64_t pos, char* dst,
+                  size_t count) {
+  const size_t offset = pos & (ring_size - 1);
+  const size_t first = GPR_MIN(count, ring_size - offset);
+  memcpy(dst, data + offset, first);
+  memcpy(dst + first, data, count - first);
+}
+
+// Copies count bytes to stream position pos of a ring.
+void CopyToRing(char* data, size_t ring_size, uint64_t pos, const char* src,
+                size_t count) {
+  const size_t offset = pos & (ring_size - 1);
+  const size_t first = GPR_MIN(count, ring_size - offset);
+  memcpy(data + offset, src, first);
+  memcpy(data, src + first, count - first);
+}
+
+// Returns whether a position published by the peer is plausible: it may
+// only move forward from the last value seen and never past limit.
+bool PeerPositionValid(uint64_t pos, uint64_t last, uint64_t limit) {
+  return pos - last <= limit - last;
+}
+
+// Loads the producer position of the incoming ring into ep->in_head.
+// Returns false if the peer has corrupted it.
+bool LoadInHeadLocked(ShmEndpoint* ep, std::memory_order order) {
+  const uint64_t head = ep->in->head.load(order);
+  if (!PeerPositionValid(head, ep->in_head, ep->in_tail + ep->ring_size)) {
+    return false;
+  }
+  ep->in_head = head;
+  return true;
+}
+
+// Loads the consumer position of the outgoing ring into ep->out_tail.
+// Returns false if the peer has corrupted it.
+bool LoadOutTailLocked(ShmEndpoint* ep, std::memory_order order) {
+  const uint64_t tail = ep->out->tail.load(order);
+  if (!PeerPositionValid(tail, ep->out_tail, ep->out_head)) return false;
+  ep->out_tail = tail;
+  return true;
+}
+
+void ShutdownLocked(ShmEndpoint* ep, grpc_error* why);
+
+// Fails the endpoint, including any pending read and write.  Always returns
+// true, as the pending operations are complete.
+bool FailCorruptedRingLocked(ShmEndpoint* ep) {
+  ShutdownLocked(ep, GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+                         "Shared-memory ring corrupted by peer"));
+  return true;
+}
+
+// Tries to complete the pending read.  Returns false if it has to wait for
+// the peer.
+bool TryReadLocked(ShmEndpoint* ep) {
+  // OnReadAllocated picks the read up again.
+  if (ep->read_allocating) return true;
+  if (!LoadInHeadLocked(ep, std::memory_order_acquire)) {
+    return FailCorruptedRingLocked(ep);
+  }
+  if (ep->in_head == ep->in_tail) {
+    // Announce that we are about to wait, then look again: the producer
+    // either sees the flag or we see its data.  The producer closes only
+    // after its last write, so loading closed first cannot lose data.
+    ep->in->consumer_waiting.store(1);
+    const bool closed = ep->in->closed.load() != 0;
+    if (!LoadInHeadLocked(ep, std::memory_order_seq_cst)) {
+      return FailCorruptedRingLocked(ep);
+    }
+    if (ep->in_head == ep->in_tail) {
+      if (!closed && !ep->peer_gone) return false;
+      grpc_core::ExecCtx::Run(
+          DEBUG_LOCATION, ep->read_cb,
+          GRPC_ERROR_CREATE_FROM_STATIC_STRING("Shared-memory peer closed"));
+      ep->read_cb = nullptr;
+      return true;
+    }
+    ep->in->consumer_waiting.store(0, std::memory_order_relaxed);
+  }
+  if (ep->read_staging.count == 0 &&
+      !grpc_resource_user_alloc_slices(
+          &ep->slice_allocator, static_cast<size_t>(ep->in_head - ep->in_tail),
+          1, &ep->read_staging)) {
+    ep->read_allocating = true;
+    ep->refs.Ref();
+    return true;
+  }
+  // The staged slice was sized from an earlier head, which can only have
+  // moved forward since.
+  grpc_slice slice = grpc_slice_buffer_take_first(&ep->read_staging);
+  const size_t count = GRPC_SLICE_LENGTH(slice);
+  CopyFromRing(ep->in_data, ep->ring_size, ep->in_tail,
+               reinterpret_cast<char*>(GRPC_SLICE_START_PTR(slice)), count);
+  ep->in_tail += count;
+  ep->in->tail.store(ep->in_tail);
+  if (ep->in->producer_waiting.exchange(0) != 0) RingPeer(ep);
+  grpc_slice_buffer_add(ep->read_buffer, slice);
+  grpc_core::ExecCtx::Run(DEBUG_LOCATION, ep->read_cb, GRPC_ERROR_NONE);
+  ep->read_cb = nullptr;
+  return true;
+}
+
+// Copies as much of the pending write as fits.  Returns false if the rest
+// has to wait for the peer to free up space.
+bool TryWriteLocked(ShmEndpoint* ep) {
+  // A peer that has closed its side will not read any more either.
+  if (ep->peer_gone || ep->in->closed.load() != 0) {
+    grpc_core::ExecCtx::Run(
+        DEBUG_LOCATION, ep->write_cb,
+        GRPC_ERROR_CREATE_FROM_STATIC_STRING("Shared-memory peer closed"));
+    ep->write_cb = nullptr;
+    return true;
+  }
+  bool wrote = false;
+  bool done = true;
+  while (ep->write_slice < ep->write_buffer->count) {
+    const grpc_slice& slice = ep->write_buffer->slices[ep->write_slice];
+    if (!LoadOutTailLocked(ep, std::memory_order_acquire)) {
+      return FailCorruptedRingLocked(ep);
+    }
+    size_t space =
+        ep->ring_size - static_cast<size_t>(ep->out_head - ep->out_tail);
+    if (space == 0) {
+      ep->out->producer_waiting.store(1);
+      if (!LoadOutTailLocked(ep, std::memory_order_seq_cst)) {
+        return FailCorruptedRingLocked(ep);
+      }
+      space = ep->ring_size - static_cast<size_t>(ep->out_head - ep->out_tail);
+      if (space == 0) {
+        done = false;
+        break;
+      }
+      ep->out->producer_waiting.store(0, std::memory_order_relaxed);
+    }
+    const size_t count =
+        GPR_MIN(space, GRPC_SLICE_LENGTH(slice) - ep->write_offset);
+    CopyToRing(ep->out_data, ep->ring_size, ep->out_head,
+               reinterpret_cast<const char*>(GRPC_SLICE_START_PTR(slice)) +
+                   ep->write_offset,
+               count);
+    ep->out_head += count;
+    ep->out->head.store(ep->out_head);
+    wrote = true;
+    ep->write_offset += count;
+    if (ep->write_offset == GRPC_SLICE_LENGTH(slice)) {
+      ++ep->write_slice;
+      ep->write_offset = 0;
+    }
+  }
+  if (wrote && ep->out->consumer_waiting.exchange(0) != 0) RingPeer(ep);
+  if (!done) return false;
+  grpc_core::ExecCtx::Run(DEBUG_LOCATION, ep->write_cb, GRPC_ERROR_NONE);
+  ep->write_cb = nullptr;
+  return true;
+}
+
+void OnDoorbell(void* arg, grpc_error* error);
+
+void MaybeArmDoorbellLocked(ShmEndpoint* ep) {
+  if (ep->doorbell_armed || ep->shutdown_error != GRPC_ERROR_NONE) return;
+  if (ep->read_cb == nullptr && ep->write_cb == nullptr) return;
+  ep->doorbell_armed = true;
+  ep->refs.Ref();
+  grpc_fd_notify_on_read(ep->doorbell, &ep->on_doorbell);
+}
+
+void OnDoorbell(void* arg, grpc_error* error) {
+  ShmEndpoint* ep = static_cast<ShmEndpoint*>(arg);
+  gpr_mu_lock(&ep->mu);
+  ep->doorbell_armed = false;
+  if (error == GRPC_ERROR_NONE && ep->shutdown_error == GRPC_ERROR_NONE) {
+    // Reset the eventfd counter; the rings themselves say what changed.
+    uint64_t value;
+    ssize_t result;
+    do {
+      result = read(grpc_fd_wrapped_fd(ep->doorbell), &value, sizeof(value));
+    } while (result < 0 && errno == EINTR);
+    if (ep->read_cb != nullptr) TryReadLocked(ep);
+    if (ep->write_cb != nullptr) TryWriteLocked(ep);
+    MaybeArmDoorbellLocked(ep);
+  }
+  gpr_mu_unlock(&ep->mu);
+  Unref(ep);
+}
+
+void OnReadAllocated(void* arg, grpc_error* error) {
+  ShmEndpoint* ep = static_cast<ShmEndpoint*>(arg);
+  gpr_mu_lock(&ep->mu);
+  ep->read_allocating = false;
+  if (ep->read_cb != nullptr) {
+    if (error != GRPC_ERROR_NONE) {
+      grpc_core::ExecCtx::Run(DEBUG_LOCATION, ep->read_cb,
+                              GRPC_ERROR_REF(error));
+      ep->read_cb = nullptr;
+    } else if (!TryReadLocked(ep)) {
+      MaybeArmDoorbellLocked(ep);
+    }
+  }
+  gpr_mu_unlock(&ep->mu);
+  Unref(ep);
+}
+
+// The peer socket never carries data after the handshake, so it only
+// becomes readable when the peer goes away.
+void OnPeerSocket(void* arg, grpc_error* error) {
+  ShmEndpoint* ep = static_cast<ShmEndpoint*>(arg);
+  gpr_mu_lock(&ep->mu);
+  if (error == GRPC_ERROR_NONE && ep->shutdown_error == GRPC_ERROR_NONE) {
+    ep->peer_gone = true;
+    if (ep->read_cb != nullptr) TryReadLocked(ep);
+    if (ep->write_cb != nullptr) TryWriteLocked(ep);
+  }
+  gpr_mu_unlock(&ep->mu);
+  Unref(ep);
+}
+
+void ShmRead(grpc_endpoint* base, grpc_slice_buffer* slices, grpc_closure* cb,
+             bool /*urgent*/) {
+  ShmEndpoint* ep = reinterpret_cast<ShmEndpoint*>(base);
+  grpc_slice_buffer_reset_and_unref_internal(slices);
+  gpr_mu_lock(&ep->mu);
+  GPR_ASSERT(ep->read_cb == nullptr);
+  if (ep->shutdown_error != GRPC_ERROR_NONE) {
+    grpc_core::ExecCtx::Run(DEBUG_LOCATION, cb,
+                            GRPC_ERROR_REF(ep->shutdown_error));
+  } else {
+    ep->read_buffer = slices;
+    ep->read_cb = cb;
+    if (!TryReadLocked(ep)) MaybeArmDoorbellLocked(ep);
+  }
+  gpr_mu_unlock(&ep->mu);
+}
+
+void ShmWrite(grpc_endpoint* base, grpc_slice_buffer* slices, grpc_closure* cb,
+              void* /*arg*/) {
+  ShmEndpoint* ep = reinterpret_cast<ShmEndpoint*>(base);
+  gpr_mu_lock(&ep->mu);
+  GPR_ASSERT(ep->write_cb == nullptr);
+  if (ep->shutdown_error != GRPC_ERROR_NONE) {
+    grpc_core::ExecCtx::Run(DEBUG_LOCATION, cb,
+                            GRPC_ERROR_REF(ep->shutdown_error));
+  } else if (slices->length == 0) {
+    grpc_core::ExecCtx::Run(DEBUG_LOCATION, cb, GRPC_ERROR_NONE);
+  } else {
+    ep->write_buffer = slices;
+    ep->write_cb = cb;
+    ep->write_slice = 0;
+    ep->write_offset = 0;
+    if (!TryWriteLocked(ep)) MaybeArmDoorbellLocked(ep);
+  }
+  gpr_mu_unlock(&ep->mu);
+}
+
+void ShmAddToPollset(grpc_endpoint* base, grpc_pollset* pollset) {
+  ShmEndpoint* ep = reinterpret_cast<ShmEndpoint*>(base);
+  grpc_pollset_add_fd(pollset, ep->doorbell);
+  if (ep->peer_socket != nullptr) {
+    grpc_pollset_add_fd(pollset, ep->peer_socket);
+  }
+}
+
+void ShmAddToPollsetSet(grpc_endpoint* base, grpc_pollset_set* pollset_set) {
+  ShmEndpoint* ep = reinterpret_cast<ShmEndpoint*>(base);
+  grpc_pollset_set_add_fd(pollset_set, ep->doorbell);
+  if (ep->peer_socket != nullptr) {
+    grpc_pollset_set_add_fd(pollset_set, ep->peer_socket);
+  }
+}
+
+void ShmDeleteFromPollsetSet(grpc_endpoint* base,
+                             grpc_pollset_set* pollset_set) {
+  ShmEndpoint* ep = reinterpret_cast<ShmEndpoint*>(base);
+  grpc_pollset_set_del_fd(pollset_set, ep->doorbell);
+  if (ep->peer_socket != nullptr) {
+    grpc_pollset_set_del_fd(pollset_set, ep->peer_socket);
+  }
+}
+
+void ShutdownLocked(ShmEndpoint* ep, grpc_error* why) {
+  if (ep->shutdown_error != GRPC_ERROR_NONE) {
+    GRPC_ERROR_UNREF(why);
+    return;
+  }
+  ep->shutdown_error = why;
+  // Let the peer's reads fail instead of waiting forever.
+  ep->out->closed.store(1);
+  RingPeer(ep);
+  if (ep->read_cb != nullptr) {
+    grpc_core::ExecCtx::Run(DEBUG_LOCATION, ep->read_cb, GRPC_ERROR_REF(why));
+    ep->read_cb = nullptr;
+  }
+  if (ep->write_cb != nullptr) {
+    grpc_core::ExecCtx::Run(DEBUG_LOCATION, ep->write_cb,
+                            GRPC_ERROR_REF(why));
+    ep->write_cb = nullptr;
+  }
+  grpc_fd_shutdown(ep->doorbell, GRPC_ERROR_REF(why));
+  if (ep->peer_socket != nullptr) {
+    grpc_fd_shutdown(ep->peer_socket, GRPC_ERROR_REF(why));
+  }
+  grpc_resource_user_shutdown(ep->resource_user);
+}
+
+void ShmShutdown(grpc_endpoint* base, grpc_error* why) {
+  ShmEndpoint* ep = reinterpret_cast<ShmEndpoint*>(base);
+  gpr_mu_lock(&ep->mu);
+  ShutdownLocked(ep, why);
+  gpr_mu_unlock(&ep->mu);
+}
+
+void ShmDestroy(grpc_endpoint* base) {
+  ShmEndpoint* ep = reinterpret_cast<ShmEndpoint*>(base);
+  gpr_mu_lock(&ep->mu);
+  ShutdownLocked(ep,
+                 GRPC_ERROR_CREATE_FROM_STATIC_STRING("Endpoint destroyed"));
+  grpc_fd_orphan(ep->doorbell, nullptr, nullptr, "shm_endpoint_destroyed");
+  if (ep->peer_socket != nullptr) {
+    grpc_fd_orphan(ep->peer_socket, nullptr, nullptr,
+                   "shm_endpoint_destroyed");
+  }
+  gpr_mu_unlock(&ep->mu);
+  Unref(ep);
+}
+
+grpc_resource_user* ShmGetResourceUser(grpc_endpoint* base) {
+  return reinterpret_cast<ShmEndpoint*>(base)->resource_user;
+}
+
+char* ShmGetPeer(grpc_endpoint* base) {
+  return gpr_strdup(reinterpret_cast<ShmEndpoint*>(base)->peer.c_str());
+}
+
+int ShmGetFd(grpc_endpoint* /*base*/) { return -1; }
+
+bool ShmCanTrackErr(grpc_endpoint* /*base*/) { return false; }
+
+const grpc_endpoint_vtable kShmVtable = {ShmRead,
+                                         ShmWrite,
+                                         ShmAddToPollset,
+                                         ShmAddToPollsetSet,
+                                         ShmDeleteFromPollsetSet,
+                                         ShmShutdown,
+                                         ShmDestroy,
+                                         ShmGetResourceUser,
+                                         ShmGetPeer,
+                                         ShmGetFd,
+                                         ShmCanTrackErr};
+
+}  // namespace
+
+grpc_error* grpc_shm_endpoint_fds_create(size_t ring_size,
+                                         grpc_shm_endpoint_fds* fds) {
+  GPR_ASSERT(ring_size > 0 && (ring_size & (ring_size - 1)) == 0);
+  fds->ring_size = ring_size;
+  fds->memfd =
+      memfd_create("grpc_shm_endpoint", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+  if (fds->memfd < 0) return GRPC_OS_ERROR(errno, "memfd_create");
+  // The region starts out zeroed, which is the initial state of both rings.
+  if (ftruncate(fds->memfd, static_cast<off_t>(RegionSize(ring_size))) != 0) {
+    grpc_error* error = GRPC_OS_ERROR(errno, "ftruncate");
+    grpc_shm_endpoint_fds_close(fds);
+    return error;
+  }
+  // Freeze the size before the peer gets the fd: a peer that could shrink the
+  // region would make our next access to the mapping raise SIGBUS.
+  if (fcntl(fds->memfd, F_ADD_SEALS, GRPC_SHM_ENDPOINT_REQUIRED_SEALS) != 0) {
+    grpc_error* error = GRPC_OS_ERROR(errno, "fcntl(F_ADD_SEALS)");
+    grpc_shm_endpoint_fds_close(fds);
+    return error;
+  }
+  fds->client_doorbell = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  fds->server_doorbell = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  if (fds->client_doorbell < 0 || fds->server_doorbell < 0) {
+    grpc_error* error = GRPC_OS_ERROR(errno, "eventfd");
+    grpc_shm_endpoint_fds_close(fds);
+    return error;
+  }
+  return GRPC_ERROR_NONE;
+}
+
+void grpc_shm_endpoint_fds_close(grpc_shm_endpoint_fds* fds) {
+  for (int* fd : {&fds->memfd, &fds->client_doorbell, &fds->server_doorbell}) {
+    if (*fd >= 0) close(*fd);
+    *fd = -1;
+  }
+}
+
+grpc_error* grpc_shm_endpoint_create(grpc_shm_endpoint_fds* fds,
+                                     bool is_client, grpc_fd* peer_socket,
+                                     const grpc_channel_args* args,
+                                     const char* peer_string,
+                                     grpc_endpoint** endpoint) {
+  const size_t ring_size = fds->ring_size;
+  const size_t region_size = RegionSize(ring_size);
+  struct stat st;
+  grpc_error* error = GRPC_ERROR_NONE;
+  if (ring_size == 0 || (ring_size & (ring_size - 1)) != 0) {
+    error = GRPC_ERROR_CREATE_FROM_STATIC_STRING("Invalid ring size");
+  } else if (fstat(fds->memfd, &st) != 0) {
+    error = GRPC_OS_ERROR(errno, "fstat");
+  } else if (static_cast<size_t>(st.st_size) < region_size) {
+    error = GRPC_ERROR_CREATE_FROM_STATIC_STRING("Region too small");
+  }
+  void* region = MAP_FAILED;
+  if (error == GRPC_ERROR_NONE) {
+    region = mmap(nullptr, region_size, PROT_READ | PROT_WRITE, MAP_SHARED,
+                  fds->memfd, 0);
+    if (region == MAP_FAILED) error = GRPC_OS_ERROR(errno, "mmap");
+  }
+  if (error != GRPC_ERROR_NONE) {
+    grpc_shm_endpoint_fds_close(fds);
+    if (peer_socket != nullptr) {
+      grpc_fd_orphan(peer_socket, nullptr, nullptr, "shm_endpoint_failed");
+    }
+    return error;
+  }
+  ShmEndpoint* ep = new ShmEndpoint();
+  ep->base.vtable = &kShmVtable;
+  gpr_mu_init(&ep->mu);
+  ep->region = static_cast<char*>(region);
+  ep->region_size = region_size;
+  ep->ring_size = ring_size;
+  ShmRing* client_to_server = reinterpret_cast<ShmRing*>(ep->region);
+  ShmRing* server_to_client = client_to_server + 1;
+  char* client_to_server_data = ep->region + 2 * sizeof(ShmRing);
+  char* server_to_client_data = client_to_server_data + ring_size;
+  ep->in = is_client ? server_to_client : client_to_server;
+  ep->in_data = is_client ? server_to_client_data : client_to_server_data;
+  ep->out = is_client ? client_to_server : server_to_client;
+  ep->out_data = is_client ? client_to_server_data : server_to_client_data;
+  ep->peer = peer_string;
+  std::string name = absl::StrCat("shm:", is_client ? "client:" : "server:",
+                                  peer_string);
+  ep->doorbell = grpc_fd_create(
+      is_client ? fds->client_doorbell : fds->server_doorbell, name.c_str(),
+      false);
+  ep->peer_doorbell = is_client ? fds->server_doorbell : fds->client_doorbell;
+  // The mapping keeps the region alive.
+  close(fds->memfd);
+  *fds = grpc_shm_endpoint_fds();
+  GRPC_CLOSURE_INIT(&ep->on_doorbell, OnDoorbell, ep,
+                    grpc_schedule_on_exec_ctx);
+  grpc_resource_quota* resource_quota =
+      args == nullptr ? grpc_resource_quota_create(nullptr)
+                      : grpc_resource_quota_from_channel_args(args);
+  ep->resource_user = grpc_resource_user_create(resource_quota, name.c_str());
+  grpc_resource_quota_unref_internal(resource_quota);
+  grpc_resource_user_slice_allocator_init(&ep->slice_allocator,
+                                          ep->resource_user, OnReadAllocated,
+                                          ep);
+  grpc_slice_buffer_init(&ep->read_staging);
+  ep->peer_socket = peer_socket;
+  if (peer_socket != nullptr) {
+    GRPC_CLOSURE_INIT(&ep->on_peer_socket, OnPeerSocket, ep,
+                      grpc_schedule_on_exec_ctx);
+    ep->refs.Ref();
+    grpc_fd_notify_on_read(peer_socket, &ep->on_peer_socket);
+  }
+  *endpoint = &ep->base;
+  return GRPC_ERROR_NONE;
+}
+
+grpc_endpoint_pair grpc_shm_endpoint_create_pair(const char* name,
+                                                 grpc_channel_args* args) {
+  grpc_core::ExecCtx exec_ctx;
+  grpc_shm_endpoint_fds client_fds;
+  GPR_ASSERT(GRPC_LOG_IF_ERROR(
+      "grpc_shm_endpoint_fds_create",
+      grpc_shm_endpoint_fds_create(GRPC_SHM_ENDPOINT_DEFAULT_RING_SIZE,
+                                   &client_fds)));
+  grpc_shm_endpoint_fds server_fds;
+  server_fds.ring_size = client_fds.ring_size;
+  server_fds.memfd = dup(client_fds.memfd);
+  server_fds.client_doorbell = dup(client_fds.client_doorbell);
+  server_fds.server_doorbell = dup(client_fds.server_doorbell);
+  GPR_ASSERT(server_fds.memfd >= 0 && server_fds.client_doorbell >= 0 &&
+             server_fds.server_doorbell >= 0);
+  grpc_endpoint_pair p;
+  std::string peer = absl::StrCat(name, ":server");
+  GPR_ASSERT(GRPC_LOG_IF_ERROR(
+      "grpc_shm_endpoint_create",
+      grpc_shm_endpoint_create(&client_fds, true, nullptr, args, peer.c_str(),
+                               &p.client)));
+  peer = absl::StrCat(name, ":client");
+  GPR_ASSERT(GRPC_LOG_IF_ERROR(
+      "grpc_shm_endpoint_create",
+      grpc_shm_endpoint_create(&server_fds, false, nullptr, args, peer.c_str(),
+                               &p.server)));
+  return p;
+}
+
+#endif /* GRPC_HAVE_SHM_ENDPOINT */
@@ -23,6 +23,7 @@
 #include <grpc/support/log.h>
 #include <grpc/support/sync.h>
 
+#include "src/core/lib/debug/stats.h"
 #include "src/core/lib/gprpp/thd.h"
 #include "src/core/lib/iomgr/combiner.h"
 #include "src/core/lib/profiling/timers.h"
@@ -141,6 +142,7 @@ void ExecCtx::GlobalInit(void) {
 
 bool ExecCtx::Flush() {
   bool did_something = 0;
+  int closures_run = 0;
   GPR_TIMER_SCOPE("grpc_exec_ctx_flush", 0);
   for (;;) {
     if (!grpc_closure_list_empty(closure_list_)) {
@@ -150,14 +152,19 @@ bool ExecCtx::Flush() {
         grpc_closure* next = c->next_data.next;
         grpc_error* error = c->error_data.error;
         did_something = true;
+        ++closures_run;
         exec_ctx_run(c, error);
         c = next;
       }
-    } else if (!grpc_combiner_continue_exec_ctx()) {
+    } else if (!grpc_combiner_continue_exec_ctx(&closures_run)) {
       break;
     }
   }
   GPR_ASSERT(combiner_data_.active_combiner == nullptr);
+  // ExecCtxs may be flushed outside of grpc_init()/grpc_shutdown().
+  if (closures_run > 0 && grpc_stats_per_cpu_storage != nullptr) {
+    GRPC_STATS_INC_EXEC_CTX_CLOSURES_PER_FLUSH(closures_run);
+  }
   return did_something;
 }
 
@@ -197,10 +204,10 @@ void ExecCtx::Run(const DebugLocation& location, grpc_closure* closure,
 
 void ExecCtx::RunList(const DebugLocation& location, grpc_closure_list* list) {
   (void)location;
+#ifndef NDEBUG
   grpc_closure* c = list->head;
   while (c != nullptr) {
     grpc_closure* next = c->next_data.next;
-#ifndef NDEBUG
     if (c->scheduled) {
       gpr_log(GPR_ERROR,
               "Closure already scheduled. (closure: %p, created: [%s:%d], "
@@ -214,11 +221,12 @@ void ExecCtx::RunList(const DebugLocation& location, grpc_closure_list* list) {
     c->line_initiated = location.line();
     c->run = false;
     GPR_ASSERT(c->cb != nullptr);
-#endif
-    exec_ctx_sched(c, c->error_data.error);
     c = next;
   }
-  list->head = list->tail = nullptr;
+#endif
+  // The closures already carry their errors and are linked the same way the
+  // exec_ctx links its own closures, so the whole list can be spliced on.
+  grpc_closure_list_move(list, ExecCtx::Get()->closure_list());
 }
 
 }  // namespace grpc_core
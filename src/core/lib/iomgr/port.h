@@ -60,6 +60,9 @@
 #if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 0, 0)
 #define GRPC_LINUX_ERRQUEUE 1
 #endif /* LINUX_VERSION_CODE >= KERNEL_VERSION(4, 0, 0) */
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 1, 0)
+#define GRPC_LINUX_KTLS 1
+#endif /* LINUX_VERSION_CODE >= KERNEL_VERSION(5, 1, 0) */
 #endif /* LINUX_VERSION_CODE */
 #define GRPC_LINUX_MULTIPOLL_WITH_EPOLL 1
 #define GRPC_POSIX_FORK 1
@@ -77,6 +80,9 @@
 #if __GLIBC_PREREQ(2, 10)
 #define GRPC_LINUX_SOCKETUTILS 1
 #endif
+#if __GLIBC_PREREQ(2, 27)
+#define GRPC_LINUX_MEMFD 1
+#endif
 #endif
 #ifdef LINUX_VERSION_CODE
 #if LINUX_VERSION_CODE >= KERNEL_VERSION(2, 6, 37)
@@ -55,6 +55,7 @@
 #include "src/core/lib/iomgr/ev_posix.h"
 #include "src/core/lib/iomgr/executor.h"
 #include "src/core/lib/iomgr/socket_utils_posix.h"
+#include "src/core/lib/iomgr/unix_sockets_posix.h"
 #include "src/core/lib/profiling/timers.h"
 #include "src/core/lib/slice/slice_internal.h"
 #include "src/core/lib/slice/slice_string_helpers.h"
@@ -1682,14 +1683,31 @@ static const grpc_endpoint_vtable vtable = {tcp_read,
 
 #define MAX_CHUNK_SIZE 32 * 1024 * 1024
 
+/* Unix domain sockets have no segment size and move data with a single copy,
+   so reading in big chunks from the start is cheap. */
+#define UNIX_SOCKET_READ_CHUNK_SIZE (64 * 1024)
+
+static bool is_unix_socket(int fd) {
+  grpc_resolved_address addr;
+  addr.len = static_cast<socklen_t>(sizeof(addr.addr));
+  if (getsockname(fd, reinterpret_cast<struct sockaddr*>(addr.addr),
+                  &addr.len) != 0) {
+    return false;
+  }
+  return grpc_is_unix_socket(&addr);
+}
+
 grpc_endpoint* grpc_tcp_create(grpc_fd* em_fd,
                                const grpc_channel_args* channel_args,
                                const char* peer_string) {
   static constexpr bool kZerocpTxEnabledDefault = false;
-  int tcp_read_chunk_size = GRPC_TCP_DEFAULT_READ_SLICE_SIZE;
+  const bool unix_socket = is_unix_socket(grpc_fd_wrapped_fd(em_fd));
+  int tcp_read_chunk_size = unix_socket ? UNIX_SOCKET_READ_CHUNK_SIZE
+                                        : GRPC_TCP_DEFAULT_READ_SLICE_SIZE;
   int tcp_max_read_chunk_size = 4 * 1024 * 1024;
   int tcp_min_read_chunk_size = 256;
   bool tcp_tx_zerocopy_enabled = kZerocpTxEnabledDefault;
+  int unix_socket_sndbuf_size = 0;
   int tcp_tx_zerocopy_send_bytes_thresh =
       grpc_core::TcpZerocopySendCtx::kDefaultSendBytesThreshold;
   int tcp_tx_zerocopy_max_simult_sends =
@@ -1735,6 +1753,11 @@ grpc_endpoint* grpc_tcp_create(grpc_fd* em_fd,
             grpc_core::TcpZerocopySendCtx::kDefaultMaxSends, 0, INT_MAX};
         tcp_tx_zerocopy_max_simult_sends =
             grpc_channel_arg_get_integer(&channel_args->args[i], options);
+      } else if (0 == strcmp(channel_args->args[i].key,
+                             GRPC_ARG_UNIX_SOCKET_SNDBUF_SIZE)) {
+        grpc_integer_options options = {0, 0, INT_MAX};
+        unix_socket_sndbuf_size =
+            grpc_channel_arg_get_integer(&channel_args->args[i], options);
       }
     }
   }
@@ -1763,11 +1786,14 @@ grpc_endpoint* grpc_tcp_create(grpc_fd* em_fd,
   tcp->is_first_read = true;
   tcp->bytes_counter = -1;
   tcp->socket_ts_enabled = false;
-  tcp->ts_capable = true;
+  /* There are no ACKs, and so no ACK timestamps, on Unix domain sockets. */
+  tcp->ts_capable = !unix_socket;
   tcp->outgoing_buffer_arg = nullptr;
   new (&tcp->tcp_zerocopy_send_ctx) TcpZerocopySendCtx(
       tcp_tx_zerocopy_max_simult_sends, tcp_tx_zerocopy_send_bytes_thresh);
-  if (tcp_tx_zerocopy_enabled && !tcp->tcp_zerocopy_send_ctx.memory_limited()) {
+  /* MSG_ZEROCOPY is only implemented for TCP (and UDP). */
+  if (tcp_tx_zerocopy_enabled && !unix_socket &&
+      !tcp->tcp_zerocopy_send_ctx.memory_limited()) {
 #ifdef GRPC_LINUX_ERRQUEUE
     const int enable = 1;
     auto err =
@@ -1802,11 +1828,18 @@ grpc_endpoint* grpc_tcp_create(grpc_fd* em_fd,
                       tcp_drop_uncovered_then_handle_write, tcp,
                       grpc_schedule_on_exec_ctx);
   }
+  /* The send buffer bounds the bytes in flight to the peer. */
+  if (unix_socket && unix_socket_sndbuf_size > 0) {
+    GRPC_LOG_IF_ERROR("set_socket_sndbuf",
+                      grpc_set_socket_sndbuf(tcp->fd, unix_socket_sndbuf_size));
+  }
   /* Always assume there is something on the queue to read. */
   tcp->inq = 1;
 #ifdef GRPC_HAVE_TCP_INQ
   int one = 1;
-  if (setsockopt(tcp->fd, SOL_TCP, TCP_INQ, &one, sizeof(one)) == 0) {
+  if (unix_socket) {
+    tcp->inq_capable = false;
+  } else if (setsockopt(tcp->fd, SOL_TCP, TCP_INQ, &one, sizeof(one)) == 0) {
     tcp->inq_capable = true;
   } else {
     gpr_log(GPR_DEBUG, "cannot set inq fd=%d errno=%d", tcp->fd, errno);
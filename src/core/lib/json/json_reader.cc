@@ -87,6 +87,7 @@ class JsonReader {
 
   Status Run();
   uint32_t ReadChar();
+  void ReadPlainStringRun();
   bool IsComplete();
 
   size_t CurrentIndex() const { return input_ - original_input_ - 1; }
@@ -165,6 +166,48 @@ uint32_t JsonReader::ReadChar() {
   return r;
 }
 
+constexpr uint64_t kOnes = ~uint64_t(0) / 0xff;  // 0x0101010101010101
+constexpr uint64_t kHighBits = kOnes * 0x80;
+
+/* Returns non-zero if any byte of \a word is less than \a n (n <= 128). */
+inline uint64_t HasByteLessThan(uint64_t word, uint8_t n) {
+  return (word - kOnes * n) & ~word & kHighBits;
+}
+
+/* Returns non-zero if any byte of \a word equals \a c. */
+inline uint64_t HasByte(uint64_t word, uint8_t c) {
+  return HasByteLessThan(word ^ (kOnes * c), 1);
+}
+
+/* Returns whether \a c can be copied verbatim into a string value, i.e. it
+ * neither terminates the string, starts an escape, nor is a control
+ * character. */
+inline bool IsPlainStringChar(uint8_t c) {
+  return c >= 32 && c != '"' && c != '\\';
+}
+
+/* Copies the longest run of plain characters at the current position into
+ * the string being built. Strings make up most of a typical service config,
+ * so they are scanned a word at a time rather than going through the state
+ * machine for every character. */
+void JsonReader::ReadPlainStringRun() {
+  const uint8_t* p = input_;
+  const uint8_t* end = input_ + remaining_input_;
+  while (end - p >= static_cast<ptrdiff_t>(sizeof(uint64_t))) {
+    uint64_t word;
+    memcpy(&word, p, sizeof(word));
+    if (HasByteLessThan(word, 32) | HasByte(word, '"') | HasByte(word, '\\')) {
+      break;
+    }
+    p += sizeof(word);
+  }
+  while (p != end && IsPlainStringChar(*p)) ++p;
+  const size_t n = p - input_;
+  string_.append(reinterpret_cast<const char*>(input_), n);
+  input_ = p;
+  remaining_input_ -= n;
+}
+
 Json* JsonReader::CreateAndLinkValue() {
   Json* value;
   if (stack_.empty()) {
@@ -172,7 +215,11 @@ Json* JsonReader::CreateAndLinkValue() {
   } else {
     Json* parent = stack_.back();
     if (parent->type() == Json::Type::OBJECT) {
-      if (parent->object_value().find(key_) != parent->object_value().end()) {
+      Json::Object* object = parent->mutable_object();
+      auto it = object->lower_bound(key_);
+      if (it == object->end() || it->first != key_) {
+        it = object->emplace_hint(it, std::move(key_), Json());
+      } else {
         if (errors_.size() == GRPC_JSON_MAX_ERRORS) {
           truncated_errors_ = true;
         } else {
@@ -183,7 +230,7 @@ Json* JsonReader::CreateAndLinkValue() {
           gpr_free(msg);
         }
       }
-      value = &(*parent->mutable_object())[std::move(key_)];
+      value = &it->second;
     } else {
       GPR_ASSERT(parent->type() == Json::Type::ARRAY);
       parent->mutable_array()->emplace_back();
@@ -271,6 +318,11 @@ JsonReader::Status JsonReader::Run() {
 
   /* This state-machine is a strict implementation of ECMA-404 */
   while (true) {
+    if ((state_ == State::GRPC_JSON_STATE_OBJECT_KEY_STRING ||
+         state_ == State::GRPC_JSON_STATE_VALUE_STRING) &&
+        unicode_high_surrogate_ == 0) {
+      ReadPlainStringRun();
+    }
     c = ReadChar();
     switch (c) {
       /* Let's process the error case first. */
@@ -225,8 +225,9 @@ struct grpc_server_credentials
 
   virtual ~grpc_server_credentials() { DestroyProcessor(); }
 
+  // args are the channel args of the server the port is added to.
   virtual grpc_core::RefCountedPtr<grpc_server_security_connector>
-  create_security_connector() = 0;
+  create_security_connector(const grpc_channel_args* args) = 0;
 
   const char* type() const { return type_; }
 
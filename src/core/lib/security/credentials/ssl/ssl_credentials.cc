@@ -23,6 +23,7 @@
 #include <string.h>
 
 #include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/security/security_connector/ssl_utils.h"
 #include "src/core/lib/surface/api_trace.h"
 #include "src/core/tsi/ssl_transport_security.h"
 
@@ -79,10 +80,15 @@ grpc_ssl_credentials::create_security_connector(
           static_cast<tsi_ssl_session_cache*>(arg->value.pointer.p);
     }
   }
+  if (ssl_session_cache == nullptr &&
+      grpc_channel_args_find_bool(args, GRPC_ARG_SSL_SHARED_SESSION_CACHE,
+                                  false)) {
+    ssl_session_cache = grpc_ssl_shared_session_cache();
+  }
   grpc_core::RefCountedPtr<grpc_channel_security_connector> sc =
       grpc_ssl_channel_security_connector_create(
           this->Ref(), std::move(call_creds), &config_, target,
-          overridden_target_name, ssl_session_cache);
+          overridden_target_name, ssl_session_cache, args);
   if (sc == nullptr) {
     return sc;
   }
@@ -158,6 +164,7 @@ struct grpc_ssl_server_credentials_options {
   grpc_ssl_client_certificate_request_type client_certificate_request;
   grpc_ssl_server_certificate_config* certificate_config;
   grpc_ssl_server_certificate_config_fetcher* certificate_config_fetcher;
+  tsi_ssl_session_ticket_keys* session_ticket_keys;
 };
 
 grpc_ssl_server_credentials::grpc_ssl_server_credentials(
@@ -172,16 +179,22 @@ grpc_ssl_server_credentials::grpc_ssl_server_credentials(
                  options.certificate_config->num_key_cert_pairs,
                  options.client_certificate_request);
   }
+  if (options.session_ticket_keys != nullptr) {
+    tsi_ssl_session_ticket_keys_ref(options.session_ticket_keys);
+    config_.session_ticket_keys = options.session_ticket_keys;
+  }
 }
 
 grpc_ssl_server_credentials::~grpc_ssl_server_credentials() {
   grpc_tsi_ssl_pem_key_cert_pairs_destroy(config_.pem_key_cert_pairs,
                                           config_.num_key_cert_pairs);
   gpr_free(config_.pem_root_certs);
+  tsi_ssl_session_ticket_keys_unref(config_.session_ticket_keys);
 }
 grpc_core::RefCountedPtr<grpc_server_security_connector>
-grpc_ssl_server_credentials::create_security_connector() {
-  return grpc_ssl_server_security_connector_create(this->Ref());
+grpc_ssl_server_credentials::create_security_connector(
+    const grpc_channel_args* args) {
+  return grpc_ssl_server_security_connector_create(this->Ref(), args);
 }
 
 tsi_ssl_pem_key_cert_pair* grpc_convert_grpc_to_tsi_cert_pairs(
@@ -360,5 +373,17 @@ void grpc_ssl_server_credentials_options_destroy(
   if (o == nullptr) return;
   gpr_free(o->certificate_config_fetcher);
   grpc_ssl_server_certificate_config_destroy(o->certificate_config);
+  tsi_ssl_session_ticket_keys_unref(o->session_ticket_keys);
   gpr_free(o);
 }
+
+void grpc_ssl_server_credentials_options_set_session_ticket_keys(
+    grpc_ssl_server_credentials_options* options,
+    grpc_ssl_session_ticket_keys* keys) {
+  GPR_ASSERT(options != nullptr);
+  tsi_ssl_session_ticket_keys* tsi_keys =
+      reinterpret_cast<tsi_ssl_session_ticket_keys*>(keys);
+  if (tsi_keys != nullptr) tsi_ssl_session_ticket_keys_ref(tsi_keys);
+  tsi_ssl_session_ticket_keys_unref(options->session_ticket_keys);
+  options->session_ticket_keys = tsi_keys;
+}
@@ -28,6 +28,7 @@
 #include <grpc/support/string_util.h>
 
 #include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/security/security_connector/ssl_utils.h"
 #include "src/core/lib/security/security_connector/tls/tls_security_connector.h"
 
 #define GRPC_CREDENTIALS_TYPE_TLS "Tls"
@@ -83,6 +84,11 @@ TlsCredentials::create_security_connector(
           static_cast<tsi_ssl_session_cache*>(arg->value.pointer.p);
     }
   }
+  if (ssl_session_cache == nullptr &&
+      grpc_channel_args_find_bool(args, GRPC_ARG_SSL_SHARED_SESSION_CACHE,
+                                  false)) {
+    ssl_session_cache = grpc_ssl_shared_session_cache();
+  }
   grpc_core::RefCountedPtr<grpc_channel_security_connector> sc =
       grpc_core::TlsChannelSecurityConnector::CreateTlsChannelSecurityConnector(
           this->Ref(), std::move(call_creds), target_name,
@@ -104,7 +110,8 @@ TlsServerCredentials::TlsServerCredentials(
 TlsServerCredentials::~TlsServerCredentials() {}
 
 grpc_core::RefCountedPtr<grpc_server_security_connector>
-TlsServerCredentials::create_security_connector() {
+TlsServerCredentials::create_security_connector(
+    const grpc_channel_args* /*args*/) {
   return grpc_core::TlsServerSecurityConnector::
       CreateTlsServerSecurityConnector(this->Ref());
 }
@@ -29,6 +29,7 @@
 #include <grpc/support/string_util.h>
 
 #include "src/core/ext/transport/chttp2/alpn/alpn.h"
+#include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/handshaker.h"
 #include "src/core/lib/gpr/string.h"
 #include "src/core/lib/gprpp/host_port.h"
@@ -59,6 +60,7 @@ grpc_error* ssl_check_peer(
     gpr_free(msg);
     return error;
   }
+  grpc_ssl_record_session_reuse(peer, /*is_client=*/peer_name != nullptr);
   *auth_context =
       grpc_ssl_peer_to_auth_context(peer, GRPC_SSL_TRANSPORT_SECURITY_TYPE);
   return GRPC_ERROR_NONE;
@@ -91,7 +93,8 @@ class grpc_ssl_channel_security_connector final
   grpc_security_status InitializeHandshakerFactory(
       const grpc_ssl_config* config, const char* pem_root_certs,
       const tsi_ssl_root_certs_store* root_store,
-      tsi_ssl_session_cache* ssl_session_cache) {
+      tsi_ssl_session_cache* ssl_session_cache,
+      const grpc_channel_args* args) {
     bool has_key_cert_pair =
         config->pem_key_cert_pair != nullptr &&
         config->pem_key_cert_pair->private_key != nullptr &&
@@ -107,6 +110,10 @@ class grpc_ssl_channel_security_connector final
     }
     options.cipher_suites = grpc_get_ssl_cipher_suites();
     options.session_cache = ssl_session_cache;
+    options.enable_kernel_tls =
+        grpc_channel_args_find_bool(args, GRPC_ARG_ENABLE_KERNEL_TLS, false);
+    options.use_zero_copy_protector = grpc_channel_args_find_bool(
+        args, GRPC_ARG_ENABLE_SSL_ZERO_COPY_PROTECTOR, false);
     const tsi_result result =
         tsi_create_ssl_client_handshaker_factory_with_options(
             &options, &client_handshaker_factory_);
@@ -207,9 +214,14 @@ class grpc_ssl_server_security_connector
     : public grpc_server_security_connector {
  public:
   grpc_ssl_server_security_connector(
-      grpc_core::RefCountedPtr<grpc_server_credentials> server_creds)
+      grpc_core::RefCountedPtr<grpc_server_credentials> server_creds,
+      const grpc_channel_args* args)
       : grpc_server_security_connector(GRPC_SSL_URL_SCHEME,
-                                       std::move(server_creds)) {}
+                                       std::move(server_creds)),
+        enable_kernel_tls_(grpc_channel_args_find_bool(
+            args, GRPC_ARG_ENABLE_KERNEL_TLS, false)),
+        use_zero_copy_protector_(grpc_channel_args_find_bool(
+            args, GRPC_ARG_ENABLE_SSL_ZERO_COPY_PROTECTOR, false)) {}
 
   ~grpc_ssl_server_security_connector() override {
     tsi_ssl_server_handshaker_factory_unref(server_handshaker_factory_);
@@ -251,6 +263,10 @@ class grpc_ssl_server_security_connector
       options.cipher_suites = grpc_get_ssl_cipher_suites();
       options.alpn_protocols = alpn_protocol_strings;
       options.num_alpn_protocols = static_cast<uint16_t>(num_alpn_protocols);
+      options.session_ticket_keys =
+          server_credentials->config().session_ticket_keys;
+      options.enable_kernel_tls = enable_kernel_tls_;
+      options.use_zero_copy_protector = use_zero_copy_protector_;
       const tsi_result result =
           tsi_create_ssl_server_handshaker_factory_with_options(
               &options, &server_handshaker_factory_);
@@ -359,6 +375,9 @@ class grpc_ssl_server_security_connector
     options.cipher_suites = grpc_get_ssl_cipher_suites();
     options.alpn_protocols = alpn_protocol_strings;
     options.num_alpn_protocols = static_cast<uint16_t>(num_alpn_protocols);
+    options.session_ticket_keys = server_creds->config().session_ticket_keys;
+    options.enable_kernel_tls = enable_kernel_tls_;
+    options.use_zero_copy_protector = use_zero_copy_protector_;
     tsi_result result = tsi_create_ssl_server_handshaker_factory_with_options(
         &options, &new_handshaker_factory);
     grpc_tsi_ssl_pem_key_cert_pairs_destroy(
@@ -384,6 +403,8 @@ class grpc_ssl_server_security_connector
   }
 
   grpc_core::Mutex mu_;
+  const bool enable_kernel_tls_;
+  const bool use_zero_copy_protector_;
   tsi_ssl_server_handshaker_factory* server_handshaker_factory_ = nullptr;
 };
 }  // namespace
@@ -394,7 +415,7 @@ grpc_ssl_channel_security_connector_create(
     grpc_core::RefCountedPtr<grpc_call_credentials> request_metadata_creds,
     const grpc_ssl_config* config, const char* target_name,
     const char* overridden_target_name,
-    tsi_ssl_session_cache* ssl_session_cache) {
+    tsi_ssl_session_cache* ssl_session_cache, const grpc_channel_args* args) {
   if (config == nullptr || target_name == nullptr) {
     gpr_log(GPR_ERROR, "An ssl channel needs a config and a target name.");
     return nullptr;
@@ -420,7 +441,7 @@ grpc_ssl_channel_security_connector_create(
           std::move(channel_creds), std::move(request_metadata_creds), config,
           target_name, overridden_target_name);
   const grpc_security_status result = c->InitializeHandshakerFactory(
-      config, pem_root_certs, root_store, ssl_session_cache);
+      config, pem_root_certs, root_store, ssl_session_cache, args);
   if (result != GRPC_SECURITY_OK) {
     return nullptr;
   }
@@ -429,11 +450,12 @@ grpc_ssl_channel_security_connector_create(
 
 grpc_core::RefCountedPtr<grpc_server_security_connector>
 grpc_ssl_server_security_connector_create(
-    grpc_core::RefCountedPtr<grpc_server_credentials> server_credentials) {
+    grpc_core::RefCountedPtr<grpc_server_credentials> server_credentials,
+    const grpc_channel_args* args) {
   GPR_ASSERT(server_credentials != nullptr);
   grpc_core::RefCountedPtr<grpc_ssl_server_security_connector> c =
       grpc_core::MakeRefCounted<grpc_ssl_server_security_connector>(
-          std::move(server_credentials));
+          std::move(server_credentials), args);
   const grpc_security_status retval = c->InitializeHandshakerFactory();
   if (retval != GRPC_SECURITY_OK) {
     return nullptr;
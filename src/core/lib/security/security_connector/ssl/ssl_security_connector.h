@@ -43,6 +43,8 @@ struct grpc_ssl_config {
      grpc_channel_security_connector_check_peer. This parameter may be NULL in
      which case the peer name will not be checked. Note that if this parameter
      is not NULL, then, pem_root_certs should not be NULL either.
+   - args are the channel args, which select kernel TLS offload and the
+     zero-copy protector.
    - sc is a pointer on the connector to be created.
   This function returns GRPC_SECURITY_OK in case of success or a
   specific error code otherwise.
@@ -53,7 +55,7 @@ grpc_ssl_channel_security_connector_create(
     grpc_core::RefCountedPtr<grpc_call_credentials> request_metadata_creds,
     const grpc_ssl_config* config, const char* target_name,
     const char* overridden_target_name,
-    tsi_ssl_session_cache* ssl_session_cache);
+    tsi_ssl_session_cache* ssl_session_cache, const grpc_channel_args* args);
 
 /* Config for ssl servers. */
 struct grpc_ssl_server_config {
@@ -62,16 +64,20 @@ struct grpc_ssl_server_config {
   char* pem_root_certs = nullptr;
   grpc_ssl_client_certificate_request_type client_certificate_request =
       GRPC_SSL_DONT_REQUEST_CLIENT_CERTIFICATE;
+  tsi_ssl_session_ticket_keys* session_ticket_keys = nullptr;
 };
 /* Creates an SSL server_security_connector.
    - config is the SSL config to be used for the SSL channel establishment.
+   - args are the server's channel args, which select kernel TLS offload and
+     the zero-copy protector.
    - sc is a pointer on the connector to be created.
   This function returns GRPC_SECURITY_OK in case of success or a
   specific error code otherwise.
 */
 grpc_core::RefCountedPtr<grpc_server_security_connector>
 grpc_ssl_server_security_connector_create(
-    grpc_core::RefCountedPtr<grpc_server_credentials> server_credentials);
+    grpc_core::RefCountedPtr<grpc_server_credentials> server_credentials,
+    const grpc_channel_args* args);
 
 #endif /* GRPC_CORE_LIB_SECURITY_SECURITY_CONNECTOR_SSL_SSL_SECURITY_CONNECTOR_H \
         */
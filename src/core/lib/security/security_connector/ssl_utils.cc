@@ -29,6 +29,7 @@
 
 #include "src/core/ext/transport/chttp2/alpn/alpn.h"
 #include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/debug/stats.h"
 #include "src/core/lib/gpr/string.h"
 #include "src/core/lib/gprpp/host_port.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
@@ -51,6 +52,13 @@ static const char* installed_roots_path =
 #define TSI_OPENSSL_ALPN_SUPPORT 1
 #endif
 
+#define GRPC_SSL_SHARED_SESSION_CACHE_CAPACITY 1024
+#define GRPC_SSL_DEFAULT_SESSION_TICKET_KEYS 3
+
+static_assert(GRPC_SSL_SESSION_TICKET_KEY_SIZE ==
+                  TSI_SSL_SESSION_TICKET_KEY_SIZE,
+              "session ticket key sizes must match");
+
 /* -- Overridden default roots. -- */
 
 static grpc_ssl_roots_override_callback ssl_roots_override_cb = nullptr;
@@ -489,6 +497,60 @@ grpc_arg grpc_ssl_session_cache_create_channel_arg(
       const_cast<char*>(GRPC_SSL_SESSION_CACHE_ARG), cache, &vtable);
 }
 
+static gpr_once g_shared_session_cache_once = GPR_ONCE_INIT;
+static tsi_ssl_session_cache* g_shared_session_cache;
+
+static void init_shared_session_cache(void) {
+  g_shared_session_cache =
+      tsi_ssl_session_cache_create_lru(GRPC_SSL_SHARED_SESSION_CACHE_CAPACITY);
+}
+
+tsi_ssl_session_cache* grpc_ssl_shared_session_cache() {
+  gpr_once_init(&g_shared_session_cache_once, init_shared_session_cache);
+  return g_shared_session_cache;
+}
+
+void grpc_ssl_record_session_reuse(const tsi_peer* peer, bool is_client) {
+  const tsi_peer_property* p =
+      tsi_peer_get_property_by_name(peer, TSI_SSL_SESSION_REUSED_PEER_PROPERTY);
+  bool reused = p != nullptr && p->value.length == strlen("true") &&
+                strncmp(p->value.data, "true", p->value.length) == 0;
+  if (is_client) {
+    GRPC_STATS_INC_SSL_CLIENT_HANDSHAKES();
+    if (reused) GRPC_STATS_INC_SSL_CLIENT_SESSIONS_RESUMED();
+  } else {
+    GRPC_STATS_INC_SSL_SERVER_HANDSHAKES();
+    if (reused) GRPC_STATS_INC_SSL_SERVER_SESSIONS_RESUMED();
+  }
+}
+
+/* --- Ssl session ticket keys implementation. --- */
+
+grpc_ssl_session_ticket_keys* grpc_ssl_session_ticket_keys_create(
+    size_t max_keys) {
+  tsi_ssl_session_ticket_keys* keys = tsi_ssl_session_ticket_keys_create(
+      max_keys < 1 ? GRPC_SSL_DEFAULT_SESSION_TICKET_KEYS : max_keys);
+  return reinterpret_cast<grpc_ssl_session_ticket_keys*>(keys);
+}
+
+int grpc_ssl_session_ticket_keys_rotate(grpc_ssl_session_ticket_keys* keys,
+                                        const unsigned char* key,
+                                        size_t key_size) {
+  tsi_result result = tsi_ssl_session_ticket_keys_rotate(
+      reinterpret_cast<tsi_ssl_session_ticket_keys*>(keys), key, key_size);
+  if (result != TSI_OK) {
+    gpr_log(GPR_ERROR, "Failed to rotate session ticket keys: %s.",
+            tsi_result_to_string(result));
+    return 0;
+  }
+  return 1;
+}
+
+void grpc_ssl_session_ticket_keys_destroy(grpc_ssl_session_ticket_keys* keys) {
+  tsi_ssl_session_ticket_keys_unref(
+      reinterpret_cast<tsi_ssl_session_ticket_keys*>(keys));
+}
+
 /* --- Default SSL root store implementation. --- */
 
 namespace grpc_core {
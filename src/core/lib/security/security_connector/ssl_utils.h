@@ -96,6 +96,14 @@ grpc_security_status grpc_ssl_tsi_server_handshaker_factory_init(
     grpc_ssl_client_certificate_request_type client_certificate_request,
     tsi_ssl_server_handshaker_factory** handshaker_factory);
 
+/* Return the client session cache shared by the channels created with
+   GRPC_ARG_SSL_SHARED_SESSION_CACHE. */
+tsi_ssl_session_cache* grpc_ssl_shared_session_cache();
+
+/* Update the session resumption stats with the outcome of the handshake that
+   produced \a peer. */
+void grpc_ssl_record_session_reuse(const tsi_peer* peer, bool is_client);
+
 /* Exposed for testing only. */
 grpc_core::RefCountedPtr<grpc_auth_context> grpc_ssl_peer_to_auth_context(
     const tsi_peer* peer, const char* transport_security_type);
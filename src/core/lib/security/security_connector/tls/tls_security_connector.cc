@@ -202,6 +202,7 @@ void TlsChannelSecurityConnector::check_peer(
     tsi_peer_destruct(&peer);
     return;
   }
+  grpc_ssl_record_session_reuse(&peer, /*is_client=*/true);
   *auth_context =
       grpc_ssl_peer_to_auth_context(&peer, GRPC_TLS_TRANSPORT_SECURITY_TYPE);
   const TlsCredentials* creds =
@@ -498,6 +499,7 @@ void TlsServerSecurityConnector::check_peer(
     grpc_core::RefCountedPtr<grpc_auth_context>* auth_context,
     grpc_closure* on_peer_checked) {
   grpc_error* error = grpc_ssl_check_alpn(&peer);
+  grpc_ssl_record_session_reuse(&peer, /*is_client=*/false);
   *auth_context =
       grpc_ssl_peer_to_auth_context(&peer, GRPC_TLS_TRANSPORT_SECURITY_TYPE);
   tsi_peer_destruct(&peer);
@@ -51,10 +51,11 @@ struct secure_endpoint {
                   tsi_frame_protector* protector,
                   tsi_zero_copy_grpc_protector* zero_copy_protector,
                   grpc_endpoint* transport, grpc_slice* leftover_slices,
-                  size_t leftover_nslices)
+                  size_t leftover_nslices, bool kernel_tls_tx)
       : wrapped_ep(transport),
         protector(protector),
-        zero_copy_protector(zero_copy_protector) {
+        zero_copy_protector(zero_copy_protector),
+        kernel_tls_tx(kernel_tls_tx) {
     base.vtable = vtable;
     gpr_mu_init(&protector_mu);
     GRPC_CLOSURE_INIT(&on_read, ::on_read, this, grpc_schedule_on_exec_ctx);
@@ -84,6 +85,8 @@ struct secure_endpoint {
   grpc_endpoint* wrapped_ep;
   struct tsi_frame_protector* protector;
   struct tsi_zero_copy_grpc_protector* zero_copy_protector;
+  /* the kernel protects writes to wrapped_ep. */
+  const bool kernel_tls_tx;
   gpr_mu protector_mu;
   /* saved upper level callbacks and user_data. */
   grpc_closure* read_cb = nullptr;
@@ -185,9 +188,13 @@ static void on_read(void* user_data, grpc_error* error) {
   }
 
   if (ep->zero_copy_protector != nullptr) {
-    // Use zero-copy grpc protector to unprotect.
+    // Use zero-copy grpc protector to unprotect.  Serialized with writes,
+    // like the frame protector, since the SSL protector shares its state
+    // between both directions.
+    gpr_mu_lock(&ep->protector_mu);
     result = tsi_zero_copy_grpc_protector_unprotect(
         ep->zero_copy_protector, &ep->source_buffer, ep->read_buffer);
+    gpr_mu_unlock(&ep->protector_mu);
   } else {
     // Use frame protector to unprotect.
     /* TODO(yangg) check error, maybe bail out early */
@@ -301,10 +308,18 @@ static void endpoint_write(grpc_endpoint* secure_ep, grpc_slice_buffer* slices,
     }
   }
 
+  if (ep->kernel_tls_tx) {
+    // The kernel protects the plaintext on its way to the socket.
+    grpc_endpoint_write(ep->wrapped_ep, slices, cb, arg);
+    return;
+  }
+
   if (ep->zero_copy_protector != nullptr) {
     // Use zero-copy grpc protector to protect.
+    gpr_mu_lock(&ep->protector_mu);
     result = tsi_zero_copy_grpc_protector_protect(ep->zero_copy_protector,
                                                   slices, &ep->output_buffer);
+    gpr_mu_unlock(&ep->protector_mu);
   } else {
     // Use frame protector to protect.
     for (i = 0; i < slices->count; i++) {
@@ -438,9 +453,9 @@ grpc_endpoint* grpc_secure_endpoint_create(
     struct tsi_frame_protector* protector,
     struct tsi_zero_copy_grpc_protector* zero_copy_protector,
     grpc_endpoint* transport, grpc_slice* leftover_slices,
-    size_t leftover_nslices) {
+    size_t leftover_nslices, bool kernel_tls_tx) {
   secure_endpoint* ep =
       new secure_endpoint(&vtable, protector, zero_copy_protector, transport,
-                          leftover_slices, leftover_nslices);
+                          leftover_slices, leftover_nslices, kernel_tls_tx);
   return &ep->base;
 }
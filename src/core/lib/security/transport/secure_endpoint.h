@@ -31,11 +31,12 @@ extern grpc_core::TraceFlag grpc_trace_secure_endpoint;
 
 /* Takes ownership of protector, zero_copy_protector, and to_wrap, and refs
  * leftover_slices. If zero_copy_protector is not NULL, protector will never be
- * used. */
+ * used. If kernel_tls_tx is true, the kernel protects what is written to
+ * to_wrap and the protectors are only used to unprotect. */
 grpc_endpoint* grpc_secure_endpoint_create(
     struct tsi_frame_protector* protector,
     struct tsi_zero_copy_grpc_protector* zero_copy_protector,
     grpc_endpoint* to_wrap, grpc_slice* leftover_slices,
-    size_t leftover_nslices);
+    size_t leftover_nslices, bool kernel_tls_tx = false);
 
 #endif /* GRPC_CORE_LIB_SECURITY_TRANSPORT_SECURE_ENDPOINT_H */
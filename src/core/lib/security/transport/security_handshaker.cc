@@ -26,12 +26,17 @@
 
 #include <grpc/slice_buffer.h>
 #include <grpc/support/alloc.h>
+#include <grpc/support/cpu.h>
 #include <grpc/support/log.h>
+#include <grpc/support/time.h>
 
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/handshaker.h"
 #include "src/core/lib/channel/handshaker_registry.h"
+#include "src/core/lib/debug/stats.h"
+#include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/iomgr/executor/threadpool.h"
 #include "src/core/lib/security/context/security_context.h"
 #include "src/core/lib/security/transport/secure_endpoint.h"
 #include "src/core/lib/security/transport/tsi_error.h"
@@ -39,11 +44,26 @@
 #include "src/core/tsi/transport_security_grpc.h"
 
 #define GRPC_INITIAL_HANDSHAKE_BUFFER_SIZE 256
+#define GRPC_DEFAULT_HANDSHAKE_OFFLOAD_MAX_PENDING 1024
+// Certificate chain verification can recurse deeper than the thread pool's
+// default 64K stack allows.
+#define GRPC_HANDSHAKE_THREAD_STACK_SIZE (256 * 1024)
 
 namespace grpc_core {
 
 namespace {
 
+// Microseconds elapsed since start on the monotonic clock.
+int MicrosSince(gpr_timespec start) {
+  gpr_timespec elapsed = gpr_time_sub(gpr_now(GPR_CLOCK_MONOTONIC), start);
+  int64_t micros = elapsed.tv_sec * GPR_US_PER_SEC + elapsed.tv_nsec / 1000;
+  return static_cast<int>(GPR_MIN(micros, std::numeric_limits<int>::max()));
+}
+
+// Process-wide pool running offloaded handshake steps, one thread per core.
+// Lives from grpc_init() to grpc_shutdown(), like the executor.
+ThreadPool* g_handshake_pool;
+
 class SecurityHandshaker : public Handshaker {
  public:
   SecurityHandshaker(tsi_handshaker* handshaker,
@@ -59,6 +79,10 @@ class SecurityHandshaker : public Handshaker {
  private:
   grpc_error* DoHandshakerNextLocked(const unsigned char* bytes_received,
                                      size_t bytes_received_size);
+  grpc_error* RunHandshakerNextLocked(const unsigned char* bytes_received,
+                                      size_t bytes_received_size);
+  grpc_error* OffloadHandshakerNextLocked(const unsigned char* bytes_received,
+                                          size_t bytes_received_size);
 
   grpc_error* OnHandshakeNextDoneLocked(
       tsi_result result, const unsigned char* bytes_to_send,
@@ -75,6 +99,8 @@ class SecurityHandshaker : public Handshaker {
   static void OnHandshakeNextDoneGrpcWrapper(
       tsi_result result, void* user_data, const unsigned char* bytes_to_send,
       size_t bytes_to_send_size, tsi_handshaker_result* handshaker_result);
+  static void OnOffloadedHandshakerNext(
+      grpc_experimental_completion_queue_functor* functor, int ok);
   static void OnPeerCheckedFn(void* arg, grpc_error* error);
   void OnPeerCheckedInner(grpc_error* error);
   size_t MoveReadBufferIntoHandshakeBuffer();
@@ -104,6 +130,19 @@ class SecurityHandshaker : public Handshaker {
   RefCountedPtr<grpc_auth_context> auth_context_;
   tsi_handshaker_result* handshaker_result_ = nullptr;
   size_t max_frame_size_ = 0;
+  bool enable_kernel_tls_ = false;
+  gpr_timespec handshake_start_;
+
+  // Handshake offload state.
+  struct OffloadedStep : public grpc_experimental_completion_queue_functor {
+    SecurityHandshaker* handshaker;
+  };
+  bool offload_handshakes_ = false;
+  int offload_max_pending_ = GRPC_DEFAULT_HANDSHAKE_OFFLOAD_MAX_PENDING;
+  OffloadedStep offloaded_step_;
+  const unsigned char* offloaded_bytes_received_ = nullptr;
+  size_t offloaded_bytes_received_size_ = 0;
+  gpr_timespec offload_enqueue_time_;
 };
 
 SecurityHandshaker::SecurityHandshaker(tsi_handshaker* handshaker,
@@ -120,6 +159,21 @@ SecurityHandshaker::SecurityHandshaker(tsi_handshaker* handshaker,
     max_frame_size_ = grpc_channel_arg_get_integer(
         arg, {0, 0, std::numeric_limits<int>::max()});
   }
+  // The kernel TLS ULP rejects MSG_ZEROCOPY sends.
+  enable_kernel_tls_ =
+      grpc_channel_args_find_bool(args, GRPC_ARG_ENABLE_KERNEL_TLS, false) &&
+      !grpc_channel_args_find_bool(args, GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED,
+                                   false);
+  offload_handshakes_ =
+      grpc_channel_args_find_bool(args, GRPC_ARG_OFFLOAD_HANDSHAKES, false);
+  offload_max_pending_ = grpc_channel_args_find_integer(
+      args, GRPC_ARG_HANDSHAKE_OFFLOAD_MAX_PENDING,
+      {GRPC_DEFAULT_HANDSHAKE_OFFLOAD_MAX_PENDING, 1,
+       std::numeric_limits<int>::max()});
+  offloaded_step_.functor_run = &SecurityHandshaker::OnOffloadedHandshakerNext;
+  offloaded_step_.inlineable = false;
+  offloaded_step_.internal_success = 1;
+  offloaded_step_.handshaker = this;
   gpr_mu_init(&mu_);
   grpc_slice_buffer_init(&outgoing_);
   GRPC_CLOSURE_INIT(&on_peer_checked_, &SecurityHandshaker::OnPeerCheckedFn,
@@ -207,6 +261,22 @@ void SecurityHandshaker::OnPeerCheckedInner(grpc_error* error) {
     HandshakeFailedLocked(error);
     return;
   }
+  // Hand the sending direction to kernel TLS, if requested. When the
+  // endpoint has no socket, or the kernel or the negotiated session does not
+  // support it, records keep being protected in user space.
+  bool kernel_tls_tx = false;
+  if (enable_kernel_tls_) {
+    const int fd = grpc_endpoint_get_fd(args_->endpoint);
+    if (fd >= 0) {
+      tsi_result result =
+          tsi_handshaker_result_enable_kernel_tls_tx(handshaker_result_, fd);
+      kernel_tls_tx = result == TSI_OK;
+      if (!kernel_tls_tx && GRPC_TRACE_FLAG_ENABLED(tsi_tracing_enabled)) {
+        gpr_log(GPR_INFO, "Kernel TLS not enabled on fd %d: %s", fd,
+                tsi_result_to_string(result));
+      }
+    }
+  }
   // Create zero-copy frame protector, if implemented.
   tsi_zero_copy_grpc_protector* zero_copy_protector = nullptr;
   tsi_result result = tsi_handshaker_result_create_zero_copy_grpc_protector(
@@ -243,12 +313,14 @@ void SecurityHandshaker::OnPeerCheckedInner(grpc_error* error) {
   if (unused_bytes_size > 0) {
     grpc_slice slice =
         grpc_slice_from_copied_buffer((char*)unused_bytes, unused_bytes_size);
-    args_->endpoint = grpc_secure_endpoint_create(
-        protector, zero_copy_protector, args_->endpoint, &slice, 1);
+    args_->endpoint =
+        grpc_secure_endpoint_create(protector, zero_copy_protector,
+                                    args_->endpoint, &slice, 1, kernel_tls_tx);
     grpc_slice_unref_internal(slice);
   } else {
-    args_->endpoint = grpc_secure_endpoint_create(
-        protector, zero_copy_protector, args_->endpoint, nullptr, 0);
+    args_->endpoint =
+        grpc_secure_endpoint_create(protector, zero_copy_protector,
+                                    args_->endpoint, nullptr, 0, kernel_tls_tx);
   }
   tsi_handshaker_result_destroy(handshaker_result_);
   handshaker_result_ = nullptr;
@@ -257,6 +329,7 @@ void SecurityHandshaker::OnPeerCheckedInner(grpc_error* error) {
   grpc_channel_args* tmp_args = args_->args;
   args_->args = grpc_channel_args_copy_and_add(tmp_args, &auth_context_arg, 1);
   grpc_channel_args_destroy(tmp_args);
+  GRPC_STATS_INC_HANDSHAKE_DURATION(MicrosSince(handshake_start_));
   // Invoke callback.
   ExecCtx::Run(DEBUG_LOCATION, on_handshake_done_, GRPC_ERROR_NONE);
   // Set shutdown to true so that subsequent calls to
@@ -357,13 +430,23 @@ void SecurityHandshaker::OnHandshakeNextDoneGrpcWrapper(
 
 grpc_error* SecurityHandshaker::DoHandshakerNextLocked(
     const unsigned char* bytes_received, size_t bytes_received_size) {
+  if (offload_handshakes_) {
+    return OffloadHandshakerNextLocked(bytes_received, bytes_received_size);
+  }
+  return RunHandshakerNextLocked(bytes_received, bytes_received_size);
+}
+
+grpc_error* SecurityHandshaker::RunHandshakerNextLocked(
+    const unsigned char* bytes_received, size_t bytes_received_size) {
   // Invoke TSI handshaker.
   const unsigned char* bytes_to_send = nullptr;
   size_t bytes_to_send_size = 0;
   tsi_handshaker_result* hs_result = nullptr;
+  gpr_timespec step_start = gpr_now(GPR_CLOCK_MONOTONIC);
   tsi_result result = tsi_handshaker_next(
       handshaker_, bytes_received, bytes_received_size, &bytes_to_send,
       &bytes_to_send_size, &hs_result, &OnHandshakeNextDoneGrpcWrapper, this);
+  GRPC_STATS_INC_HANDSHAKE_STEP_TIME(MicrosSince(step_start));
   if (result == TSI_ASYNC) {
     // Handshaker operating asynchronously. Nothing else to do here;
     // callback will be invoked in a TSI thread.
@@ -375,6 +458,48 @@ grpc_error* SecurityHandshaker::DoHandshakerNextLocked(
                                    hs_result);
 }
 
+// Queues the next TSI handshaker step on the handshake thread pool, unless
+// too many steps are already waiting for it. The bytes received stay in
+// handshake_buffer_, which is not touched until the step has run.
+grpc_error* SecurityHandshaker::OffloadHandshakerNextLocked(
+    const unsigned char* bytes_received, size_t bytes_received_size) {
+  ThreadPool* pool = g_handshake_pool;
+  if (pool->num_pending_closures() >= offload_max_pending_) {
+    GRPC_STATS_INC_HANDSHAKE_OFFLOAD_REJECTED();
+    return grpc_error_set_int(
+        GRPC_ERROR_CREATE_FROM_STATIC_STRING("Handshake offload queue full"),
+        GRPC_ERROR_INT_GRPC_STATUS, GRPC_STATUS_UNAVAILABLE);
+  }
+  GRPC_STATS_INC_HANDSHAKE_STEPS_OFFLOADED();
+  offloaded_bytes_received_ = bytes_received;
+  offloaded_bytes_received_size_ = bytes_received_size;
+  offload_enqueue_time_ = gpr_now(GPR_CLOCK_MONOTONIC);
+  pool->Add(&offloaded_step_);
+  return GRPC_ERROR_NONE;
+}
+
+void SecurityHandshaker::OnOffloadedHandshakerNext(
+    grpc_experimental_completion_queue_functor* functor, int /*ok*/) {
+  ExecCtx exec_ctx;
+  RefCountedPtr<SecurityHandshaker> h(
+      static_cast<OffloadedStep*>(functor)->handshaker);
+  MutexLock lock(&h->mu_);
+  GRPC_STATS_INC_HANDSHAKE_OFFLOAD_QUEUE_TIME(
+      MicrosSince(h->offload_enqueue_time_));
+  if (h->is_shutdown_) {
+    h->HandshakeFailedLocked(
+        GRPC_ERROR_CREATE_FROM_STATIC_STRING("Handshaker shutdown"));
+    return;
+  }
+  grpc_error* error = h->RunHandshakerNextLocked(
+      h->offloaded_bytes_received_, h->offloaded_bytes_received_size_);
+  if (error != GRPC_ERROR_NONE) {
+    h->HandshakeFailedLocked(error);
+  } else {
+    h.release();  // Avoid unref
+  }
+}
+
 // This callback might be run inline while we are still holding on to the mutex,
 // so schedule OnHandshakeDataReceivedFromPeerFn on ExecCtx to avoid a deadlock.
 void SecurityHandshaker::OnHandshakeDataReceivedFromPeerFnScheduler(
@@ -472,6 +597,7 @@ void SecurityHandshaker::DoHandshake(grpc_tcp_server_acceptor* /*acceptor*/,
   MutexLock lock(&mu_);
   args_ = args;
   on_handshake_done_ = on_handshake_done;
+  handshake_start_ = gpr_now(GPR_CLOCK_MONOTONIC);
   size_t bytes_received_size = MoveReadBufferIntoHandshakeBuffer();
   grpc_error* error =
       DoHandshakerNextLocked(handshake_buffer_, bytes_received_size);
@@ -565,6 +691,19 @@ void SecurityRegisterHandshakerFactories() {
       absl::make_unique<ServerSecurityHandshakerFactory>());
 }
 
+void SecurityHandshakerPoolInit() {
+  GPR_ASSERT(g_handshake_pool == nullptr);
+  g_handshake_pool = new ThreadPool(
+      gpr_cpu_num_cores(), "grpc_handshake",
+      Thread::Options().set_stack_size(GRPC_HANDSHAKE_THREAD_STACK_SIZE));
+}
+
+void SecurityHandshakerPoolShutdown() {
+  // Joins the pool's threads once they have run every queued step.
+  delete g_handshake_pool;
+  g_handshake_pool = nullptr;
+}
+
 }  // namespace grpc_core
 
 grpc_handshaker* grpc_security_handshaker_create(
@@ -34,6 +34,11 @@ RefCountedPtr<Handshaker> SecurityHandshakerCreate(
 /// Registers security handshaker factories.
 void SecurityRegisterHandshakerFactories();
 
+/// Creates and destroys the thread pool that offloaded handshake steps run
+/// on.  Called from grpc_init() and grpc_shutdown().
+void SecurityHandshakerPoolInit();
+void SecurityHandshakerPoolShutdown();
+
 }  // namespace grpc_core
 
 // TODO(arjunroy): This is transitional to account for the new handshaker API
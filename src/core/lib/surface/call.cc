@@ -31,6 +31,7 @@
 #include <grpc/support/log.h>
 #include <grpc/support/string_util.h>
 
+#include "src/core/lib/channel/call_profiler.h"
 #include "src/core/lib/channel/channel_stack.h"
 #include "src/core/lib/compression/algorithm_metadata.h"
 #include "src/core/lib/debug/stats.h"
@@ -1222,6 +1223,10 @@ static void post_batch_completion(batch_control* bctl) {
   }
   reset_batch_errors(bctl);
 
+  grpc_core::CallProfile* profile =
+      grpc_core::CallProfile::FromContext(call->context);
+  if (GPR_UNLIKELY(profile != nullptr)) profile->BatchCompleted();
+
   if (bctl->completion_data.notify_tag.is_closure) {
     /* unrefs error */
     bctl->call = nullptr;
@@ -1580,6 +1585,12 @@ static grpc_call_error call_start_batch(grpc_call* call, const grpc_op* ops,
     goto done;
   }
 
+  {
+    grpc_core::CallProfile* profile =
+        grpc_core::CallProfile::FromContext(call->context);
+    if (GPR_UNLIKELY(profile != nullptr)) profile->BatchStarted();
+  }
+
   bctl = reuse_or_allocate_batch_control(call, ops);
   if (bctl == nullptr) {
     return GRPC_CALL_ERROR_TOO_MANY_OPERATIONS;
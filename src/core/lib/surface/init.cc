@@ -26,6 +26,8 @@
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
 #include <grpc/support/time.h>
+#include "src/core/lib/channel/call_profiler.h"
+#include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/channel_stack.h"
 #include "src/core/lib/channel/channelz_registry.h"
 #include "src/core/lib/channel/connected_channel.h"
@@ -88,6 +90,18 @@ static bool prepend_filter(grpc_channel_stack_builder* builder, void* arg) {
       builder, static_cast<const grpc_channel_filter*>(arg), nullptr, nullptr);
 }
 
+static bool maybe_prepend_call_profiler_filter(
+    grpc_channel_stack_builder* builder, void* arg) {
+  const grpc_channel_args* args =
+      grpc_channel_stack_builder_get_channel_arguments(builder);
+  if (!grpc_channel_args_find_bool(args, GRPC_ARG_ENABLE_CALL_PROFILING,
+                                   false)) {
+    return true;
+  }
+  return grpc_channel_stack_builder_prepend_filter(
+      builder, static_cast<const grpc_channel_filter*>(arg), nullptr, nullptr);
+}
+
 static void register_builtin_channel_init() {
   grpc_channel_init_register_stage(GRPC_CLIENT_SUBCHANNEL,
                                    GRPC_CHANNEL_INIT_BUILTIN_PRIORITY,
@@ -103,6 +117,18 @@ static void register_builtin_channel_init() {
                                    append_filter, (void*)&grpc_lame_filter);
   grpc_channel_init_register_stage(GRPC_SERVER_CHANNEL, INT_MAX, prepend_filter,
                                    (void*)&grpc_server_top_filter);
+  // The call profiler sits just below the top of the stack (and below the
+  // server top filter, which consumes :path) so it sees every batch.
+  grpc_channel_init_register_stage(
+      GRPC_CLIENT_CHANNEL, INT_MAX - 1, maybe_prepend_call_profiler_filter,
+      (void*)&grpc_client_call_profiler_filter);
+  grpc_channel_init_register_stage(
+      GRPC_CLIENT_DIRECT_CHANNEL, INT_MAX - 1,
+      maybe_prepend_call_profiler_filter,
+      (void*)&grpc_client_call_profiler_filter);
+  grpc_channel_init_register_stage(
+      GRPC_SERVER_CHANNEL, INT_MAX - 1, maybe_prepend_call_profiler_filter,
+      (void*)&grpc_server_call_profiler_filter);
 }
 
 typedef struct grpc_plugin {
@@ -173,6 +199,7 @@ void grpc_shutdown_internal_locked(void) {
     {
       grpc_timer_manager_set_threading(false);  // shutdown timer_manager thread
       grpc_core::Executor::ShutdownAll();
+      grpc_security_shutdown();
       for (i = g_number_of_plugins; i >= 0; i--) {
         if (g_all_of_the_plugins[i].destroy != nullptr) {
           g_all_of_the_plugins[i].destroy();
@@ -78,4 +78,9 @@ void grpc_register_security_filters(void) {
                                    maybe_prepend_server_auth_filter, nullptr);
 }
 
-void grpc_security_init() { grpc_core::SecurityRegisterHandshakerFactories(); }
+void grpc_security_init() {
+  grpc_core::SecurityRegisterHandshakerFactories();
+  grpc_core::SecurityHandshakerPoolInit();
+}
+
+void grpc_security_shutdown() { grpc_core::SecurityHandshakerPoolShutdown(); }
@@ -193,7 +193,7 @@ static void alts_grpc_integrity_only_destruct(alts_grpc_record_protocol* rp) {
 static const alts_grpc_record_protocol_vtable
     alts_grpc_integrity_only_record_protocol_vtable = {
         alts_grpc_integrity_only_protect, alts_grpc_integrity_only_unprotect,
-        alts_grpc_integrity_only_destruct};
+        nullptr, nullptr, alts_grpc_integrity_only_destruct};
 
 tsi_result alts_grpc_integrity_only_record_protocol_create(
     gsec_aead_crypter* crypter, size_t overflow_size, bool is_client,
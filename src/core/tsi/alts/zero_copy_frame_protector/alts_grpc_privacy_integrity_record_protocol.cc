@@ -23,6 +23,7 @@
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
 
+#include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/slice/slice_internal.h"
 #include "src/core/tsi/alts/zero_copy_frame_protector/alts_grpc_record_protocol_common.h"
 #include "src/core/tsi/alts/zero_copy_frame_protector/alts_iovec_record_protocol.h"
@@ -30,6 +31,10 @@
 /* Privacy-integrity alts_grpc_record_protocol object uses the same struct
  * defined in alts_grpc_record_protocol_common.h.  */
 
+/* Upper bound on the size of the buffer a batch of frames is sealed into or
+ * opened into. Past this, a larger buffer stops paying for itself.  */
+constexpr size_t kMaxBatchSize = 32 * 1024;
+
 /* --- alts_grpc_record_protocol methods implementation. --- */
 
 static tsi_result alts_grpc_privacy_integrity_protect(
@@ -115,10 +120,176 @@ static tsi_result alts_grpc_privacy_integrity_unprotect(
   return TSI_OK;
 }
 
+/* Seals frames in batches, each into one newly allocated buffer, reading the
+ * unprotected data in place. This avoids a slice buffer split and an
+ * allocation per frame, and keeps the AEAD crypter busy on back to back frames.
+ */
+static tsi_result alts_grpc_privacy_integrity_protect_frames(
+    alts_grpc_record_protocol* rp, grpc_slice_buffer* unprotected_slices,
+    size_t max_unprotected_data_size, grpc_slice_buffer* protected_slices) {
+  /* Input sanity check.  */
+  if (rp == nullptr || unprotected_slices == nullptr ||
+      protected_slices == nullptr || max_unprotected_data_size == 0) {
+    gpr_log(GPR_ERROR,
+            "Invalid arguments to alts_grpc_record_protocol protect_frames.");
+    return TSI_INVALID_ARGUMENT;
+  }
+  size_t data_length = unprotected_slices->length;
+  /* An empty input still produces one (empty) frame, as protect does.  */
+  size_t num_frames =
+      data_length == 0
+          ? 1
+          : (data_length + max_unprotected_data_size - 1) /
+                max_unprotected_data_size;
+  size_t frame_overhead = rp->header_length + rp->tag_length;
+  size_t frames_per_batch = GPR_MAX(
+      1, kMaxBatchSize / (max_unprotected_data_size + frame_overhead));
+  alts_grpc_slice_buffer_reader reader;
+  alts_grpc_slice_buffer_reader_init(&reader, unprotected_slices);
+  while (num_frames > 0) {
+    size_t batch_frames = GPR_MIN(num_frames, frames_per_batch);
+    size_t batch_data_length =
+        GPR_MIN(data_length, batch_frames * max_unprotected_data_size);
+    grpc_slice protected_slice =
+        GRPC_SLICE_MALLOC(batch_data_length + batch_frames * frame_overhead);
+    unsigned char* frame = GRPC_SLICE_START_PTR(protected_slice);
+    for (size_t i = 0; i < batch_frames; i++) {
+      size_t frame_data_length =
+          GPR_MIN(data_length, max_unprotected_data_size);
+      size_t iovec_count = alts_grpc_slice_buffer_reader_next_iovec(
+          rp, &reader, frame_data_length);
+      iovec_t protected_iovec = {frame, frame_data_length + frame_overhead};
+      char* error_details = nullptr;
+      grpc_status_code status =
+          alts_iovec_record_protocol_privacy_integrity_protect(
+              rp->iovec_rp, rp->iovec_buf, iovec_count, protected_iovec,
+              &error_details);
+      if (status != GRPC_STATUS_OK) {
+        gpr_log(GPR_ERROR, "Failed to protect, %s", error_details);
+        gpr_free(error_details);
+        grpc_slice_unref_internal(protected_slice);
+        return TSI_INTERNAL_ERROR;
+      }
+      frame += protected_iovec.iov_len;
+      data_length -= frame_data_length;
+    }
+    grpc_slice_buffer_add(protected_slices, protected_slice);
+    alts_grpc_slice_buffer_reader_release_consumed(&reader, unprotected_slices);
+    num_frames -= batch_frames;
+  }
+  grpc_slice_buffer_reset_and_unref_internal(unprotected_slices);
+  return TSI_OK;
+}
+
+/* Reads the frame header at the reader position into header and returns the
+ * size of the frame excluding its length field, or zero if the frame is
+ * malformed or does not fit into the remaining bytes.  */
+static size_t read_frame_header(const alts_grpc_record_protocol* rp,
+                                alts_grpc_slice_buffer_reader* reader,
+                                size_t remaining, unsigned char* header) {
+  if (remaining < rp->header_length + rp->tag_length) {
+    return 0;
+  }
+  alts_grpc_slice_buffer_reader_copy(reader, header, rp->header_length);
+  size_t frame_length = (static_cast<size_t>(header[3]) << 24) |
+                        (static_cast<size_t>(header[2]) << 16) |
+                        (static_cast<size_t>(header[1]) << 8) |
+                        static_cast<size_t>(header[0]);
+  if (frame_length < kZeroCopyFrameMessageTypeFieldSize + rp->tag_length ||
+      frame_length > remaining - kZeroCopyFrameLengthFieldSize) {
+    return 0;
+  }
+  return frame_length;
+}
+
+/* Opens frames in batches, each into one newly allocated buffer. A scan
+ * ahead over the frame headers sizes each batch before it is allocated.  */
+static tsi_result alts_grpc_privacy_integrity_unprotect_frames(
+    alts_grpc_record_protocol* rp, grpc_slice_buffer* protected_slices,
+    grpc_slice_buffer* unprotected_slices) {
+  /* Input sanity check.  */
+  if (rp == nullptr || protected_slices == nullptr ||
+      unprotected_slices == nullptr) {
+    gpr_log(GPR_ERROR,
+            "Invalid nullptr arguments to alts_grpc_record_protocol "
+            "unprotect_frames.");
+    return TSI_INVALID_ARGUMENT;
+  }
+  if (protected_slices->length == 0) {
+    return TSI_OK;
+  }
+  size_t data_overhead = kZeroCopyFrameMessageTypeFieldSize + rp->tag_length;
+  unsigned char scan_header[kZeroCopyFrameHeaderSize];
+  alts_grpc_slice_buffer_reader scan;
+  alts_grpc_slice_buffer_reader_init(&scan, protected_slices);
+  size_t scan_remaining = protected_slices->length;
+  size_t next_frame_length =
+      read_frame_header(rp, &scan, scan_remaining, scan_header);
+  alts_grpc_slice_buffer_reader reader;
+  alts_grpc_slice_buffer_reader_init(&reader, protected_slices);
+  size_t remaining = protected_slices->length;
+  iovec_t header_iovec = {rp->header_buf, rp->header_length};
+  while (remaining > 0) {
+    /* Sizes the next batch by scanning ahead over its frame headers.  */
+    size_t batch_frames = 0;
+    size_t batch_length = 0;
+    do {
+      if (next_frame_length == 0) {
+        gpr_log(GPR_ERROR, "Protected slices do not hold complete frames.");
+        return TSI_INVALID_ARGUMENT;
+      }
+      alts_grpc_slice_buffer_reader_copy(
+          &scan, nullptr,
+          next_frame_length - kZeroCopyFrameMessageTypeFieldSize);
+      batch_frames++;
+      batch_length += next_frame_length - data_overhead;
+      scan_remaining -= kZeroCopyFrameLengthFieldSize + next_frame_length;
+      next_frame_length =
+          scan_remaining == 0
+              ? 0
+              : read_frame_header(rp, &scan, scan_remaining, scan_header);
+    } while (scan_remaining > 0 &&
+             (next_frame_length == 0 ||
+              batch_length + next_frame_length - data_overhead <=
+                  kMaxBatchSize));
+    grpc_slice unprotected_slice = GRPC_SLICE_MALLOC(batch_length);
+    unsigned char* data = GRPC_SLICE_START_PTR(unprotected_slice);
+    for (size_t i = 0; i < batch_frames; i++) {
+      size_t frame_length =
+          read_frame_header(rp, &reader, remaining, rp->header_buf);
+      size_t iovec_count = alts_grpc_slice_buffer_reader_next_iovec(
+          rp, &reader, frame_length - kZeroCopyFrameMessageTypeFieldSize);
+      iovec_t unprotected_iovec = {data, frame_length - data_overhead};
+      char* error_details = nullptr;
+      grpc_status_code status =
+          alts_iovec_record_protocol_privacy_integrity_unprotect(
+              rp->iovec_rp, header_iovec, rp->iovec_buf, iovec_count,
+              unprotected_iovec, &error_details);
+      if (status != GRPC_STATUS_OK) {
+        gpr_log(GPR_ERROR, "Failed to unprotect, %s", error_details);
+        gpr_free(error_details);
+        grpc_slice_unref_internal(unprotected_slice);
+        return TSI_INTERNAL_ERROR;
+      }
+      data += unprotected_iovec.iov_len;
+      remaining -= kZeroCopyFrameLengthFieldSize + frame_length;
+    }
+    grpc_slice_buffer_add(unprotected_slices, unprotected_slice);
+    /* The scan is ahead of the reader, so it is still within the slices that
+     * remain.  */
+    scan.slice_index -= alts_grpc_slice_buffer_reader_release_consumed(
+        &reader, protected_slices);
+  }
+  grpc_slice_buffer_reset_and_unref_internal(protected_slices);
+  return TSI_OK;
+}
+
 static const alts_grpc_record_protocol_vtable
     alts_grpc_privacy_integrity_record_protocol_vtable = {
         alts_grpc_privacy_integrity_protect,
-        alts_grpc_privacy_integrity_unprotect, nullptr};
+        alts_grpc_privacy_integrity_unprotect,
+        alts_grpc_privacy_integrity_protect_frames,
+        alts_grpc_privacy_integrity_unprotect_frames, nullptr};
 
 tsi_result alts_grpc_privacy_integrity_record_protocol_create(
     gsec_aead_crypter* crypter, size_t overflow_size, bool is_client,
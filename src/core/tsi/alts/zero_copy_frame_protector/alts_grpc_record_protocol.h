@@ -68,6 +68,44 @@ tsi_result alts_grpc_record_protocol_unprotect(
     alts_grpc_record_protocol* self, grpc_slice_buffer* protected_slices,
     grpc_slice_buffer* unprotected_slices);
 
+/**
+ * This method protects all of unprotected_slices as a sequence of frames, each
+ * carrying at most max_unprotected_data_size bytes of data, and appends the
+ * protected frames to protected_slices. Implementations that support it seal
+ * consecutive frames in batches, each into a single allocation, reading the
+ * input slices in place; the others protect the frames one at a time. The
+ * input unprotected data slice buffer will be cleared.
+ *
+ * - self: an alts_grpc_record_protocol instance.
+ * - unprotected_slices: the unprotected data to be protected.
+ * - max_unprotected_data_size: maximum data size carried by a single frame.
+ * - protected_slices: slice buffer where the protected frames are appended.
+ *
+ * This method returns TSI_OK in case of success or a specific error code in
+ * case of failure.
+ */
+tsi_result alts_grpc_record_protocol_protect_frames(
+    alts_grpc_record_protocol* self, grpc_slice_buffer* unprotected_slices,
+    size_t max_unprotected_data_size, grpc_slice_buffer* protected_slices);
+
+/**
+ * This method unprotects one or more full frames of protected data stored
+ * back to back in protected_slices and appends the unprotected data to
+ * unprotected_slices. It is the caller's responsibility to make sure that
+ * protected_slices holds only complete frames. The input protected frames
+ * slice buffer will be cleared.
+ *
+ * - self: an alts_grpc_record_protocol instance.
+ * - protected_slices: one or more full frames of protected data.
+ * - unprotected_slices: slice buffer where unprotected data is appended.
+ *
+ * This method returns TSI_OK in case of success or a specific error code in
+ * case of failure.
+ */
+tsi_result alts_grpc_record_protocol_unprotect_frames(
+    alts_grpc_record_protocol* self, grpc_slice_buffer* protected_slices,
+    grpc_slice_buffer* unprotected_slices);
+
 /**
  * This method returns maximum allowed unprotected data size, given maximum
  * protected frame size.
@@ -31,15 +31,15 @@
 
 const size_t kInitialIovecBufferSize = 8;
 
-/* Makes sure iovec_buf in alts_grpc_record_protocol is large enough.  */
-static void ensure_iovec_buf_size(alts_grpc_record_protocol* rp,
-                                  const grpc_slice_buffer* sb) {
-  GPR_ASSERT(rp != nullptr && sb != nullptr);
-  if (sb->count <= rp->iovec_buf_length) {
+/* Makes sure iovec_buf in alts_grpc_record_protocol holds at least count
+ * entries.  */
+static void ensure_iovec_buf_size(alts_grpc_record_protocol* rp, size_t count) {
+  GPR_ASSERT(rp != nullptr);
+  if (count <= rp->iovec_buf_length) {
     return;
   }
   /* At least double the iovec buffer size.  */
-  rp->iovec_buf_length = GPR_MAX(sb->count, 2 * rp->iovec_buf_length);
+  rp->iovec_buf_length = GPR_MAX(count, 2 * rp->iovec_buf_length);
   rp->iovec_buf = static_cast<iovec_t*>(
       gpr_realloc(rp->iovec_buf, rp->iovec_buf_length * sizeof(iovec_t)));
 }
@@ -50,13 +50,78 @@ static void ensure_iovec_buf_size(alts_grpc_record_protocol* rp,
 void alts_grpc_record_protocol_convert_slice_buffer_to_iovec(
     alts_grpc_record_protocol* rp, const grpc_slice_buffer* sb) {
   GPR_ASSERT(rp != nullptr && sb != nullptr);
-  ensure_iovec_buf_size(rp, sb);
+  ensure_iovec_buf_size(rp, sb->count);
   for (size_t i = 0; i < sb->count; i++) {
     rp->iovec_buf[i].iov_base = GRPC_SLICE_START_PTR(sb->slices[i]);
     rp->iovec_buf[i].iov_len = GRPC_SLICE_LENGTH(sb->slices[i]);
   }
 }
 
+void alts_grpc_slice_buffer_reader_init(alts_grpc_slice_buffer_reader* reader,
+                                        const grpc_slice_buffer* sb) {
+  GPR_ASSERT(reader != nullptr && sb != nullptr);
+  reader->sb = sb;
+  reader->slice_index = 0;
+  reader->slice_offset = 0;
+}
+
+size_t alts_grpc_slice_buffer_reader_next_iovec(
+    alts_grpc_record_protocol* rp, alts_grpc_slice_buffer_reader* reader,
+    size_t length) {
+  GPR_ASSERT(rp != nullptr && reader != nullptr);
+  size_t count = 0;
+  while (length > 0) {
+    GPR_ASSERT(reader->slice_index < reader->sb->count);
+    grpc_slice* slice = &reader->sb->slices[reader->slice_index];
+    size_t available = GRPC_SLICE_LENGTH(*slice) - reader->slice_offset;
+    size_t to_take = GPR_MIN(available, length);
+    ensure_iovec_buf_size(rp, count + 1);
+    rp->iovec_buf[count].iov_base =
+        GRPC_SLICE_START_PTR(*slice) + reader->slice_offset;
+    rp->iovec_buf[count].iov_len = to_take;
+    count++;
+    length -= to_take;
+    reader->slice_offset += to_take;
+    if (reader->slice_offset == GRPC_SLICE_LENGTH(*slice)) {
+      reader->slice_index++;
+      reader->slice_offset = 0;
+    }
+  }
+  return count;
+}
+
+void alts_grpc_slice_buffer_reader_copy(alts_grpc_slice_buffer_reader* reader,
+                                        unsigned char* dst, size_t length) {
+  GPR_ASSERT(reader != nullptr);
+  while (length > 0) {
+    GPR_ASSERT(reader->slice_index < reader->sb->count);
+    grpc_slice* slice = &reader->sb->slices[reader->slice_index];
+    size_t available = GRPC_SLICE_LENGTH(*slice) - reader->slice_offset;
+    size_t to_take = GPR_MIN(available, length);
+    if (dst != nullptr) {
+      memcpy(dst, GRPC_SLICE_START_PTR(*slice) + reader->slice_offset, to_take);
+      dst += to_take;
+    }
+    length -= to_take;
+    reader->slice_offset += to_take;
+    if (reader->slice_offset == GRPC_SLICE_LENGTH(*slice)) {
+      reader->slice_index++;
+      reader->slice_offset = 0;
+    }
+  }
+}
+
+size_t alts_grpc_slice_buffer_reader_release_consumed(
+    alts_grpc_slice_buffer_reader* reader, grpc_slice_buffer* sb) {
+  GPR_ASSERT(reader != nullptr && reader->sb == sb);
+  size_t released = reader->slice_index;
+  for (size_t i = 0; i < released; i++) {
+    grpc_slice_unref_internal(grpc_slice_buffer_take_first(sb));
+  }
+  reader->slice_index = 0;
+  return released;
+}
+
 void alts_grpc_record_protocol_copy_slice_buffer(const grpc_slice_buffer* src,
                                                  unsigned char* dst) {
   GPR_ASSERT(src != nullptr && dst != nullptr);
@@ -148,6 +213,92 @@ tsi_result alts_grpc_record_protocol_unprotect(
   return self->vtable->unprotect(self, protected_slices, unprotected_slices);
 }
 
+tsi_result alts_grpc_record_protocol_protect_frames(
+    alts_grpc_record_protocol* self, grpc_slice_buffer* unprotected_slices,
+    size_t max_unprotected_data_size, grpc_slice_buffer* protected_slices) {
+  if (grpc_core::ExecCtx::Get() == nullptr || self == nullptr ||
+      self->vtable == nullptr || unprotected_slices == nullptr ||
+      protected_slices == nullptr || max_unprotected_data_size == 0) {
+    return TSI_INVALID_ARGUMENT;
+  }
+  if (self->vtable->protect_frames != nullptr) {
+    return self->vtable->protect_frames(self, unprotected_slices,
+                                        max_unprotected_data_size,
+                                        protected_slices);
+  }
+  if (self->vtable->protect == nullptr) {
+    return TSI_UNIMPLEMENTED;
+  }
+  /* Protects one frame at a time.  */
+  grpc_slice_buffer frame_sb;
+  grpc_slice_buffer_init(&frame_sb);
+  tsi_result result = TSI_OK;
+  while (unprotected_slices->length > max_unprotected_data_size) {
+    grpc_slice_buffer_move_first(unprotected_slices, max_unprotected_data_size,
+                                 &frame_sb);
+    result = self->vtable->protect(self, &frame_sb, protected_slices);
+    if (result != TSI_OK) {
+      break;
+    }
+  }
+  grpc_slice_buffer_destroy_internal(&frame_sb);
+  if (result != TSI_OK) {
+    return result;
+  }
+  return self->vtable->protect(self, unprotected_slices, protected_slices);
+}
+
+tsi_result alts_grpc_record_protocol_unprotect_frames(
+    alts_grpc_record_protocol* self, grpc_slice_buffer* protected_slices,
+    grpc_slice_buffer* unprotected_slices) {
+  if (grpc_core::ExecCtx::Get() == nullptr || self == nullptr ||
+      self->vtable == nullptr || protected_slices == nullptr ||
+      unprotected_slices == nullptr) {
+    return TSI_INVALID_ARGUMENT;
+  }
+  if (self->vtable->unprotect_frames != nullptr) {
+    return self->vtable->unprotect_frames(self, protected_slices,
+                                          unprotected_slices);
+  }
+  if (self->vtable->unprotect == nullptr) {
+    return TSI_UNIMPLEMENTED;
+  }
+  /* Splits off and unprotects one frame at a time.  */
+  grpc_slice_buffer frame_sb;
+  grpc_slice_buffer_init(&frame_sb);
+  tsi_result result = TSI_OK;
+  while (protected_slices->length > 0) {
+    if (protected_slices->length < kZeroCopyFrameLengthFieldSize) {
+      result = TSI_INVALID_ARGUMENT;
+      break;
+    }
+    unsigned char length_field[kZeroCopyFrameLengthFieldSize];
+    alts_grpc_slice_buffer_reader reader;
+    alts_grpc_slice_buffer_reader_init(&reader, protected_slices);
+    alts_grpc_slice_buffer_reader_copy(&reader, length_field,
+                                       kZeroCopyFrameLengthFieldSize);
+    size_t frame_size = kZeroCopyFrameLengthFieldSize +
+                        ((static_cast<size_t>(length_field[3]) << 24) |
+                         (static_cast<size_t>(length_field[2]) << 16) |
+                         (static_cast<size_t>(length_field[1]) << 8) |
+                         static_cast<size_t>(length_field[0]));
+    if (frame_size > protected_slices->length) {
+      result = TSI_INVALID_ARGUMENT;
+      break;
+    }
+    grpc_slice_buffer_move_first(protected_slices, frame_size, &frame_sb);
+    result = self->vtable->unprotect(self, &frame_sb, unprotected_slices);
+    if (result != TSI_OK) {
+      break;
+    }
+  }
+  grpc_slice_buffer_destroy_internal(&frame_sb);
+  if (result != TSI_OK) {
+    grpc_slice_buffer_reset_and_unref_internal(protected_slices);
+  }
+  return result;
+}
+
 void alts_grpc_record_protocol_destroy(alts_grpc_record_protocol* self) {
   if (self == nullptr) {
     return;
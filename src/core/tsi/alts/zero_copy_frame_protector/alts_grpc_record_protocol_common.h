@@ -38,6 +38,13 @@ struct alts_grpc_record_protocol_vtable {
   tsi_result (*unprotect)(alts_grpc_record_protocol* self,
                           grpc_slice_buffer* protected_slices,
                           grpc_slice_buffer* unprotected_slices);
+  tsi_result (*protect_frames)(alts_grpc_record_protocol* self,
+                               grpc_slice_buffer* unprotected_slices,
+                               size_t max_unprotected_data_size,
+                               grpc_slice_buffer* protected_slices);
+  tsi_result (*unprotect_frames)(alts_grpc_record_protocol* self,
+                                 grpc_slice_buffer* protected_slices,
+                                 grpc_slice_buffer* unprotected_slices);
   void (*destruct)(alts_grpc_record_protocol* self);
 };
 /* Main struct for alts_grpc_record_protocol implementation, shared by both
@@ -63,6 +70,43 @@ struct alts_grpc_record_protocol {
 void alts_grpc_record_protocol_convert_slice_buffer_to_iovec(
     alts_grpc_record_protocol* rp, const grpc_slice_buffer* sb);
 
+/* Walks the bytes of a slice buffer front to back without consuming it, so
+ * that several frames stored in one slice buffer can be processed in place. */
+struct alts_grpc_slice_buffer_reader {
+  const grpc_slice_buffer* sb;
+  size_t slice_index;
+  size_t slice_offset;
+};
+
+/* Positions reader at the first byte of sb.  */
+void alts_grpc_slice_buffer_reader_init(alts_grpc_slice_buffer_reader* reader,
+                                        const grpc_slice_buffer* sb);
+
+/**
+ * Points rp->iovec_buf at the next length bytes of the reader and advances the
+ * reader past them. Returns the number of iovec_t's filled. As with
+ * alts_grpc_record_protocol_convert_slice_buffer_to_iovec, no data is copied.
+ */
+size_t alts_grpc_slice_buffer_reader_next_iovec(
+    alts_grpc_record_protocol* rp, alts_grpc_slice_buffer_reader* reader,
+    size_t length);
+
+/**
+ * Copies the next length bytes of the reader to dst, if dst is not nullptr,
+ * and advances the reader past them.
+ */
+void alts_grpc_slice_buffer_reader_copy(alts_grpc_slice_buffer_reader* reader,
+                                        unsigned char* dst, size_t length);
+
+/**
+ * Unrefs the slices at the front of sb that the reader has fully consumed, so
+ * that their memory can be reused while the rest of sb is being processed.
+ * sb must be the slice buffer the reader was initialized with. Returns the
+ * number of slices removed.
+ */
+size_t alts_grpc_slice_buffer_reader_release_consumed(
+    alts_grpc_slice_buffer_reader* reader, grpc_slice_buffer* sb);
+
 /**
  * Copies bytes from slice buffer to destination buffer. Caller is responsible
  * for allocating enough memory of destination buffer. This method is used for
@@ -23,6 +23,8 @@
 #include <limits.h>
 #include <string.h>
 
+#include <string>
+
 /* TODO(jboeuf): refactor inet_ntop into a portability header. */
 /* Note: for whomever reads this and tries to refactor this, this
    can't be in grpc, it has to be in gpr. */
@@ -48,15 +50,20 @@ extern "C" {
 #include <openssl/crypto.h> /* For OPENSSL_free */
 #include <openssl/engine.h>
 #include <openssl/err.h>
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+#include <openssl/rand.h>
 #include <openssl/ssl.h>
 #include <openssl/x509.h>
 #include <openssl/x509v3.h>
 }
 
 #include "src/core/lib/gpr/useful.h"
+#include "src/core/lib/iomgr/port.h"
 #include "src/core/tsi/ssl/session_cache/ssl_session_cache.h"
 #include "src/core/tsi/ssl_types.h"
 #include "src/core/tsi/transport_security.h"
+#include "src/core/tsi/transport_security_grpc.h"
 
 /* --- Constants. ---*/
 
@@ -75,6 +82,38 @@ extern "C" {
    SSL structure. This is what we would ultimately want though... */
 #define TSI_SSL_MAX_PROTECTION_OVERHEAD 100
 
+/* Handing the sending direction to kernel TLS needs the negotiated traffic
+   keys, which OpenSSL only exposes from 1.1.1 on. */
+#if defined(GRPC_LINUX_KTLS) && \
+    (defined(OPENSSL_IS_BORINGSSL) || OPENSSL_VERSION_NUMBER >= 0x10101000L)
+#define TSI_SSL_KERNEL_TLS 1
+#include <linux/tls.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#endif
+
+/* The zero-copy protector plugs a custom BIO in the SSL object, which needs
+   the BIO_meth API of OpenSSL 1.1.0. */
+#if defined(OPENSSL_IS_BORINGSSL) || OPENSSL_VERSION_NUMBER >= 0x10100000L
+#define TSI_SSL_ZERO_COPY_PROTECTOR 1
+#endif
+
+/* Session tickets are encrypted with AES-128-CBC and authenticated with
+   HMAC-SHA256 when the server uses rotating ticket keys. OpenSSL 3 deprecates
+   the HMAC_CTX based ticket key callback in favour of an EVP_MAC one. */
+#if !defined(OPENSSL_IS_BORINGSSL) && OPENSSL_VERSION_NUMBER >= 0x30000000L
+#define TSI_SSL_TICKET_KEY_EVP_CB 1
+#include <openssl/core_names.h>
+#endif
+
+#define TSI_SSL_SESSION_TICKET_KEY_NAME_SIZE 16
+#define TSI_SSL_SESSION_TICKET_HMAC_KEY_SIZE 16
+#define TSI_SSL_SESSION_TICKET_AES_KEY_SIZE 16
+
+/* Length of the hex encoded credentials digest prefixed to the client session
+   cache keys. */
+#define TSI_SSL_SESSION_CACHE_PARTITION_SIZE 16
+
 /* --- Structure definitions. ---*/
 
 struct tsi_ssl_root_certs_store {
@@ -84,6 +123,7 @@ struct tsi_ssl_root_certs_store {
 struct tsi_ssl_handshaker_factory {
   const tsi_ssl_handshaker_factory_vtable* vtable;
   gpr_refcount refcount;
+  bool use_zero_copy_protector;
 };
 
 struct tsi_ssl_client_handshaker_factory {
@@ -92,6 +132,11 @@ struct tsi_ssl_client_handshaker_factory {
   unsigned char* alpn_protocol_list;
   size_t alpn_protocol_list_length;
   grpc_core::RefCountedPtr<tsi::SslSessionLRUCache> session_cache;
+  /* Sessions are cached under this prefix followed by the server name, so
+     that a cache shared between factories never resumes a session with a
+     factory that would not have established it with the same trust
+     settings. */
+  char session_cache_partition[TSI_SSL_SESSION_CACHE_PARTITION_SIZE + 2];
 };
 
 struct tsi_ssl_server_handshaker_factory {
@@ -104,6 +149,22 @@ struct tsi_ssl_server_handshaker_factory {
   size_t ssl_context_count;
   unsigned char* alpn_protocol_list;
   size_t alpn_protocol_list_length;
+  tsi_ssl_session_ticket_keys* session_ticket_keys;
+};
+
+struct tsi_ssl_session_ticket_key {
+  unsigned char name[TSI_SSL_SESSION_TICKET_KEY_NAME_SIZE];
+  unsigned char hmac_key[TSI_SSL_SESSION_TICKET_HMAC_KEY_SIZE];
+  unsigned char aes_key[TSI_SSL_SESSION_TICKET_AES_KEY_SIZE];
+};
+
+struct tsi_ssl_session_ticket_keys {
+  gpr_refcount refcount;
+  gpr_mu mu;
+  /* Most recent key first. */
+  tsi_ssl_session_ticket_key* keys;
+  size_t num_keys;
+  size_t max_keys;
 };
 
 struct tsi_ssl_handshaker {
@@ -121,6 +182,8 @@ struct tsi_ssl_handshaker_result {
   BIO* network_io;
   unsigned char* unused_bytes;
   size_t unused_bytes_size;
+  bool kernel_tls_tx;
+  bool use_zero_copy_protector;
 };
 struct tsi_ssl_frame_protector {
   tsi_frame_protector base;
@@ -129,11 +192,47 @@ struct tsi_ssl_frame_protector {
   unsigned char* buffer;
   size_t buffer_size;
   size_t buffer_offset;
+  /* The kernel protects the sending direction; only unprotect may be used. */
+  bool kernel_tls_tx;
+};
+#ifdef TSI_SSL_ZERO_COPY_PROTECTOR
+/* State of the slice BIO of a zero-copy protector: SSL reads protected bytes
+   straight from incoming and appends the records it writes to outgoing. */
+struct tsi_ssl_slice_bio_state {
+  grpc_slice_buffer incoming;
+  grpc_slice_buffer outgoing;
+  /* Unused tail of the slab the records SSL writes are placed in. */
+  grpc_slice write_buffer;
 };
+/* Like the frame protector, this is not thread safe: protect and unprotect
+   share ssl, so the caller must serialize them. */
+struct tsi_ssl_zero_copy_grpc_protector {
+  tsi_zero_copy_grpc_protector base;
+  SSL* ssl;
+  tsi_ssl_slice_bio_state bio_state;
+  /* Coalesces small unprotected slices into full records. */
+  unsigned char* buffer;
+  size_t buffer_size;
+  size_t buffer_offset;
+  /* Unused tail of the last slice unprotected records were read into. */
+  grpc_slice read_buffer;
+  size_t max_frame_size;
+  bool kernel_tls_tx;
+};
+#endif
 /* --- Library Initialization. ---*/
 
 static gpr_once g_init_openssl_once = GPR_ONCE_INIT;
 static int g_ssl_ctx_ex_factory_index = -1;
+#ifdef TSI_SSL_ZERO_COPY_PROTECTOR
+static BIO_METHOD* g_slice_bio_method = nullptr;
+static BIO_METHOD* slice_bio_method_create(void);
+#endif
+#ifdef TSI_SSL_KERNEL_TLS
+static int g_ssl_ex_write_secret_index = -1;
+static void ssl_write_secret_free(void* parent, void* ptr, CRYPTO_EX_DATA* ad,
+                                  int index, long argl, void* argp);
+#endif
 static const unsigned char kSslSessionIdContext[] = {'g', 'r', 'p', 'c'};
 #ifndef OPENSSL_IS_BORINGSSL
 static const char kSslEnginePrefix[] = "engine:";
@@ -184,6 +283,15 @@ static void init_openssl(void) {
   g_ssl_ctx_ex_factory_index =
       SSL_CTX_get_ex_new_index(0, nullptr, nullptr, nullptr, nullptr);
   GPR_ASSERT(g_ssl_ctx_ex_factory_index != -1);
+#ifdef TSI_SSL_KERNEL_TLS
+  g_ssl_ex_write_secret_index = SSL_get_ex_new_index(
+      0, nullptr, nullptr, nullptr, ssl_write_secret_free);
+  GPR_ASSERT(g_ssl_ex_write_secret_index != -1);
+#endif
+#ifdef TSI_SSL_ZERO_COPY_PROTECTOR
+  g_slice_bio_method = slice_bio_method_create();
+  GPR_ASSERT(g_slice_bio_method != nullptr);
+#endif
 }
 
 /* --- Ssl utils. ---*/
@@ -234,6 +342,299 @@ static void ssl_info_callback(const SSL* ssl, int where, int ret) {
   ssl_log_where_info(ssl, where, SSL_CB_HANDSHAKE_DONE, "HANDSHAKE DONE");
 }
 
+/* --- Kernel TLS offload. ---
+
+   Once the handshake is done, the keys of the sending direction are derived
+   again from the session and installed in the kernel TLS ULP of the socket,
+   which from then on protects everything written to it. The receiving
+   direction stays in user space: the kernel would hand non-application
+   records (alerts, tickets, key updates) to the reader as control messages,
+   which the TCP endpoint does not handle. */
+
+#ifdef TSI_SSL_KERNEL_TLS
+
+#ifndef SOL_TLS
+#define SOL_TLS 282
+#endif
+#ifndef TCP_ULP
+#define TCP_ULP 31
+#endif
+
+#define TSI_SSL_KERNEL_TLS_SALT_SIZE 4
+#define TSI_SSL_KERNEL_TLS_NONCE_SIZE 12
+
+/* TLS 1.3 application traffic secret of the sending direction, captured by the
+   key log callback. */
+struct tsi_ssl_write_secret {
+  unsigned char secret[EVP_MAX_MD_SIZE];
+  size_t size;
+};
+
+static void ssl_write_secret_free(void* /*parent*/, void* ptr,
+                                  CRYPTO_EX_DATA* /*ad*/, int /*index*/,
+                                  long /*argl*/, void* /*argp*/) {
+  if (ptr == nullptr) return;
+  OPENSSL_cleanse(ptr, sizeof(tsi_ssl_write_secret));
+  gpr_free(ptr);
+}
+
+/* Wipes the captured secret once the offload has been set up or given up. */
+static void ssl_discard_write_secret(SSL* ssl) {
+  ssl_write_secret_free(nullptr,
+                        SSL_get_ex_data(ssl, g_ssl_ex_write_secret_index),
+                        nullptr, 0, 0, nullptr);
+  SSL_set_ex_data(ssl, g_ssl_ex_write_secret_index, nullptr);
+}
+
+static int hex_digit_value(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+/* Key log lines have the NSS format "<label> <client random> <secret>". */
+static void ssl_keylog_callback(const SSL* ssl, const char* line) {
+  const char* label = SSL_is_server(ssl) ? "SERVER_TRAFFIC_SECRET_0 "
+                                         : "CLIENT_TRAFFIC_SECRET_0 ";
+  if (!absl::StartsWith(line, label)) return;
+  const char* hex = strrchr(line, ' ') + 1;
+  size_t hex_size = strlen(hex);
+  if (hex_size % 2 != 0 || hex_size / 2 > EVP_MAX_MD_SIZE) return;
+  tsi_ssl_write_secret* secret =
+      static_cast<tsi_ssl_write_secret*>(gpr_zalloc(sizeof(*secret)));
+  for (size_t i = 0; i < hex_size / 2; ++i) {
+    int high = hex_digit_value(hex[2 * i]);
+    int low = hex_digit_value(hex[2 * i + 1]);
+    if (high < 0 || low < 0) {
+      ssl_write_secret_free(nullptr, secret, nullptr, 0, 0, nullptr);
+      return;
+    }
+    secret->secret[i] = static_cast<unsigned char>(high << 4 | low);
+  }
+  secret->size = hex_size / 2;
+  SSL* mutable_ssl = const_cast<SSL*>(ssl);
+  ssl_write_secret_free(
+      nullptr, SSL_get_ex_data(mutable_ssl, g_ssl_ex_write_secret_index),
+      nullptr, 0, 0, nullptr);
+  SSL_set_ex_data(mutable_ssl, g_ssl_ex_write_secret_index, secret);
+}
+
+/* HKDF-Expand-Label of RFC 8446, section 7.1, with an empty context. Outputs
+   are limited to one hash block, which covers traffic keys and IVs. */
+static bool tls13_hkdf_expand_label(const EVP_MD* md,
+                                    const unsigned char* secret,
+                                    size_t secret_size, const char* label,
+                                    unsigned char* out, size_t out_size) {
+  static const char kLabelPrefix[] = "tls13 ";
+  unsigned char info[32];
+  size_t label_size = strlen(label);
+  size_t info_size = 0;
+  info[info_size++] = static_cast<unsigned char>(out_size >> 8);
+  info[info_size++] = static_cast<unsigned char>(out_size);
+  info[info_size++] =
+      static_cast<unsigned char>(sizeof(kLabelPrefix) - 1 + label_size);
+  memcpy(info + info_size, kLabelPrefix, sizeof(kLabelPrefix) - 1);
+  info_size += sizeof(kLabelPrefix) - 1;
+  memcpy(info + info_size, label, label_size);
+  info_size += label_size;
+  info[info_size++] = 0; /* Context length. */
+  info[info_size++] = 1; /* Block counter of HKDF-Expand. */
+  unsigned char block[EVP_MAX_MD_SIZE];
+  unsigned int block_size = 0;
+  if (HMAC(md, secret, static_cast<int>(secret_size), info, info_size, block,
+           &block_size) == nullptr ||
+      out_size > block_size) {
+    return false;
+  }
+  memcpy(out, block, out_size);
+  OPENSSL_cleanse(block, sizeof(block));
+  return true;
+}
+
+/* P_hash of the TLS 1.2 PRF, RFC 5246, section 5. */
+static bool tls12_prf(const EVP_MD* md, const unsigned char* secret,
+                      size_t secret_size, const char* label,
+                      const unsigned char* seed, size_t seed_size,
+                      unsigned char* out, size_t out_size) {
+  unsigned char label_seed[64 + 2 * SSL3_RANDOM_SIZE];
+  size_t label_size = strlen(label);
+  if (label_size + seed_size > sizeof(label_seed)) return false;
+  memcpy(label_seed, label, label_size);
+  memcpy(label_seed + label_size, seed, seed_size);
+  size_t label_seed_size = label_size + seed_size;
+  /* a holds A(i) followed by label and seed. */
+  unsigned char a[EVP_MAX_MD_SIZE + sizeof(label_seed)];
+  unsigned int a_size = 0;
+  if (HMAC(md, secret, static_cast<int>(secret_size), label_seed,
+           label_seed_size, a, &a_size) == nullptr) {
+    return false;
+  }
+  bool ok = true;
+  for (size_t done = 0; ok && done < out_size;) {
+    memcpy(a + a_size, label_seed, label_seed_size);
+    unsigned char block[EVP_MAX_MD_SIZE];
+    unsigned int block_size = 0;
+    unsigned char next_a[EVP_MAX_MD_SIZE];
+    ok = HMAC(md, secret, static_cast<int>(secret_size), a,
+              a_size + label_seed_size, block, &block_size) != nullptr &&
+         HMAC(md, secret, static_cast<int>(secret_size), a, a_size, next_a,
+              &a_size) != nullptr;
+    if (ok) {
+      size_t n = GPR_MIN(static_cast<size_t>(block_size), out_size - done);
+      memcpy(out + done, block, n);
+      done += n;
+      memcpy(a, next_a, a_size);
+    }
+    OPENSSL_cleanse(block, sizeof(block));
+  }
+  OPENSSL_cleanse(a, sizeof(a));
+  return ok;
+}
+
+/* Returns the sequence number of the next record ssl would send. */
+static bool ssl_get_next_write_sequence(SSL* ssl, uint64_t* sequence) {
+#ifdef OPENSSL_IS_BORINGSSL
+  *sequence = SSL_get_write_sequence(ssl);
+  return true;
+#else
+  /* OpenSSL does not expose it, but the only record a TLS 1.2 peer has sent
+     with the traffic keys is its Finished message, and a TLS 1.3 client has
+     sent none. A TLS 1.3 server may already have sent session tickets. */
+  if (SSL_version(ssl) == TLS1_2_VERSION) {
+    *sequence = 1;
+    return true;
+  }
+  if (!SSL_is_server(ssl)) {
+    *sequence = 0;
+    return true;
+  }
+  return false;
+#endif
+}
+
+/* Derives the key and the 12 byte nonce base of the sending direction. For
+   TLS 1.2 the last 8 bytes of the nonce are the first explicit nonce. */
+static tsi_result ssl_derive_write_key(SSL* ssl, const EVP_MD* md,
+                                       size_t key_size, uint64_t sequence,
+                                       unsigned char* key,
+                                       unsigned char* nonce) {
+  const bool is_server = SSL_is_server(ssl) != 0;
+  if (SSL_version(ssl) == TLS1_3_VERSION) {
+    tsi_ssl_write_secret* secret = static_cast<tsi_ssl_write_secret*>(
+        SSL_get_ex_data(ssl, g_ssl_ex_write_secret_index));
+    if (secret == nullptr) return TSI_FAILED_PRECONDITION;
+    if (!tls13_hkdf_expand_label(md, secret->secret, secret->size, "key", key,
+                                 key_size) ||
+        !tls13_hkdf_expand_label(md, secret->secret, secret->size, "iv",
+                                 nonce, TSI_SSL_KERNEL_TLS_NONCE_SIZE)) {
+      return TSI_INTERNAL_ERROR;
+    }
+    return TSI_OK;
+  }
+  if (SSL_version(ssl) != TLS1_2_VERSION) return TSI_UNIMPLEMENTED;
+  unsigned char master_key[SSL_MAX_MASTER_KEY_LENGTH];
+  size_t master_key_size = SSL_SESSION_get_master_key(
+      SSL_get_session(ssl), master_key, sizeof(master_key));
+  unsigned char seed[2 * SSL3_RANDOM_SIZE];
+  SSL_get_server_random(ssl, seed, SSL3_RANDOM_SIZE);
+  SSL_get_client_random(ssl, seed + SSL3_RANDOM_SIZE, SSL3_RANDOM_SIZE);
+  /* AEAD key blocks are made of both write keys followed by both implicit
+     nonce parts, client first. */
+  unsigned char key_block[2 * TLS_CIPHER_AES_GCM_256_KEY_SIZE +
+                          2 * TSI_SSL_KERNEL_TLS_SALT_SIZE];
+  bool ok = tls12_prf(md, master_key, master_key_size, "key expansion", seed,
+                      sizeof(seed), key_block,
+                      2 * key_size + 2 * TSI_SSL_KERNEL_TLS_SALT_SIZE);
+  if (ok) {
+    memcpy(key, key_block + (is_server ? key_size : 0), key_size);
+    memcpy(nonce,
+           key_block + 2 * key_size +
+               (is_server ? TSI_SSL_KERNEL_TLS_SALT_SIZE : 0),
+           TSI_SSL_KERNEL_TLS_SALT_SIZE);
+    for (size_t i = 0; i < 8; ++i) {
+      nonce[TSI_SSL_KERNEL_TLS_SALT_SIZE + i] =
+          static_cast<unsigned char>(sequence >> (56 - 8 * i));
+    }
+  }
+  OPENSSL_cleanse(master_key, sizeof(master_key));
+  OPENSSL_cleanse(key_block, sizeof(key_block));
+  return ok ? TSI_OK : TSI_INTERNAL_ERROR;
+}
+
+/* Fills a tls12_crypto_info_aes_gcm_{128,256} for the kernel. */
+template <typename CryptoInfo>
+static void fill_kernel_tls_crypto_info(int version, uint16_t cipher_type,
+                                        const unsigned char* key,
+                                        const unsigned char* nonce,
+                                        uint64_t sequence, CryptoInfo* info) {
+  memset(info, 0, sizeof(*info));
+  info->info.version =
+      version == TLS1_3_VERSION ? TLS_1_3_VERSION : TLS_1_2_VERSION;
+  info->info.cipher_type = cipher_type;
+  memcpy(info->key, key, sizeof(info->key));
+  memcpy(info->salt, nonce, sizeof(info->salt));
+  memcpy(info->iv, nonce + sizeof(info->salt), sizeof(info->iv));
+  for (size_t i = 0; i < sizeof(info->rec_seq); ++i) {
+    info->rec_seq[i] = static_cast<unsigned char>(
+        sequence >> (8 * (sizeof(info->rec_seq) - 1 - i)));
+  }
+}
+
+static tsi_result ssl_enable_kernel_tls_tx(SSL* ssl, int fd) {
+  const SSL_CIPHER* cipher = SSL_get_current_cipher(ssl);
+  if (cipher == nullptr) return TSI_FAILED_PRECONDITION;
+  const EVP_MD* md;
+  size_t key_size;
+  switch (SSL_CIPHER_get_cipher_nid(cipher)) {
+    case NID_aes_128_gcm:
+      md = EVP_sha256();
+      key_size = TLS_CIPHER_AES_GCM_128_KEY_SIZE;
+      break;
+    case NID_aes_256_gcm:
+      md = EVP_sha384();
+      key_size = TLS_CIPHER_AES_GCM_256_KEY_SIZE;
+      break;
+    default:
+      return TSI_UNIMPLEMENTED;
+  }
+  uint64_t sequence;
+  if (!ssl_get_next_write_sequence(ssl, &sequence)) return TSI_UNIMPLEMENTED;
+  unsigned char key[TLS_CIPHER_AES_GCM_256_KEY_SIZE];
+  unsigned char nonce[TSI_SSL_KERNEL_TLS_NONCE_SIZE];
+  tsi_result result =
+      ssl_derive_write_key(ssl, md, key_size, sequence, key, nonce);
+  if (result != TSI_OK) return result;
+  if (setsockopt(fd, IPPROTO_TCP, TCP_ULP, "tls", sizeof("tls")) != 0) {
+    /* Most likely the tls module is not available. */
+    result = TSI_UNIMPLEMENTED;
+  } else {
+    union {
+      tls12_crypto_info_aes_gcm_128 aes_gcm_128;
+      tls12_crypto_info_aes_gcm_256 aes_gcm_256;
+    } info;
+    socklen_t info_size;
+    if (key_size == TLS_CIPHER_AES_GCM_128_KEY_SIZE) {
+      fill_kernel_tls_crypto_info(SSL_version(ssl), TLS_CIPHER_AES_GCM_128,
+                                  key, nonce, sequence, &info.aes_gcm_128);
+      info_size = sizeof(info.aes_gcm_128);
+    } else {
+      fill_kernel_tls_crypto_info(SSL_version(ssl), TLS_CIPHER_AES_GCM_256,
+                                  key, nonce, sequence, &info.aes_gcm_256);
+      info_size = sizeof(info.aes_gcm_256);
+    }
+    if (setsockopt(fd, SOL_TLS, TLS_TX, &info, info_size) != 0) {
+      result = TSI_UNIMPLEMENTED;
+    }
+    OPENSSL_cleanse(&info, sizeof(info));
+  }
+  OPENSSL_cleanse(key, sizeof(key));
+  OPENSSL_cleanse(nonce, sizeof(nonce));
+  return result;
+}
+
+#endif /* TSI_SSL_KERNEL_TLS */
+
 /* Returns 1 if name looks like an IP address, 0 otherwise.
    This is a very rough heuristic, and only handles IPv6 in hexadecimal form. */
 static int looks_like_ip_address(absl::string_view name) {
@@ -783,7 +1184,7 @@ static tsi_result ssl_ctx_load_verification_certs(SSL_CTX* context,
    cipher list and the ephemeral ECDH key. */
 static tsi_result populate_ssl_context(
     SSL_CTX* context, const tsi_ssl_pem_key_cert_pair* key_cert_pair,
-    const char* cipher_list) {
+    const char* cipher_list, bool enable_kernel_tls) {
   tsi_result result = TSI_OK;
   if (key_cert_pair != nullptr) {
     if (key_cert_pair->cert_chain != nullptr) {
@@ -818,6 +1219,13 @@ static tsi_result populate_ssl_context(
     SSL_CTX_set_options(context, SSL_OP_SINGLE_ECDH_USE);
     EC_KEY_free(ecdh);
   }
+#ifdef TSI_SSL_KERNEL_TLS
+  if (enable_kernel_tls) {
+    SSL_CTX_set_keylog_callback(context, ssl_keylog_callback);
+  }
+#else
+  (void)enable_kernel_tls;
+#endif
   return TSI_OK;
 }
 
@@ -942,6 +1350,73 @@ void tsi_ssl_session_cache_unref(tsi_ssl_session_cache* cache) {
   reinterpret_cast<tsi::SslSessionLRUCache*>(cache)->Unref();
 }
 
+/* --- tsi_ssl_session_ticket_keys methods implementation. ---*/
+
+tsi_ssl_session_ticket_keys* tsi_ssl_session_ticket_keys_create(
+    size_t max_keys) {
+  GPR_ASSERT(max_keys > 0);
+  tsi_ssl_session_ticket_keys* keys = static_cast<tsi_ssl_session_ticket_keys*>(
+      gpr_zalloc(sizeof(*keys)));
+  gpr_ref_init(&keys->refcount, 1);
+  gpr_mu_init(&keys->mu);
+  keys->keys = static_cast<tsi_ssl_session_ticket_key*>(
+      gpr_zalloc(max_keys * sizeof(tsi_ssl_session_ticket_key)));
+  keys->max_keys = max_keys;
+  return keys;
+}
+
+tsi_result tsi_ssl_session_ticket_keys_rotate(tsi_ssl_session_ticket_keys* keys,
+                                              const unsigned char* key,
+                                              size_t key_size) {
+  if (keys == nullptr || key == nullptr ||
+      key_size != TSI_SSL_SESSION_TICKET_KEY_SIZE) {
+    return TSI_INVALID_ARGUMENT;
+  }
+  gpr_mu_lock(&keys->mu);
+  size_t num_kept = GPR_MIN(keys->num_keys, keys->max_keys - 1);
+  memmove(&keys->keys[1], &keys->keys[0],
+          num_kept * sizeof(tsi_ssl_session_ticket_key));
+  memcpy(&keys->keys[0], key, sizeof(tsi_ssl_session_ticket_key));
+  keys->num_keys = num_kept + 1;
+  gpr_mu_unlock(&keys->mu);
+  return TSI_OK;
+}
+
+void tsi_ssl_session_ticket_keys_ref(tsi_ssl_session_ticket_keys* keys) {
+  gpr_ref(&keys->refcount);
+}
+
+void tsi_ssl_session_ticket_keys_unref(tsi_ssl_session_ticket_keys* keys) {
+  if (keys == nullptr || !gpr_unref(&keys->refcount)) return;
+  OPENSSL_cleanse(keys->keys,
+                  keys->max_keys * sizeof(tsi_ssl_session_ticket_key));
+  gpr_free(keys->keys);
+  gpr_mu_destroy(&keys->mu);
+  gpr_free(keys);
+}
+
+/* Looks up the key to encrypt a new ticket with (\a name is nullptr) or the
+   key named \a name to decrypt a ticket with, and copies it to \a key.
+   Returns 0 if there is no such key, 1 if it is the current key and 2 if it
+   is a previous key. */
+static int tsi_ssl_session_ticket_keys_find(tsi_ssl_session_ticket_keys* keys,
+                                            const unsigned char* name,
+                                            tsi_ssl_session_ticket_key* key) {
+  int result = 0;
+  gpr_mu_lock(&keys->mu);
+  for (size_t i = 0; i < keys->num_keys; ++i) {
+    if (name == nullptr ||
+        CRYPTO_memcmp(keys->keys[i].name, name,
+                      TSI_SSL_SESSION_TICKET_KEY_NAME_SIZE) == 0) {
+      *key = keys->keys[i];
+      result = i == 0 ? 1 : 2;
+      break;
+    }
+  }
+  gpr_mu_unlock(&keys->mu);
+  return result;
+}
+
 /* --- tsi_frame_protector methods implementation. ---*/
 
 static tsi_result ssl_protector_protect(tsi_frame_protector* self,
@@ -955,6 +1430,8 @@ static tsi_result ssl_protector_protect(tsi_frame_protector* self,
   size_t available;
   tsi_result result = TSI_OK;
 
+  if (impl->kernel_tls_tx) return TSI_FAILED_PRECONDITION;
+
   /* First see if we have some pending data in the SSL BIO. */
   int pending_in_ssl = static_cast<int>(BIO_pending(impl->network_io));
   if (pending_in_ssl > 0) {
@@ -1009,6 +1486,8 @@ static tsi_result ssl_protector_protect_flush(
   int read_from_ssl = 0;
   int pending;
 
+  if (impl->kernel_tls_tx) return TSI_FAILED_PRECONDITION;
+
   if (impl->buffer_offset != 0) {
     result = do_ssl_write(impl->ssl, impl->buffer, impl->buffer_offset);
     if (result != TSI_OK) return result;
@@ -1074,6 +1553,13 @@ static tsi_result ssl_protector_unprotect(
     /* Don't forget to output the total number of bytes read. */
     *unprotected_bytes_size += output_bytes_offset;
   }
+  if (result == TSI_OK && impl->kernel_tls_tx &&
+      BIO_pending(impl->network_io) > 0) {
+    /* The peer asked for a reply, e.g. to a key update, which cannot be sent
+       with the keys the kernel holds. */
+    gpr_log(GPR_ERROR, "SSL needs to send records while kernel TLS is on.");
+    return TSI_INTERNAL_ERROR;
+  }
   return result;
 }
 
@@ -1093,6 +1579,190 @@ static const tsi_frame_protector_vtable frame_protector_vtable = {
     ssl_protector_destroy,
 };
 
+/* --- tsi_zero_copy_grpc_protector methods implementation. ---
+
+   Unlike the frame protector, which goes through a BIO pair and flat
+   buffers, SSL reads records directly from slices and decrypts them into
+   slices handed to the caller. SSL only lends its write buffer for the
+   duration of a BIO write, so each record is copied once, into a slab shared
+   by consecutive records, and handed over as a slice of that slab.
+   Only used when the factory was created with use_zero_copy_protector.
+
+   As with the frame protector, records SSL produces while reading (alerts,
+   or a renegotiation reply in TLS 1.2) can only leave with the next
+   protect; OpenSSL itself defers TLS 1.3 key update replies to the next
+   write. */
+
+#ifdef TSI_SSL_ZERO_COPY_PROTECTOR
+
+#define TSI_SSL_ZERO_COPY_READ_BUFFER_SIZE 16384
+#define TSI_SSL_ZERO_COPY_WRITE_BUFFER_SIZE 65536
+
+static int slice_bio_create(BIO* bio) {
+  BIO_set_init(bio, 1);
+  return 1;
+}
+
+static int slice_bio_write(BIO* bio, const char* data, int size) {
+  tsi_ssl_slice_bio_state* state =
+      static_cast<tsi_ssl_slice_bio_state*>(BIO_get_data(bio));
+  BIO_clear_retry_flags(bio);
+  if (size <= 0) return 0;
+  if (GRPC_SLICE_LENGTH(state->write_buffer) < static_cast<size_t>(size)) {
+    grpc_slice_unref(state->write_buffer);
+    state->write_buffer = grpc_slice_malloc(GPR_MAX(
+        static_cast<size_t>(size), TSI_SSL_ZERO_COPY_WRITE_BUFFER_SIZE));
+  }
+  memcpy(GRPC_SLICE_START_PTR(state->write_buffer), data, size);
+  grpc_slice_buffer_add(&state->outgoing,
+                        grpc_slice_split_head(&state->write_buffer, size));
+  return size;
+}
+
+static int slice_bio_read(BIO* bio, char* out, int size) {
+  tsi_ssl_slice_bio_state* state =
+      static_cast<tsi_ssl_slice_bio_state*>(BIO_get_data(bio));
+  BIO_clear_retry_flags(bio);
+  if (state->incoming.length == 0) {
+    BIO_set_retry_read(bio);
+    return -1;
+  }
+  if (size <= 0) return 0;
+  size_t n = GPR_MIN(static_cast<size_t>(size), state->incoming.length);
+  grpc_slice_buffer_move_first_into_buffer(&state->incoming, n, out);
+  return static_cast<int>(n);
+}
+
+static long slice_bio_ctrl(BIO* bio, int cmd, long /*num*/, void* /*ptr*/) {
+  tsi_ssl_slice_bio_state* state =
+      static_cast<tsi_ssl_slice_bio_state*>(BIO_get_data(bio));
+  switch (cmd) {
+    case BIO_CTRL_FLUSH:
+      return 1;
+    case BIO_CTRL_PENDING:
+      return static_cast<long>(state->incoming.length);
+    default:
+      return 0;
+  }
+}
+
+static BIO_METHOD* slice_bio_method_create(void) {
+  BIO_METHOD* method = BIO_meth_new(BIO_TYPE_SOURCE_SINK, "grpc slice");
+  if (method == nullptr) return nullptr;
+  BIO_meth_set_create(method, slice_bio_create);
+  BIO_meth_set_write(method, slice_bio_write);
+  BIO_meth_set_read(method, slice_bio_read);
+  BIO_meth_set_ctrl(method, slice_bio_ctrl);
+  return method;
+}
+
+static tsi_result ssl_zero_copy_grpc_protector_protect(
+    tsi_zero_copy_grpc_protector* self, grpc_slice_buffer* unprotected_slices,
+    grpc_slice_buffer* protected_slices) {
+  if (self == nullptr || unprotected_slices == nullptr ||
+      protected_slices == nullptr) {
+    return TSI_INVALID_ARGUMENT;
+  }
+  tsi_ssl_zero_copy_grpc_protector* impl =
+      reinterpret_cast<tsi_ssl_zero_copy_grpc_protector*>(self);
+  if (impl->kernel_tls_tx) return TSI_FAILED_PRECONDITION;
+  tsi_result result = TSI_OK;
+  for (size_t i = 0; result == TSI_OK && i < unprotected_slices->count; i++) {
+    unsigned char* bytes = GRPC_SLICE_START_PTR(unprotected_slices->slices[i]);
+    size_t bytes_size = GRPC_SLICE_LENGTH(unprotected_slices->slices[i]);
+    while (result == TSI_OK && bytes_size > 0) {
+      if (impl->buffer_offset == 0 && bytes_size >= impl->buffer_size) {
+        /* A full record can be encrypted straight from the slice. */
+        result = do_ssl_write(impl->ssl, bytes, impl->buffer_size);
+        bytes += impl->buffer_size;
+        bytes_size -= impl->buffer_size;
+        continue;
+      }
+      size_t n = GPR_MIN(bytes_size, impl->buffer_size - impl->buffer_offset);
+      memcpy(impl->buffer + impl->buffer_offset, bytes, n);
+      impl->buffer_offset += n;
+      bytes += n;
+      bytes_size -= n;
+      if (impl->buffer_offset == impl->buffer_size) {
+        result = do_ssl_write(impl->ssl, impl->buffer, impl->buffer_offset);
+        impl->buffer_offset = 0;
+      }
+    }
+  }
+  if (result == TSI_OK && impl->buffer_offset > 0) {
+    result = do_ssl_write(impl->ssl, impl->buffer, impl->buffer_offset);
+  }
+  impl->buffer_offset = 0;
+  grpc_slice_buffer_move_into(&impl->bio_state.outgoing, protected_slices);
+  grpc_slice_buffer_reset_and_unref(unprotected_slices);
+  return result;
+}
+
+static tsi_result ssl_zero_copy_grpc_protector_unprotect(
+    tsi_zero_copy_grpc_protector* self, grpc_slice_buffer* protected_slices,
+    grpc_slice_buffer* unprotected_slices) {
+  if (self == nullptr || unprotected_slices == nullptr ||
+      protected_slices == nullptr) {
+    return TSI_INVALID_ARGUMENT;
+  }
+  tsi_ssl_zero_copy_grpc_protector* impl =
+      reinterpret_cast<tsi_ssl_zero_copy_grpc_protector*>(self);
+  tsi_result result = TSI_OK;
+  grpc_slice_buffer_move_into(protected_slices, &impl->bio_state.incoming);
+  while (true) {
+    if (GRPC_SLICE_LENGTH(impl->read_buffer) == 0) {
+      grpc_slice_unref(impl->read_buffer);
+      impl->read_buffer = grpc_slice_malloc(TSI_SSL_ZERO_COPY_READ_BUFFER_SIZE);
+    }
+    size_t read_size = GRPC_SLICE_LENGTH(impl->read_buffer);
+    result = do_ssl_read(impl->ssl, GRPC_SLICE_START_PTR(impl->read_buffer),
+                         &read_size);
+    if (result != TSI_OK || read_size == 0) break;
+    grpc_slice_buffer_add(unprotected_slices,
+                          grpc_slice_split_head(&impl->read_buffer, read_size));
+  }
+  if (result == TSI_OK && impl->kernel_tls_tx &&
+      impl->bio_state.outgoing.length > 0) {
+    /* The peer asked for a reply, e.g. to a key update, which cannot be sent
+       with the keys the kernel holds. */
+    gpr_log(GPR_ERROR, "SSL needs to send records while kernel TLS is on.");
+    result = TSI_INTERNAL_ERROR;
+  }
+  return result;
+}
+
+static void ssl_zero_copy_grpc_protector_destroy(
+    tsi_zero_copy_grpc_protector* self) {
+  if (self == nullptr) return;
+  tsi_ssl_zero_copy_grpc_protector* impl =
+      reinterpret_cast<tsi_ssl_zero_copy_grpc_protector*>(self);
+  SSL_free(impl->ssl);
+  grpc_slice_buffer_destroy(&impl->bio_state.incoming);
+  grpc_slice_buffer_destroy(&impl->bio_state.outgoing);
+  grpc_slice_unref(impl->bio_state.write_buffer);
+  grpc_slice_unref(impl->read_buffer);
+  gpr_free(impl->buffer);
+  gpr_free(impl);
+}
+
+static tsi_result ssl_zero_copy_grpc_protector_max_frame_size(
+    tsi_zero_copy_grpc_protector* self, size_t* max_frame_size) {
+  if (self == nullptr || max_frame_size == nullptr) return TSI_INVALID_ARGUMENT;
+  *max_frame_size =
+      reinterpret_cast<tsi_ssl_zero_copy_grpc_protector*>(self)->max_frame_size;
+  return TSI_OK;
+}
+
+static const tsi_zero_copy_grpc_protector_vtable
+    zero_copy_grpc_protector_vtable = {
+        ssl_zero_copy_grpc_protector_protect,
+        ssl_zero_copy_grpc_protector_unprotect,
+        ssl_zero_copy_grpc_protector_destroy,
+        ssl_zero_copy_grpc_protector_max_frame_size,
+};
+
+#endif /* TSI_SSL_ZERO_COPY_PROTECTOR */
+
 /* --- tsi_server_handshaker_factory methods implementation. --- */
 
 static void tsi_ssl_handshaker_factory_destroy(
@@ -1226,11 +1896,91 @@ static tsi_result ssl_handshaker_result_extract_peer(
   return result;
 }
 
+/* Clamps the requested maximum frame size of a protector and returns the one
+   to use. */
+static size_t ssl_protector_max_frame_size(
+    size_t* max_output_protected_frame_size) {
+  if (max_output_protected_frame_size == nullptr) {
+    return TSI_SSL_MAX_PROTECTED_FRAME_SIZE_UPPER_BOUND;
+  }
+  if (*max_output_protected_frame_size >
+      TSI_SSL_MAX_PROTECTED_FRAME_SIZE_UPPER_BOUND) {
+    *max_output_protected_frame_size =
+        TSI_SSL_MAX_PROTECTED_FRAME_SIZE_UPPER_BOUND;
+  } else if (*max_output_protected_frame_size <
+             TSI_SSL_MAX_PROTECTED_FRAME_SIZE_LOWER_BOUND) {
+    *max_output_protected_frame_size =
+        TSI_SSL_MAX_PROTECTED_FRAME_SIZE_LOWER_BOUND;
+  }
+  return *max_output_protected_frame_size;
+}
+
+static tsi_result ssl_handshaker_result_create_zero_copy_grpc_protector(
+    const tsi_handshaker_result* self, size_t* max_output_protected_frame_size,
+    tsi_zero_copy_grpc_protector** protector) {
+#ifdef TSI_SSL_ZERO_COPY_PROTECTOR
+  tsi_ssl_handshaker_result* impl =
+      reinterpret_cast<tsi_ssl_handshaker_result*>(
+          const_cast<tsi_handshaker_result*>(self));
+  /* Callers fall back to the frame protector. */
+  if (!impl->use_zero_copy_protector) return TSI_UNIMPLEMENTED;
+  if (impl->ssl == nullptr) return TSI_FAILED_PRECONDITION;
+  BIO* slice_bio = BIO_new(g_slice_bio_method);
+  if (slice_bio == nullptr) return TSI_OUT_OF_RESOURCES;
+  tsi_ssl_zero_copy_grpc_protector* protector_impl =
+      static_cast<tsi_ssl_zero_copy_grpc_protector*>(
+          gpr_zalloc(sizeof(*protector_impl)));
+  protector_impl->max_frame_size =
+      ssl_protector_max_frame_size(max_output_protected_frame_size);
+  protector_impl->buffer_size =
+      protector_impl->max_frame_size - TSI_SSL_MAX_PROTECTION_OVERHEAD;
+  protector_impl->buffer =
+      static_cast<unsigned char*>(gpr_malloc(protector_impl->buffer_size));
+  protector_impl->read_buffer = grpc_empty_slice();
+  protector_impl->kernel_tls_tx = impl->kernel_tls_tx;
+  grpc_slice_buffer_init(&protector_impl->bio_state.incoming);
+  grpc_slice_buffer_init(&protector_impl->bio_state.outgoing);
+  protector_impl->bio_state.write_buffer = grpc_empty_slice();
+  BIO_set_data(slice_bio, &protector_impl->bio_state);
+
+  /* Bytes the peer sent along with the end of the handshake may still sit in
+     the BIO pair, unread by SSL. */
+  BIO* ssl_io = SSL_get_rbio(impl->ssl);
+  size_t pending = BIO_ctrl_pending(ssl_io);
+  if (pending > 0) {
+    grpc_slice leftover = grpc_slice_malloc(pending);
+    GPR_ASSERT(BIO_read(ssl_io, GRPC_SLICE_START_PTR(leftover),
+                        static_cast<int>(pending)) ==
+               static_cast<int>(pending));
+    grpc_slice_buffer_add(&protector_impl->bio_state.incoming, leftover);
+  }
+
+#ifdef TSI_SSL_KERNEL_TLS
+  ssl_discard_write_secret(impl->ssl);
+#endif
+  /* Transfer ownership of ssl to the protector, and replace the BIO pair
+     with the slice BIO. */
+  protector_impl->ssl = impl->ssl;
+  impl->ssl = nullptr;
+  SSL_set_bio(protector_impl->ssl, slice_bio, slice_bio);
+  BIO_free(impl->network_io);
+  impl->network_io = nullptr;
+  protector_impl->base.vtable = &zero_copy_grpc_protector_vtable;
+  *protector = &protector_impl->base;
+  return TSI_OK;
+#else
+  (void)self;
+  (void)max_output_protected_frame_size;
+  (void)protector;
+  return TSI_UNIMPLEMENTED;
+#endif /* TSI_SSL_ZERO_COPY_PROTECTOR */
+}
+
 static tsi_result ssl_handshaker_result_create_frame_protector(
     const tsi_handshaker_result* self, size_t* max_output_protected_frame_size,
     tsi_frame_protector** protector) {
   size_t actual_max_output_protected_frame_size =
-      TSI_SSL_MAX_PROTECTED_FRAME_SIZE_UPPER_BOUND;
+      ssl_protector_max_frame_size(max_output_protected_frame_size);
   tsi_ssl_handshaker_result* impl =
       reinterpret_cast<tsi_ssl_handshaker_result*>(
           const_cast<tsi_handshaker_result*>(self));
@@ -1238,18 +1988,6 @@ static tsi_result ssl_handshaker_result_create_frame_protector(
       static_cast<tsi_ssl_frame_protector*>(
           gpr_zalloc(sizeof(*protector_impl)));
 
-  if (max_output_protected_frame_size != nullptr) {
-    if (*max_output_protected_frame_size >
-        TSI_SSL_MAX_PROTECTED_FRAME_SIZE_UPPER_BOUND) {
-      *max_output_protected_frame_size =
-          TSI_SSL_MAX_PROTECTED_FRAME_SIZE_UPPER_BOUND;
-    } else if (*max_output_protected_frame_size <
-               TSI_SSL_MAX_PROTECTED_FRAME_SIZE_LOWER_BOUND) {
-      *max_output_protected_frame_size =
-          TSI_SSL_MAX_PROTECTED_FRAME_SIZE_LOWER_BOUND;
-    }
-    actual_max_output_protected_frame_size = *max_output_protected_frame_size;
-  }
   protector_impl->buffer_size =
       actual_max_output_protected_frame_size - TSI_SSL_MAX_PROTECTION_OVERHEAD;
   protector_impl->buffer =
@@ -1261,11 +1999,15 @@ static tsi_result ssl_handshaker_result_create_frame_protector(
     return TSI_INTERNAL_ERROR;
   }
 
+#ifdef TSI_SSL_KERNEL_TLS
+  ssl_discard_write_secret(impl->ssl);
+#endif
   /* Transfer ownership of ssl and network_io to the frame protector. */
   protector_impl->ssl = impl->ssl;
   impl->ssl = nullptr;
   protector_impl->network_io = impl->network_io;
   impl->network_io = nullptr;
+  protector_impl->kernel_tls_tx = impl->kernel_tls_tx;
   protector_impl->base.vtable = &frame_protector_vtable;
   *protector = &protector_impl->base;
   return TSI_OK;
@@ -1290,12 +2032,33 @@ static void ssl_handshaker_result_destroy(tsi_handshaker_result* self) {
   gpr_free(impl);
 }
 
+static tsi_result ssl_handshaker_result_enable_kernel_tls_tx(
+    const tsi_handshaker_result* self, int fd) {
+#ifdef TSI_SSL_KERNEL_TLS
+  tsi_ssl_handshaker_result* impl =
+      reinterpret_cast<tsi_ssl_handshaker_result*>(
+          const_cast<tsi_handshaker_result*>(self));
+  /* The ssl is gone once a frame protector has been created. */
+  if (impl->ssl == nullptr) return TSI_FAILED_PRECONDITION;
+  if (impl->kernel_tls_tx) return TSI_OK;
+  tsi_result result = ssl_enable_kernel_tls_tx(impl->ssl, fd);
+  ssl_discard_write_secret(impl->ssl);
+  impl->kernel_tls_tx = result == TSI_OK;
+  return result;
+#else
+  (void)self;
+  (void)fd;
+  return TSI_UNIMPLEMENTED;
+#endif /* TSI_SSL_KERNEL_TLS */
+}
+
 static const tsi_handshaker_result_vtable handshaker_result_vtable = {
     ssl_handshaker_result_extract_peer,
-    nullptr, /* create_zero_copy_grpc_protector */
+    ssl_handshaker_result_create_zero_copy_grpc_protector,
     ssl_handshaker_result_create_frame_protector,
     ssl_handshaker_result_get_unused_bytes,
     ssl_handshaker_result_destroy,
+    ssl_handshaker_result_enable_kernel_tls_tx,
 };
 
 static tsi_result ssl_handshaker_result_create(
@@ -1313,6 +2076,8 @@ static tsi_result ssl_handshaker_result_create(
   handshaker->ssl = nullptr;
   result->network_io = handshaker->network_io;
   handshaker->network_io = nullptr;
+  result->use_zero_copy_protector =
+      handshaker->factory_ref->use_zero_copy_protector;
   if (unused_bytes_size > 0) {
     result->unused_bytes =
         static_cast<unsigned char*>(gpr_malloc(unused_bytes_size));
@@ -1478,12 +2243,13 @@ static const tsi_handshaker_vtable handshaker_vtable = {
 /* --- tsi_ssl_handshaker_factory common methods. --- */
 
 static void tsi_ssl_handshaker_resume_session(
-    SSL* ssl, tsi::SslSessionLRUCache* session_cache) {
+    SSL* ssl, tsi_ssl_client_handshaker_factory* factory) {
   const char* server_name = SSL_get_servername(ssl, TLSEXT_NAMETYPE_host_name);
   if (server_name == nullptr) {
     return;
   }
-  tsi::SslSessionPtr session = session_cache->Get(server_name);
+  std::string key = std::string(factory->session_cache_partition) + server_name;
+  tsi::SslSessionPtr session = factory->session_cache->Get(key.c_str());
   if (session != nullptr) {
     // SSL_set_session internally increments reference counter.
     SSL_set_session(ssl, session.get());
@@ -1529,8 +2295,7 @@ static tsi_result create_tsi_ssl_handshaker(SSL_CTX* ctx, int is_client,
     tsi_ssl_client_handshaker_factory* client_factory =
         reinterpret_cast<tsi_ssl_client_handshaker_factory*>(factory);
     if (client_factory->session_cache != nullptr) {
-      tsi_ssl_handshaker_resume_session(ssl,
-                                        client_factory->session_cache.get());
+      tsi_ssl_handshaker_resume_session(ssl, client_factory);
     }
     ssl_result = SSL_do_handshake(ssl);
     ssl_result = SSL_get_error(ssl, ssl_result);
@@ -1658,6 +2423,7 @@ static void tsi_ssl_server_handshaker_factory_destroy(
     gpr_free(self->ssl_context_x509_subject_names);
   }
   if (self->alpn_protocol_list != nullptr) gpr_free(self->alpn_protocol_list);
+  tsi_ssl_session_ticket_keys_unref(self->session_ticket_keys);
   gpr_free(self);
 }
 
@@ -1746,6 +2512,62 @@ static int server_handshaker_factory_npn_advertised_callback(
   return SSL_TLSEXT_ERR_OK;
 }
 
+/// This callback is called to encrypt a new session ticket (\a encrypt is 1)
+/// or decrypt one presented by a client (\a encrypt is 0) with the server
+/// factory's session ticket keys. It's intended to be used with
+/// SSL_CTX_set_tlsext_ticket_key_cb or SSL_CTX_set_tlsext_ticket_key_evp_cb.
+///
+/// It returns 1 on success, 0 if no ticket should be issued or the ticket
+/// cannot be decrypted with any of the keys, 2 if the ticket was decrypted
+/// with a previous key and should be renewed, and -1 on error.
+#ifdef TSI_SSL_TICKET_KEY_EVP_CB
+static int server_handshaker_factory_ticket_key_callback(
+    SSL* ssl, unsigned char* key_name, unsigned char* iv,
+    EVP_CIPHER_CTX* cipher_ctx, EVP_MAC_CTX* hmac_ctx, int encrypt) {
+#else
+static int server_handshaker_factory_ticket_key_callback(
+    SSL* ssl, unsigned char* key_name, unsigned char* iv,
+    EVP_CIPHER_CTX* cipher_ctx, HMAC_CTX* hmac_ctx, int encrypt) {
+#endif
+  void* arg =
+      SSL_CTX_get_ex_data(SSL_get_SSL_CTX(ssl), g_ssl_ctx_ex_factory_index);
+  tsi_ssl_server_handshaker_factory* factory =
+      static_cast<tsi_ssl_server_handshaker_factory*>(arg);
+  tsi_ssl_session_ticket_key key;
+  int result = tsi_ssl_session_ticket_keys_find(
+      factory->session_ticket_keys, encrypt ? nullptr : key_name, &key);
+  if (result == 0) return 0;
+  const EVP_CIPHER* cipher = EVP_aes_128_cbc();
+  int ok;
+  if (encrypt) {
+    memcpy(key_name, key.name, sizeof(key.name));
+    ok = RAND_bytes(iv, EVP_CIPHER_iv_length(cipher)) == 1 &&
+         EVP_EncryptInit_ex(cipher_ctx, cipher, nullptr, key.aes_key, iv) == 1;
+  } else {
+    ok = EVP_DecryptInit_ex(cipher_ctx, cipher, nullptr, key.aes_key, iv) == 1;
+  }
+  if (ok) {
+#ifdef TSI_SSL_TICKET_KEY_EVP_CB
+    OSSL_PARAM params[] = {
+        OSSL_PARAM_construct_octet_string(OSSL_MAC_PARAM_KEY, key.hmac_key,
+                                          sizeof(key.hmac_key)),
+        OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST,
+                                         const_cast<char*>("SHA256"), 0),
+        OSSL_PARAM_construct_end()};
+    ok = EVP_MAC_CTX_set_params(hmac_ctx, params) == 1;
+#else
+    ok = HMAC_Init_ex(hmac_ctx, key.hmac_key, sizeof(key.hmac_key),
+                      EVP_sha256(), nullptr) == 1;
+#endif
+  }
+  OPENSSL_cleanse(&key, sizeof(key));
+  if (!ok) {
+    gpr_log(GPR_ERROR, "Failed to set up session ticket encryption.");
+    return -1;
+  }
+  return encrypt ? 1 : result;
+}
+
 /// This callback is called when new \a session is established and ready to
 /// be cached. This session can be reused for new connections to similar
 /// servers at later point of time.
@@ -1765,11 +2587,48 @@ static int server_handshaker_factory_new_session_callback(
   if (server_name == nullptr) {
     return 0;
   }
-  factory->session_cache->Put(server_name, tsi::SslSessionPtr(session));
+  std::string key = std::string(factory->session_cache_partition) + server_name;
+  factory->session_cache->Put(key.c_str(), tsi::SslSessionPtr(session));
   // Return 1 to indicate transferred ownership over the given session.
   return 1;
 }
 
+/* Computes the prefix of the session cache keys of a client factory created
+   with \a options: a digest of the settings that decide whether the factory
+   accepts a server, followed by a ':'. */
+static void client_handshaker_factory_session_cache_partition(
+    const tsi_ssl_client_handshaker_options* options, char* partition) {
+  std::string settings;
+  if (options->root_store != nullptr) {
+    /* There is no cheap way to digest a root store, so sessions are only
+       shared between factories using the very same one. */
+    char root_store[32];
+    snprintf(root_store, sizeof(root_store), "root_store:%p",
+             options->root_store);
+    settings.append(root_store);
+  } else if (options->pem_root_certs != nullptr) {
+    settings.append(options->pem_root_certs);
+  }
+  settings.push_back('\0');
+  if (options->pem_key_cert_pair != nullptr &&
+      options->pem_key_cert_pair->cert_chain != nullptr) {
+    settings.append(options->pem_key_cert_pair->cert_chain);
+  }
+  settings.push_back('\0');
+  settings.push_back(options->skip_server_certificate_verification ? '1' : '0');
+  unsigned char digest[EVP_MAX_MD_SIZE];
+  unsigned int digest_size = 0;
+  GPR_ASSERT(EVP_Digest(settings.data(), settings.size(), digest, &digest_size,
+                        EVP_sha256(), nullptr) == 1);
+  static const char kHex[] = "0123456789abcdef";
+  for (size_t i = 0; i < TSI_SSL_SESSION_CACHE_PARTITION_SIZE / 2; ++i) {
+    partition[2 * i] = kHex[digest[i] >> 4];
+    partition[2 * i + 1] = kHex[digest[i] & 0xf];
+  }
+  partition[TSI_SSL_SESSION_CACHE_PARTITION_SIZE] = ':';
+  partition[TSI_SSL_SESSION_CACHE_PARTITION_SIZE + 1] = '\0';
+}
+
 /* --- tsi_ssl_handshaker_factory constructors. --- */
 
 static tsi_ssl_handshaker_factory_vtable client_handshaker_factory_vtable = {
@@ -1819,12 +2678,15 @@ tsi_result tsi_create_ssl_client_handshaker_factory_with_options(
       gpr_zalloc(sizeof(*impl)));
   tsi_ssl_handshaker_factory_init(&impl->base);
   impl->base.vtable = &client_handshaker_factory_vtable;
+  impl->base.use_zero_copy_protector = options->use_zero_copy_protector;
   impl->ssl_context = ssl_context;
   if (options->session_cache != nullptr) {
     // Unref is called manually on factory destruction.
     impl->session_cache =
         reinterpret_cast<tsi::SslSessionLRUCache*>(options->session_cache)
             ->Ref();
+    client_handshaker_factory_session_cache_partition(
+        options, impl->session_cache_partition);
     SSL_CTX_set_ex_data(ssl_context, g_ssl_ctx_ex_factory_index, impl);
     SSL_CTX_sess_set_new_cb(ssl_context,
                             server_handshaker_factory_new_session_callback);
@@ -1833,7 +2695,8 @@ tsi_result tsi_create_ssl_client_handshaker_factory_with_options(
 
   do {
     result = populate_ssl_context(ssl_context, options->pem_key_cert_pair,
-                                  options->cipher_suites);
+                                  options->cipher_suites,
+                                  options->enable_kernel_tls);
     if (result != TSI_OK) break;
 
 #if OPENSSL_VERSION_NUMBER >= 0x10100000
@@ -1945,6 +2808,7 @@ tsi_result tsi_create_ssl_server_handshaker_factory_with_options(
       gpr_zalloc(sizeof(*impl)));
   tsi_ssl_handshaker_factory_init(&impl->base);
   impl->base.vtable = &server_handshaker_factory_vtable;
+  impl->base.use_zero_copy_protector = options->use_zero_copy_protector;
 
   impl->ssl_contexts = static_cast<SSL_CTX**>(
       gpr_zalloc(options->num_key_cert_pairs * sizeof(SSL_CTX*)));
@@ -1956,6 +2820,10 @@ tsi_result tsi_create_ssl_server_handshaker_factory_with_options(
     return TSI_OUT_OF_RESOURCES;
   }
   impl->ssl_context_count = options->num_key_cert_pairs;
+  if (options->session_ticket_keys != nullptr) {
+    tsi_ssl_session_ticket_keys_ref(options->session_ticket_keys);
+    impl->session_ticket_keys = options->session_ticket_keys;
+  }
 
   if (options->num_alpn_protocols > 0) {
     result = build_alpn_protocol_name_list(
@@ -1979,9 +2847,9 @@ tsi_result tsi_create_ssl_server_handshaker_factory_with_options(
         result = TSI_OUT_OF_RESOURCES;
         break;
       }
-      result = populate_ssl_context(impl->ssl_contexts[i],
-                                    &options->pem_key_cert_pairs[i],
-                                    options->cipher_suites);
+      result = populate_ssl_context(
+          impl->ssl_contexts[i], &options->pem_key_cert_pairs[i],
+          options->cipher_suites, options->enable_kernel_tls);
       if (result != TSI_OK) break;
 
       // TODO(elessar): Provide ability to disable session ticket keys.
@@ -1996,7 +2864,19 @@ tsi_result tsi_create_ssl_server_handshaker_factory_with_options(
         break;
       }
 
-      if (options->session_ticket_key != nullptr) {
+      if (impl->session_ticket_keys != nullptr) {
+        SSL_CTX_set_ex_data(impl->ssl_contexts[i], g_ssl_ctx_ex_factory_index,
+                            impl);
+#ifdef TSI_SSL_TICKET_KEY_EVP_CB
+        SSL_CTX_set_tlsext_ticket_key_evp_cb(
+            impl->ssl_contexts[i],
+            server_handshaker_factory_ticket_key_callback);
+#else
+        SSL_CTX_set_tlsext_ticket_key_cb(
+            impl->ssl_contexts[i],
+            server_handshaker_factory_ticket_key_callback);
+#endif
+      } else if (options->session_ticket_key != nullptr) {
         if (SSL_CTX_set_tlsext_ticket_keys(
                 impl->ssl_contexts[i],
                 const_cast<char*>(options->session_ticket_key),
@@ -74,6 +74,40 @@ void tsi_ssl_session_cache_ref(tsi_ssl_session_cache* cache);
 /* Decrement reference counter of \a cache.  */
 void tsi_ssl_session_cache_unref(tsi_ssl_session_cache* cache);
 
+/* --- tsi_ssl_session_ticket_keys object ---
+
+   Set of keys a server uses to encrypt and decrypt TLS session tickets. The
+   same set can be shared by several server handshaker factories (e.g. all the
+   servers of a process, or the successive factories created on credential
+   reload), so that tickets issued by one of them are accepted by the others.
+   Keys are rotated by adding a new key: new tickets are encrypted with it,
+   while tickets encrypted with one of the previous keys still kept are
+   accepted and renewed with the new key. */
+
+typedef struct tsi_ssl_session_ticket_keys tsi_ssl_session_ticket_keys;
+
+/* Size of a session ticket key: a 16 bytes key name, sent in the clear in the
+   ticket, followed by a 16 bytes HMAC key and a 16 bytes AES-128 key. */
+#define TSI_SSL_SESSION_TICKET_KEY_SIZE 48
+
+/* Creates an empty set of session ticket keys that keeps at most \a max_keys
+   keys: the current one and max_keys - 1 previous ones.  */
+tsi_ssl_session_ticket_keys* tsi_ssl_session_ticket_keys_create(
+    size_t max_keys);
+
+/* Makes \a key the current key of \a keys, dropping the oldest key if there
+   are already max_keys keys. Returns TSI_INVALID_ARGUMENT if \a key_size is not
+   TSI_SSL_SESSION_TICKET_KEY_SIZE.  */
+tsi_result tsi_ssl_session_ticket_keys_rotate(tsi_ssl_session_ticket_keys* keys,
+                                              const unsigned char* key,
+                                              size_t key_size);
+
+/* Increment reference counter of \a keys.  */
+void tsi_ssl_session_ticket_keys_ref(tsi_ssl_session_ticket_keys* keys);
+
+/* Decrement reference counter of \a keys.  */
+void tsi_ssl_session_ticket_keys_unref(tsi_ssl_session_ticket_keys* keys);
+
 /* --- tsi_ssl_client_handshaker_factory object ---
 
    This object creates a client tsi_handshaker objects implemented in terms of
@@ -151,6 +185,15 @@ struct tsi_ssl_client_handshaker_options {
 
   /* skip server certificate verification. */
   bool skip_server_certificate_verification;
+  /* enable_kernel_tls prepares the handshakers created with this factory for
+     tsi_handshaker_result_enable_kernel_tls_tx. For TLS 1.3 this installs a
+     key log callback that keeps the sending traffic secret until the offload
+     is set up. */
+  bool enable_kernel_tls;
+  /* use_zero_copy_protector lets the handshaker results created with this
+     factory create a zero-copy grpc protector. Otherwise only the frame
+     protector is available. */
+  bool use_zero_copy_protector;
 
   tsi_ssl_client_handshaker_options()
       : pem_key_cert_pair(nullptr),
@@ -160,7 +203,9 @@ struct tsi_ssl_client_handshaker_options {
         alpn_protocols(nullptr),
         num_alpn_protocols(0),
         session_cache(nullptr),
-        skip_server_certificate_verification(false) {}
+        skip_server_certificate_verification(false),
+        enable_kernel_tls(false),
+        use_zero_copy_protector(false) {}
 };
 
 /* Creates a client handshaker factory.
@@ -276,6 +321,18 @@ struct tsi_ssl_server_handshaker_options {
   const char* session_ticket_key;
   /* session_ticket_key_size is a size of session ticket encryption key. */
   size_t session_ticket_key_size;
+  /* session_ticket_keys is an optional set of rotating keys for encrypting
+     session tickets. If set, it takes precedence over session_ticket_key. */
+  tsi_ssl_session_ticket_keys* session_ticket_keys;
+  /* enable_kernel_tls prepares the handshakers created with this factory for
+     tsi_handshaker_result_enable_kernel_tls_tx. For TLS 1.3 this installs a
+     key log callback that keeps the sending traffic secret until the offload
+     is set up. */
+  bool enable_kernel_tls;
+  /* use_zero_copy_protector lets the handshaker results created with this
+     factory create a zero-copy grpc protector. Otherwise only the frame
+     protector is available. */
+  bool use_zero_copy_protector;
 
   tsi_ssl_server_handshaker_options()
       : pem_key_cert_pairs(nullptr),
@@ -286,7 +343,10 @@ struct tsi_ssl_server_handshaker_options {
         alpn_protocols(nullptr),
         num_alpn_protocols(0),
         session_ticket_key(nullptr),
-        session_ticket_key_size(0) {}
+        session_ticket_key_size(0),
+        session_ticket_keys(nullptr),
+        enable_kernel_tls(false),
+        use_zero_copy_protector(false) {}
 };
 
 /* Creates a server handshaker factory.
@@ -102,6 +102,10 @@ struct tsi_handshaker_result_vtable {
                                  const unsigned char** bytes,
                                  size_t* bytes_size);
   void (*destroy)(tsi_handshaker_result* self);
+  /* Optional: hands protection of the sending direction to the kernel TLS
+     ULP on the socket fd. */
+  tsi_result (*enable_kernel_tls_tx)(const tsi_handshaker_result* self,
+                                     int fd);
 };
 struct tsi_handshaker_result {
   const tsi_handshaker_result_vtable* vtable;
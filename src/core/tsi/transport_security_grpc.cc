@@ -34,6 +34,18 @@ tsi_result tsi_handshaker_result_create_zero_copy_grpc_protector(
       self, max_output_protected_frame_size, protector);
 }
 
+/* This method hands the sending direction to kernel TLS.  */
+tsi_result tsi_handshaker_result_enable_kernel_tls_tx(
+    const tsi_handshaker_result* self, int fd) {
+  if (self == nullptr || self->vtable == nullptr || fd < 0) {
+    return TSI_INVALID_ARGUMENT;
+  }
+  if (self->vtable->enable_kernel_tls_tx == nullptr) {
+    return TSI_UNIMPLEMENTED;
+  }
+  return self->vtable->enable_kernel_tls_tx(self, fd);
+}
+
 /* --- tsi_zero_copy_grpc_protector common implementation. ---
 
    Calls specific implementation after state/input validation. */
@@ -31,6 +31,16 @@ tsi_result tsi_handshaker_result_create_zero_copy_grpc_protector(
     const tsi_handshaker_result* self, size_t* max_output_protected_frame_size,
     tsi_zero_copy_grpc_protector** protector);
 
+/* This method installs the negotiated keys of the sending direction in the
+   kernel TLS ULP of the connected socket fd, so that plaintext written to fd
+   is protected by the kernel. It must be called before any protector is
+   created, and protectors created afterwards must not be used to protect
+   data. It returns TSI_UNIMPLEMENTED if the implementation, the negotiated
+   session or the kernel does not support it, in which case fd is left usable
+   for records protected in user space.  */
+tsi_result tsi_handshaker_result_enable_kernel_tls_tx(
+    const tsi_handshaker_result* self, int fd);
+
 /* -- tsi_zero_copy_grpc_protector object --  */
 
 /* Outputs protected frames.
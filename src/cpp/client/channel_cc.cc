@@ -45,6 +45,12 @@ void ::grpc::experimental::ChannelResetConnectionBackoff(Channel* channel) {
   grpc_impl::experimental::ChannelResetConnectionBackoff(channel);
 }
 
+bool ::grpc::experimental::ChannelWarmUp(Channel* channel,
+                                         gpr_timespec deadline,
+                                         bool send_ping) {
+  return grpc_impl::experimental::ChannelWarmUp(channel, deadline, send_ping);
+}
+
 namespace grpc_impl {
 
 static ::grpc::internal::GrpcLibraryInitializer g_gli_initializer;
@@ -191,6 +197,21 @@ class TagSaver final : public ::grpc::internal::CompletionQueueTag {
 
 }  // namespace
 
+namespace experimental {
+
+bool ChannelWarmUp(Channel* channel, gpr_timespec deadline, bool send_ping) {
+  ::grpc::CompletionQueue cq;
+  bool ok = false;
+  void* tag = nullptr;
+  grpc_channel_warm_up(channel->c_channel_, send_ping, deadline, cq.cq(),
+                       new TagSaver(nullptr), nullptr);
+  cq.Next(&tag, &ok);
+  GPR_ASSERT(tag == nullptr);
+  return ok;
+}
+
+}  // namespace experimental
+
 void Channel::NotifyOnStateChangeImpl(grpc_connectivity_state last_observed,
                                       gpr_timespec deadline,
                                       ::grpc::CompletionQueue* cq, void* tag) {
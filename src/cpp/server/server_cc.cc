@@ -906,6 +906,7 @@ Server::Server(
     : acceptors_(std::move(acceptors)),
       interceptor_creators_(std::move(interceptor_creators)),
       max_receive_message_size_(INT_MIN),
+      message_arena_block_size_(0),
       sync_server_cqs_(std::move(sync_server_cqs)),
       started_(false),
       shutdown_(false),
@@ -960,6 +961,11 @@ Server::Server(
         strcmp(channel_args.args[i].key, GRPC_ARG_MAX_RECEIVE_MESSAGE_LENGTH)) {
       max_receive_message_size_ = channel_args.args[i].value.integer;
     }
+    if (0 == strcmp(channel_args.args[i].key,
+                    GRPC_ARG_MESSAGE_ARENA_INITIAL_BLOCK_SIZE)) {
+      int block_size = channel_args.args[i].value.integer;
+      message_arena_block_size_ = block_size > 0 ? block_size : 0;
+    }
   }
   server_ = grpc_server_create(&channel_args, nullptr);
 }
@@ -1056,11 +1062,15 @@ bool Server::RegisterService(const grpc::string* host, grpc::Service* service) {
       method->set_server_tag(method_registration_tag);
     } else if (method->api_type() ==
                grpc::internal::RpcServiceMethod::ApiType::SYNC) {
+      method->handler()->set_message_arena_block_size(
+          message_arena_block_size_);
       for (const auto& value : sync_req_mgrs_) {
         value->AddSyncMethod(method.get(), method_registration_tag);
       }
     } else {
       has_callback_methods_ = true;
+      method->handler()->set_message_arena_block_size(
+          message_arena_block_size_);
       grpc::internal::RpcServiceMethod* method_value = method.get();
       grpc::CompletionQueue* cq = CallbackCQ();
       grpc_core::SetServerRegisteredMethodAllocator(
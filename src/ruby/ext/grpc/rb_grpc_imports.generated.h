@@ -143,6 +143,9 @@ extern grpc_channel_num_external_connectivity_watchers_type grpc_channel_num_ext
 typedef void(*grpc_channel_watch_connectivity_state_type)(grpc_channel* channel, grpc_connectivity_state last_observed_state, gpr_timespec deadline, grpc_completion_queue* cq, void* tag);
 extern grpc_channel_watch_connectivity_state_type grpc_channel_watch_connectivity_state_import;
 #define grpc_channel_watch_connectivity_state grpc_channel_watch_connectivity_state_import
+typedef void(*grpc_channel_warm_up_type)(grpc_channel* channel, int send_ping, gpr_timespec deadline, grpc_completion_queue* cq, void* tag, void* reserved);
+extern grpc_channel_warm_up_type grpc_channel_warm_up_import;
+#define grpc_channel_warm_up grpc_channel_warm_up_import
 typedef int(*grpc_channel_support_connectivity_watcher_type)(grpc_channel* channel);
 extern grpc_channel_support_connectivity_watcher_type grpc_channel_support_connectivity_watcher_import;
 #define grpc_channel_support_connectivity_watcher grpc_channel_support_connectivity_watcher_import
@@ -287,6 +290,9 @@ extern grpc_channelz_get_subchannel_type grpc_channelz_get_subchannel_import;
 typedef char*(*grpc_channelz_get_socket_type)(intptr_t socket_id);
 extern grpc_channelz_get_socket_type grpc_channelz_get_socket_import;
 #define grpc_channelz_get_socket grpc_channelz_get_socket_import
+typedef char*(*grpc_call_profiler_get_profiles_type)(void);
+extern grpc_call_profiler_get_profiles_type grpc_call_profiler_get_profiles_import;
+#define grpc_call_profiler_get_profiles grpc_call_profiler_get_profiles_import
 typedef grpc_channel*(*grpc_insecure_channel_create_from_fd_type)(const char* target, int fd, const grpc_channel_args* args);
 extern grpc_insecure_channel_create_from_fd_type grpc_insecure_channel_create_from_fd_import;
 #define grpc_insecure_channel_create_from_fd grpc_insecure_channel_create_from_fd_import
@@ -410,6 +416,18 @@ extern grpc_ssl_server_credentials_create_options_using_config_fetcher_type grpc
 typedef void(*grpc_ssl_server_credentials_options_destroy_type)(grpc_ssl_server_credentials_options* options);
 extern grpc_ssl_server_credentials_options_destroy_type grpc_ssl_server_credentials_options_destroy_import;
 #define grpc_ssl_server_credentials_options_destroy grpc_ssl_server_credentials_options_destroy_import
+typedef grpc_ssl_session_ticket_keys*(*grpc_ssl_session_ticket_keys_create_type)(size_t max_keys);
+extern grpc_ssl_session_ticket_keys_create_type grpc_ssl_session_ticket_keys_create_import;
+#define grpc_ssl_session_ticket_keys_create grpc_ssl_session_ticket_keys_create_import
+typedef int(*grpc_ssl_session_ticket_keys_rotate_type)(grpc_ssl_session_ticket_keys* keys, const unsigned char* key, size_t key_size);
+extern grpc_ssl_session_ticket_keys_rotate_type grpc_ssl_session_ticket_keys_rotate_import;
+#define grpc_ssl_session_ticket_keys_rotate grpc_ssl_session_ticket_keys_rotate_import
+typedef void(*grpc_ssl_session_ticket_keys_destroy_type)(grpc_ssl_session_ticket_keys* keys);
+extern grpc_ssl_session_ticket_keys_destroy_type grpc_ssl_session_ticket_keys_destroy_import;
+#define grpc_ssl_session_ticket_keys_destroy grpc_ssl_session_ticket_keys_destroy_import
+typedef void(*grpc_ssl_server_credentials_options_set_session_ticket_keys_type)(grpc_ssl_server_credentials_options* options, grpc_ssl_session_ticket_keys* keys);
+extern grpc_ssl_server_credentials_options_set_session_ticket_keys_type grpc_ssl_server_credentials_options_set_session_ticket_keys_import;
+#define grpc_ssl_server_credentials_options_set_session_ticket_keys grpc_ssl_server_credentials_options_set_session_ticket_keys_import
 typedef grpc_server_credentials*(*grpc_ssl_server_credentials_create_with_options_type)(grpc_ssl_server_credentials_options* options);
 extern grpc_ssl_server_credentials_create_with_options_type grpc_ssl_server_credentials_create_with_options_import;
 #define grpc_ssl_server_credentials_create_with_options grpc_ssl_server_credentials_create_with_options_import
@@ -0,0 +1,249 @@
+/*
+ *
+ * Copyright 2020 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "src/core/lib/channel/call_profiler.h"
+
+#include <string.h>
+
+#include <gtest/gtest.h>
+
+#include <grpc/grpc.h>
+#include <grpc/support/log.h>
+
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/gprpp/host_port.h"
+#include "test/core/end2end/cq_verifier.h"
+#include "test/core/util/port.h"
+#include "test/core/util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+void* tag(intptr_t i) { return reinterpret_cast<void*>(i); }
+
+TEST(CallProfileHistogramTest, Empty) {
+  CallProfileHistogram histogram;
+  EXPECT_EQ(histogram.Count(), 0u);
+  EXPECT_EQ(histogram.Sum(), 0u);
+  EXPECT_EQ(histogram.Percentile(50), 0u);
+}
+
+TEST(CallProfileHistogramTest, PowerOfTwoBuckets) {
+  CallProfileHistogram histogram;
+  histogram.Add(0);
+  histogram.Add(1);
+  histogram.Add(1000);
+  histogram.Add(1023);
+  EXPECT_EQ(histogram.Count(), 4u);
+  EXPECT_EQ(histogram.Sum(), 2024u);
+  EXPECT_EQ(histogram.Percentile(25), 0u);
+  EXPECT_EQ(histogram.Percentile(50), 1u);
+  // 1000 and 1023 share the [512, 1024) bucket.
+  EXPECT_EQ(histogram.Percentile(99), 1023u);
+  EXPECT_EQ(histogram.Percentile(100), 1023u);
+}
+
+TEST(CallProfilerTest, RecordAndRender) {
+  ExecCtx exec_ctx;
+  CallProfiler::ResetForTesting();
+  EXPECT_EQ(CallProfiler::Get("/svc/method", /*is_client=*/true), nullptr);
+  CallProfiler::CallRecord record;
+  record.arena_bytes = 2048;
+  record.bytes_sent = 100;
+  CallProfiler::Record("/svc/method", /*is_client=*/true, record);
+  CallProfiler::Record("/svc/method", /*is_client=*/true, record);
+  std::unique_ptr<CallProfiler::MethodProfile> profile =
+      CallProfiler::Get("/svc/method", /*is_client=*/true);
+  ASSERT_NE(profile, nullptr);
+  EXPECT_EQ(profile->calls.Load(MemoryOrder::RELAXED), 2u);
+  EXPECT_EQ(profile->arena_bytes.Sum(), 4096u);
+  EXPECT_EQ(profile->bytes_sent.Sum(), 200u);
+  EXPECT_EQ(CallProfiler::Get("/svc/method", /*is_client=*/false), nullptr);
+  std::string json = CallProfiler::RenderJson().Dump();
+  EXPECT_NE(json.find("\"/svc/method\""), std::string::npos) << json;
+  EXPECT_NE(json.find("\"client\""), std::string::npos) << json;
+  EXPECT_EQ(json.find("\"server\""), std::string::npos) << json;
+  EXPECT_NE(json.find("\"arenaBytes\""), std::string::npos) << json;
+  CallProfiler::ResetForTesting();
+}
+
+// Runs one unary call between a client and a server that both have
+// profiling enabled.
+void PerformCall(grpc_channel* channel, grpc_server* server,
+                 grpc_completion_queue* cq) {
+  cq_verifier* cqv = cq_verifier_create(cq);
+  grpc_metadata_array initial_metadata_recv;
+  grpc_metadata_array trailing_metadata_recv;
+  grpc_metadata_array request_metadata_recv;
+  grpc_call_details call_details;
+  grpc_status_code status;
+  grpc_slice details;
+  grpc_slice request_payload_slice = grpc_slice_from_static_string("hello");
+  grpc_byte_buffer* request_payload =
+      grpc_raw_byte_buffer_create(&request_payload_slice, 1);
+  grpc_byte_buffer* request_payload_recv = nullptr;
+  int was_cancelled = 2;
+  grpc_call* c = grpc_channel_create_call(
+      channel, nullptr, GRPC_PROPAGATE_DEFAULTS, cq,
+      grpc_slice_from_static_string("/profiled"), nullptr,
+      grpc_timeout_seconds_to_deadline(5), nullptr);
+  ASSERT_NE(c, nullptr);
+  grpc_metadata_array_init(&initial_metadata_recv);
+  grpc_metadata_array_init(&trailing_metadata_recv);
+  grpc_metadata_array_init(&request_metadata_recv);
+  grpc_call_details_init(&call_details);
+  grpc_op ops[6];
+  memset(ops, 0, sizeof(ops));
+  grpc_op* op = ops;
+  op->op = GRPC_OP_SEND_INITIAL_METADATA;
+  op++;
+  op->op = GRPC_OP_SEND_MESSAGE;
+  op->data.send_message.send_message = request_payload;
+  op++;
+  op->op = GRPC_OP_SEND_CLOSE_FROM_CLIENT;
+  op++;
+  op->op = GRPC_OP_RECV_INITIAL_METADATA;
+  op->data.recv_initial_metadata.recv_initial_metadata = &initial_metadata_recv;
+  op++;
+  op->op = GRPC_OP_RECV_STATUS_ON_CLIENT;
+  op->data.recv_status_on_client.trailing_metadata = &trailing_metadata_recv;
+  op->data.recv_status_on_client.status = &status;
+  op->data.recv_status_on_client.status_details = &details;
+  op++;
+  ASSERT_EQ(GRPC_CALL_OK,
+            grpc_call_start_batch(c, ops, static_cast<size_t>(op - ops),
+                                  tag(1), nullptr));
+  grpc_call* s;
+  ASSERT_EQ(GRPC_CALL_OK,
+            grpc_server_request_call(server, &s, &call_details,
+                                     &request_metadata_recv, cq, cq,
+                                     tag(101)));
+  CQ_EXPECT_COMPLETION(cqv, tag(101), 1);
+  cq_verify(cqv);
+  memset(ops, 0, sizeof(ops));
+  op = ops;
+  op->op = GRPC_OP_RECV_MESSAGE;
+  op->data.recv_message.recv_message = &request_payload_recv;
+  op++;
+  ASSERT_EQ(GRPC_CALL_OK,
+            grpc_call_start_batch(s, ops, static_cast<size_t>(op - ops),
+                                  tag(102), nullptr));
+  CQ_EXPECT_COMPLETION(cqv, tag(102), 1);
+  cq_verify(cqv);
+  memset(ops, 0, sizeof(ops));
+  op = ops;
+  op->op = GRPC_OP_SEND_INITIAL_METADATA;
+  op++;
+  op->op = GRPC_OP_RECV_CLOSE_ON_SERVER;
+  op->data.recv_close_on_server.cancelled = &was_cancelled;
+  op++;
+  op->op = GRPC_OP_SEND_STATUS_FROM_SERVER;
+  op->data.send_status_from_server.status = GRPC_STATUS_OK;
+  grpc_slice status_details = grpc_slice_from_static_string("xyz");
+  op->data.send_status_from_server.status_details = &status_details;
+  op++;
+  ASSERT_EQ(GRPC_CALL_OK,
+            grpc_call_start_batch(s, ops, static_cast<size_t>(op - ops),
+                                  tag(103), nullptr));
+  CQ_EXPECT_COMPLETION(cqv, tag(103), 1);
+  CQ_EXPECT_COMPLETION(cqv, tag(1), 1);
+  cq_verify(cqv);
+  EXPECT_EQ(status, GRPC_STATUS_OK);
+  EXPECT_EQ(was_cancelled, 0);
+  grpc_slice_unref(details);
+  grpc_metadata_array_destroy(&initial_metadata_recv);
+  grpc_metadata_array_destroy(&trailing_metadata_recv);
+  grpc_metadata_array_destroy(&request_metadata_recv);
+  grpc_call_details_destroy(&call_details);
+  grpc_byte_buffer_destroy(request_payload);
+  grpc_byte_buffer_destroy(request_payload_recv);
+  grpc_call_unref(c);
+  grpc_call_unref(s);
+  cq_verifier_destroy(cqv);
+}
+
+TEST(CallProfilerTest, ProfilesClientAndServerCalls) {
+  CallProfiler::ResetForTesting();
+  grpc_arg arg = grpc_channel_arg_integer_create(
+      const_cast<char*>(GRPC_ARG_ENABLE_CALL_PROFILING), 1);
+  grpc_channel_args args = {1, &arg};
+  grpc_completion_queue* cq = grpc_completion_queue_create_for_next(nullptr);
+  grpc_server* server = grpc_server_create(&args, nullptr);
+  std::string server_address =
+      JoinHostPort("localhost", grpc_pick_unused_port_or_die());
+  grpc_server_register_completion_queue(server, cq, nullptr);
+  ASSERT_TRUE(
+      grpc_server_add_insecure_http2_port(server, server_address.c_str()));
+  grpc_server_start(server);
+  grpc_channel* channel =
+      grpc_insecure_channel_create(server_address.c_str(), &args, nullptr);
+  const int kNumCalls = 3;
+  for (int i = 0; i < kNumCalls; i++) {
+    PerformCall(channel, server, cq);
+  }
+  grpc_channel_destroy(channel);
+  grpc_server_shutdown_and_notify(server, cq, tag(1000));
+  grpc_event ev;
+  do {
+    ev = grpc_completion_queue_next(cq, grpc_timeout_seconds_to_deadline(5),
+                                    nullptr);
+  } while (ev.type != GRPC_OP_COMPLETE || ev.tag != tag(1000));
+  grpc_server_destroy(server);
+  grpc_completion_queue_shutdown(cq);
+  while (grpc_completion_queue_next(cq, gpr_inf_future(GPR_CLOCK_REALTIME),
+                                    nullptr)
+             .type != GRPC_QUEUE_SHUTDOWN) {
+  }
+  grpc_completion_queue_destroy(cq);
+  // The client and the server side of each call are recorded separately.
+  for (bool is_client : {true, false}) {
+    std::unique_ptr<CallProfiler::MethodProfile> profile =
+        CallProfiler::Get("/profiled", is_client);
+    ASSERT_NE(profile, nullptr) << CallProfiler::RenderJson().Dump();
+    EXPECT_EQ(profile->calls.Load(MemoryOrder::RELAXED),
+              static_cast<uint64_t>(kNumCalls));
+    EXPECT_GT(profile->arena_bytes.Sum(), 0u);
+    EXPECT_GT(profile->arena_allocations.Sum(), 0u);
+    EXPECT_GT(profile->latency_nanos.Sum(), 0u);
+    // Handing a batch to chttp2 can take less than the resolution of the
+    // fallback cycle clock, so only the number of samples is checked.
+    EXPECT_EQ(profile->transport_nanos.Count(),
+              static_cast<uint64_t>(kNumCalls));
+    EXPECT_GT(profile->bytes_sent.Sum(), 0u);
+    EXPECT_GT(profile->bytes_received.Sum(), 0u);
+  }
+  // The same profiles are available through the public API.
+  char* json = grpc_call_profiler_get_profiles();
+  EXPECT_NE(strstr(json, "\"/profiled\""), nullptr) << json;
+  gpr_log(GPR_INFO, "%s", json);
+  gpr_free(json);
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(argc, argv);
+  grpc_init();
+  int ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
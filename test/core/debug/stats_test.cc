@@ -18,9 +18,13 @@
 
 #include "src/core/lib/debug/stats.h"
 
+#include <string.h>
+
 #include <mutex>
 #include <thread>
 
+#include "absl/strings/str_cat.h"
+
 #include <grpc/grpc.h>
 #include <grpc/support/cpu.h>
 #include <grpc/support/log.h>
@@ -65,6 +69,65 @@ TEST(StatsTest, IncSpecificCounter) {
   EXPECT_EQ(snapshot->delta().counters[GRPC_STATS_COUNTER_SYSCALL_POLL], 1);
 }
 
+TEST(StatsTest, ExporterCollectsDeltas) {
+  grpc_stats_exporter exporter;
+  grpc_stats_exporter_init(&exporter);
+  grpc_stats_data delta;
+  {
+    grpc_core::ExecCtx exec_ctx;
+    GRPC_STATS_INC_SYSCALL_POLL();
+    GRPC_STATS_INC_SYSCALL_POLL();
+    GRPC_STATS_INC_TCP_READ_SIZE(1000);
+    grpc_stats_exporter_collect_delta(&exporter, &delta);
+  }
+  EXPECT_EQ(delta.counters[GRPC_STATS_COUNTER_SYSCALL_POLL], 2);
+  EXPECT_EQ(grpc_stats_histo_count(&delta, GRPC_STATS_HISTOGRAM_TCP_READ_SIZE),
+            1);
+  std::string json = grpc_stats_data_as_sparse_json(&delta);
+  EXPECT_NE(json.find("\"syscall_poll\": 2"), std::string::npos) << json;
+  EXPECT_NE(json.find("\"tcp_read_size\": ["), std::string::npos) << json;
+  EXPECT_EQ(json.find("\"syscall_wait\""), std::string::npos) << json;
+  {
+    grpc_core::ExecCtx exec_ctx;
+    GRPC_STATS_INC_SYSCALL_POLL();
+    grpc_stats_exporter_collect_delta(&exporter, &delta);
+  }
+  // Only the change since the previous collection is reported.
+  EXPECT_EQ(delta.counters[GRPC_STATS_COUNTER_SYSCALL_POLL], 1);
+  EXPECT_EQ(grpc_stats_histo_count(&delta, GRPC_STATS_HISTOGRAM_TCP_READ_SIZE),
+            0);
+}
+
+TEST(StatsTest, ExportedDeltaJson) {
+  grpc_stats_data delta;
+  memset(&delta, 0, sizeof(delta));
+  EXPECT_EQ(grpc_stats_data_as_sparse_json(&delta), "{}");
+  delta.counters[GRPC_STATS_COUNTER_SYSCALL_POLL] = 3;
+  delta.counters[GRPC_STATS_COUNTER_SYSCALL_WAIT] = 1;
+  delta.histograms[GRPC_STATS_HISTOGRAM_TCP_READ_SIZE_FIRST_SLOT + 1] = 2;
+  std::string buckets;
+  std::string boundaries;
+  for (int j = 0; j < GRPC_STATS_HISTOGRAM_TCP_READ_SIZE_BUCKETS; j++) {
+    buckets += absl::StrCat(j == 0 ? "" : ",", j == 1 ? 2 : 0);
+    boundaries += absl::StrCat(
+        j == 0 ? "" : ",",
+        grpc_stats_histo_bucket_boundaries[GRPC_STATS_HISTOGRAM_TCP_READ_SIZE]
+                                          [j]);
+  }
+  EXPECT_EQ(grpc_stats_data_as_sparse_json(&delta),
+            absl::StrCat("{\"syscall_poll\": 3, \"syscall_wait\": 1, "
+                         "\"tcp_read_size\": [",
+                         buckets, "], \"tcp_read_size_bkt\": [", boundaries,
+                         "]}"));
+  // The full rendering keeps its original, unseparated format.
+  std::string json = grpc_stats_data_as_json(&delta);
+  EXPECT_NE(json.find(absl::StrCat("\"syscall_poll\": 3\"",
+                                   grpc_stats_counter_name
+                                       [GRPC_STATS_COUNTER_SYSCALL_POLL + 1])),
+            std::string::npos)
+      << json;
+}
+
 static int FindExpectedBucket(int i, int j) {
   if (j < 0) {
     return 0;
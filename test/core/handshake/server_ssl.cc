@@ -30,6 +30,7 @@
 #include <grpc/support/string_util.h>
 #include <grpc/support/sync.h>
 
+#include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/iomgr/load_file.h"
 #include "test/core/util/port.h"
 #include "test/core/util/test_config.h"
@@ -53,5 +54,10 @@ int main(int /*argc*/, char* /*argv*/[]) {
   // and sanity checks the server_ssl_test.
   const char* fake_alpn_list[] = {"foo"};
   GPR_ASSERT(!server_ssl_test(fake_alpn_list, 1, "foo"));
+  // Handshake succeeds when the server runs it on the handshake thread pool.
+  grpc_arg offload_arg = grpc_channel_arg_integer_create(
+      const_cast<char*>(GRPC_ARG_OFFLOAD_HANDSHAKES), 1);
+  grpc_channel_args offload_args = {1, &offload_arg};
+  GPR_ASSERT(server_ssl_test(full_alpn_list, 2, "grpc-exp", &offload_args));
   return 0;
 }
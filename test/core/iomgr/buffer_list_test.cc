@@ -115,7 +115,20 @@ static void TestRepeatedShutdown() {
   grpc_core::TracedBuffer::Shutdown(&list, nullptr, GRPC_ERROR_NONE);
 }
 
+/** Tests that a callback is only installed when none has been set before.
+ * Must run before any other test sets a callback.
+ */
+static void TestSetCallbackIfUnset() {
+  GPR_ASSERT(grpc_core::grpc_tcp_set_write_timestamps_callback_if_unset(
+      TestVerifierCalledOnAckVerifier));
+  GPR_ASSERT(grpc_core::grpc_tcp_set_write_timestamps_callback_if_unset(
+      TestVerifierCalledOnAckVerifier));
+  GPR_ASSERT(!grpc_core::grpc_tcp_set_write_timestamps_callback_if_unset(
+      TestShutdownFlushesListVerifier));
+}
+
 static void TestTcpBufferList() {
+  TestSetCallbackIfUnset();
   TestVerifierCalledOnAck();
   TestShutdownFlushesList();
   TestRepeatedShutdown();
@@ -112,6 +112,47 @@ static void test_execute_many(void) {
   GRPC_COMBINER_UNREF(lock, "test_execute_many");
 }
 
+typedef struct {
+  size_t ctr;
+  grpc_core::Combiner* lock;
+} batch_args;
+
+static const size_t kBatchSize = 1000;
+
+static void queue_checks(grpc_core::Combiner* lock, size_t* ctr, size_t first,
+                         size_t last) {
+  for (size_t i = first; i <= last; i++) {
+    ex_args* c = static_cast<ex_args*>(gpr_malloc(sizeof(*c)));
+    c->ctr = ctr;
+    c->value = i;
+    lock->Run(GRPC_CLOSURE_CREATE(check_one, c, nullptr), GRPC_ERROR_NONE);
+  }
+}
+
+static void queue_second_half(void* a, grpc_error* /*error*/) {
+  batch_args* args = static_cast<batch_args*>(a);
+  GPR_ASSERT(args->ctr == kBatchSize);
+  queue_checks(args->lock, &args->ctr, kBatchSize + 1, 2 * kBatchSize);
+}
+
+static void test_execute_batch(void) {
+  gpr_log(GPR_DEBUG, "test_execute_batch");
+
+  grpc_core::Combiner* lock = grpc_combiner_create();
+  grpc_core::ExecCtx exec_ctx;
+  batch_args args = {0, lock};
+  // Queue a burst before flushing, so that the exec_ctx drains it in batches,
+  // and have the combiner queue a second burst while it is draining the
+  // first.  check_one verifies that every closure still runs once and in
+  // order.
+  queue_checks(lock, &args.ctr, 1, kBatchSize);
+  lock->Run(GRPC_CLOSURE_CREATE(queue_second_half, &args, nullptr),
+            GRPC_ERROR_NONE);
+  grpc_core::ExecCtx::Get()->Flush();
+  GPR_ASSERT(args.ctr == 2 * kBatchSize);
+  GRPC_COMBINER_UNREF(lock, "test_execute_batch");
+}
+
 static gpr_event got_in_finally;
 
 static void in_finally(void* /*arg*/, grpc_error* /*error*/) {
@@ -141,6 +182,7 @@ int main(int argc, char** argv) {
   grpc_init();
   test_no_op();
   test_execute_one();
+  test_execute_batch();
   test_execute_finally();
   test_execute_many();
   grpc_shutdown();
@@ -557,6 +557,46 @@ static void release_fd_test(size_t num_bytes, size_t slice_size) {
   close(fd);
 }
 
+static int get_sndbuf(int fd) {
+  int sndbuf = 0;
+  socklen_t len = sizeof(sndbuf);
+  GPR_ASSERT(getsockopt(fd, SOL_SOCKET, SO_SNDBUF, &sndbuf, &len) == 0);
+  return sndbuf;
+}
+
+/* Unix domain socket endpoints keep the kernel's send buffer unless
+   GRPC_ARG_UNIX_SOCKET_SNDBUF_SIZE asks for another one. */
+static void unix_socket_sndbuf_test(int requested_sndbuf) {
+  int sv[2];
+  grpc_core::ExecCtx exec_ctx;
+
+  gpr_log(GPR_INFO, "Start unix socket sndbuf test, requested %d",
+          requested_sndbuf);
+
+  create_sockets(sv);
+  const int kernel_sndbuf = get_sndbuf(sv[1]);
+
+  grpc_arg a[1];
+  a[0].key = const_cast<char*>(GRPC_ARG_UNIX_SOCKET_SNDBUF_SIZE);
+  a[0].type = GRPC_ARG_INTEGER;
+  a[0].value.integer = requested_sndbuf;
+  grpc_channel_args args = {GPR_ARRAY_SIZE(a), a};
+  grpc_endpoint* ep = grpc_tcp_create(
+      grpc_fd_create(sv[1], "unix_socket_sndbuf_test", false),
+      requested_sndbuf > 0 ? &args : nullptr, "test");
+
+  if (requested_sndbuf > 0) {
+    /* Linux doubles the requested size to leave room for bookkeeping. */
+    GPR_ASSERT(get_sndbuf(sv[1]) >= requested_sndbuf);
+    GPR_ASSERT(get_sndbuf(sv[1]) != kernel_sndbuf);
+  } else {
+    GPR_ASSERT(get_sndbuf(sv[1]) == kernel_sndbuf);
+  }
+
+  grpc_endpoint_destroy(ep);
+  close(sv[0]);
+}
+
 void run_tests(void) {
   size_t i = 0;
 
@@ -585,6 +625,9 @@ void run_tests(void) {
   }
 
   release_fd_test(100, 8192);
+
+  unix_socket_sndbuf_test(0);
+  unix_socket_sndbuf_test(64 * 1024);
 }
 
 static void clean_up(void) {}
@@ -202,6 +202,61 @@ static void test_leftover(grpc_endpoint_test_config config, size_t slice_size) {
   clean_up();
 }
 
+/* With kernel TLS offload, writes reach the wrapped endpoint unprotected. */
+static void test_kernel_tls_tx(void) {
+  grpc_core::ExecCtx exec_ctx;
+  gpr_log(GPR_INFO, "Start test kernel tls tx");
+  grpc_endpoint_pair tcp = grpc_iomgr_create_endpoint_pair("fixture", nullptr);
+  grpc_endpoint_add_to_pollset(tcp.client, g_pollset);
+  grpc_endpoint_add_to_pollset(tcp.server, g_pollset);
+  grpc_endpoint* client_ep = grpc_secure_endpoint_create(
+      tsi_create_fake_frame_protector(nullptr), nullptr, tcp.client, nullptr,
+      0, /*kernel_tls_tx=*/true);
+  grpc_slice s =
+      grpc_slice_from_copied_string("hello world 12345678900987654321");
+  grpc_slice_buffer outgoing;
+  grpc_slice_buffer incoming;
+  grpc_slice_buffer_init(&outgoing);
+  grpc_slice_buffer_init(&incoming);
+  grpc_slice_buffer_add(&outgoing, grpc_slice_ref_internal(s));
+  int writes = 0;
+  int reads = 0;
+  grpc_closure write_done;
+  grpc_closure read_done;
+  GRPC_CLOSURE_INIT(&write_done, inc_call_ctr, &writes,
+                    grpc_schedule_on_exec_ctx);
+  GRPC_CLOSURE_INIT(&read_done, inc_call_ctr, &reads,
+                    grpc_schedule_on_exec_ctx);
+
+  grpc_endpoint_write(client_ep, &outgoing, &write_done, nullptr);
+  grpc_endpoint_read(tcp.server, &incoming, &read_done, /*urgent=*/false);
+  grpc_core::ExecCtx::Get()->Flush();
+  gpr_mu_lock(g_mu);
+  while (writes == 0 || reads == 0) {
+    grpc_pollset_worker* worker = nullptr;
+    GPR_ASSERT(GRPC_LOG_IF_ERROR(
+        "pollset_work",
+        grpc_pollset_work(g_pollset, &worker,
+                          grpc_core::ExecCtx::Get()->Now() + 100)));
+    gpr_mu_unlock(g_mu);
+    grpc_core::ExecCtx::Get()->Flush();
+    gpr_mu_lock(g_mu);
+  }
+  gpr_mu_unlock(g_mu);
+  GPR_ASSERT(incoming.count == 1);
+  GPR_ASSERT(grpc_slice_eq(s, incoming.slices[0]));
+
+  grpc_endpoint_shutdown(client_ep, GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+                                        "test_kernel_tls_tx end"));
+  grpc_endpoint_shutdown(tcp.server, GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+                                         "test_kernel_tls_tx end"));
+  grpc_endpoint_destroy(client_ep);
+  grpc_endpoint_destroy(tcp.server);
+  grpc_slice_unref_internal(s);
+  grpc_slice_buffer_destroy_internal(&outgoing);
+  grpc_slice_buffer_destroy_internal(&incoming);
+}
+
 static void destroy_pollset(void* p, grpc_error* /*error*/) {
   grpc_pollset_destroy(static_cast<grpc_pollset*>(p));
 }
@@ -219,6 +274,7 @@ int main(int argc, char** argv) {
     grpc_endpoint_tests(configs[1], g_pollset, g_mu);
     test_leftover(configs[2], 1);
     test_leftover(configs[3], 1);
+    test_kernel_tls_tx();
     GRPC_CLOSURE_INIT(&destroyed, destroy_pollset, g_pollset,
                       grpc_schedule_on_exec_ctx);
     grpc_pollset_shutdown(g_pollset, &destroyed);
@@ -310,7 +310,7 @@ TEST_F(TlsSecurityConnectorTest, CreateServerSecurityConnectorSuccess) {
   SetOptions(SUCCESS);
   auto cred = std::unique_ptr<grpc_server_credentials>(
       grpc_tls_server_credentials_create(options_.get()));
-  auto connector = cred->create_security_connector();
+  auto connector = cred->create_security_connector(nullptr);
   EXPECT_NE(connector, nullptr);
 }
 
@@ -318,7 +318,7 @@ TEST_F(TlsSecurityConnectorTest, CreateServerSecurityConnectorFailInit) {
   SetOptions(FAIL);
   auto cred = std::unique_ptr<grpc_server_credentials>(
       grpc_tls_server_credentials_create(options_.get()));
-  auto connector = cred->create_security_connector();
+  auto connector = cred->create_security_connector(nullptr);
   EXPECT_EQ(connector, nullptr);
 }
 
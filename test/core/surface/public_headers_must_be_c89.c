@@ -102,6 +102,7 @@ int main(int argc, char **argv) {
   printf("%lx", (unsigned long) grpc_channel_check_connectivity_state);
   printf("%lx", (unsigned long) grpc_channel_num_external_connectivity_watchers);
   printf("%lx", (unsigned long) grpc_channel_watch_connectivity_state);
+  printf("%lx", (unsigned long) grpc_channel_warm_up);
   printf("%lx", (unsigned long) grpc_channel_support_connectivity_watcher);
   printf("%lx", (unsigned long) grpc_channel_create_call);
   printf("%lx", (unsigned long) grpc_channel_ping);
@@ -150,6 +151,7 @@ int main(int argc, char **argv) {
   printf("%lx", (unsigned long) grpc_channelz_get_channel);
   printf("%lx", (unsigned long) grpc_channelz_get_subchannel);
   printf("%lx", (unsigned long) grpc_channelz_get_socket);
+  printf("%lx", (unsigned long) grpc_call_profiler_get_profiles);
   printf("%lx", (unsigned long) grpc_auth_property_iterator_next);
   printf("%lx", (unsigned long) grpc_auth_context_property_iterator);
   printf("%lx", (unsigned long) grpc_auth_context_peer_identity);
@@ -189,6 +191,10 @@ int main(int argc, char **argv) {
   printf("%lx", (unsigned long) grpc_ssl_server_credentials_create_options_using_config);
   printf("%lx", (unsigned long) grpc_ssl_server_credentials_create_options_using_config_fetcher);
   printf("%lx", (unsigned long) grpc_ssl_server_credentials_options_destroy);
+  printf("%lx", (unsigned long) grpc_ssl_session_ticket_keys_create);
+  printf("%lx", (unsigned long) grpc_ssl_session_ticket_keys_rotate);
+  printf("%lx", (unsigned long) grpc_ssl_session_ticket_keys_destroy);
+  printf("%lx", (unsigned long) grpc_ssl_server_credentials_options_set_session_ticket_keys);
   printf("%lx", (unsigned long) grpc_ssl_server_credentials_create_with_options);
   printf("%lx", (unsigned long) grpc_server_add_secure_http2_port);
   printf("%lx", (unsigned long) grpc_call_set_credentials);
@@ -24,6 +24,8 @@
 
 #include "src/core/ext/transport/chttp2/transport/chttp2_transport.h"
 #include "src/core/ext/transport/chttp2/transport/context_list.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/debug/stats.h"
 #include "src/core/lib/transport/transport.h"
 #include "test/core/util/mock_endpoint.h"
 #include "test/core/util/test_config.h"
@@ -85,6 +87,7 @@ TEST_F(ContextListTest, ExecuteFlushesList) {
                                reinterpret_cast<grpc_stream*>(s[i]), &ref,
                                nullptr, nullptr);
     s[i]->context = &verifier_called[i];
+    s[i]->traced = true;
     s[i]->byte_counter = kByteOffset;
     gpr_atm_rel_store(&verifier_called[i], static_cast<gpr_atm>(0));
     grpc_core::ContextList::Append(&list, s[i]);
@@ -141,6 +144,7 @@ TEST_F(ContextListTest, NonEmptyListEmptyTimestamp) {
                                reinterpret_cast<grpc_stream*>(s[i]), &ref,
                                nullptr, nullptr);
     s[i]->context = &verifier_called[i];
+    s[i]->traced = true;
     s[i]->byte_counter = kByteOffset;
     gpr_atm_rel_store(&verifier_called[i], static_cast<gpr_atm>(0));
     grpc_core::ContextList::Append(&list, s[i]);
@@ -159,6 +163,80 @@ TEST_F(ContextListTest, NonEmptyListEmptyTimestamp) {
   exec_ctx.Flush();
 }
 
+/** Tests that a sampled, untraced stream records its write latency breakdown
+ * in the stats histograms and on the channelz socket, without invoking the
+ * external timestamps callback.
+ */
+TEST_F(ContextListTest, SampledStreamRecordsWriteLatency) {
+  grpc_core::ContextList* list = nullptr;
+  grpc_core::ExecCtx exec_ctx;
+  grpc_stream_refcount ref;
+  GRPC_STREAM_REF_INIT(&ref, 1, nullptr, nullptr, "dummy ref");
+  grpc_resource_quota* resource_quota =
+      grpc_resource_quota_create("context_list_test");
+  grpc_endpoint* mock_endpoint =
+      grpc_mock_endpoint_create(discard_write, resource_quota);
+  grpc_arg arg = grpc_channel_arg_integer_create(
+      const_cast<char*>(GRPC_ARG_ENABLE_CHANNELZ), true);
+  grpc_channel_args args = {1, &arg};
+  grpc_transport* t = grpc_create_chttp2_transport(&args, mock_endpoint, true);
+  grpc_chttp2_stream* s = static_cast<grpc_chttp2_stream*>(
+      gpr_malloc(grpc_transport_stream_size(t)));
+  grpc_transport_init_stream(reinterpret_cast<grpc_transport*>(t),
+                             reinterpret_cast<grpc_stream*>(s), &ref, nullptr,
+                             nullptr);
+  gpr_timespec enqueue_time = gpr_now(GPR_CLOCK_REALTIME);
+  s->write_latency_sampled = true;
+  s->write_latency_enqueue_time = enqueue_time;
+  grpc_core::ContextList::Append(&list, s);
+  ASSERT_NE(list, nullptr);
+  // The enqueue time is consumed by the write that carries it.
+  EXPECT_EQ(gpr_time_cmp(s->write_latency_enqueue_time,
+                         gpr_inf_past(GPR_CLOCK_REALTIME)),
+            0);
+  grpc_core::Timestamps ts;
+  ts.sendmsg_time.time =
+      gpr_time_add(enqueue_time, gpr_time_from_micros(100, GPR_TIMESPAN));
+  ts.sent_time.time = gpr_time_add(ts.sendmsg_time.time,
+                                   gpr_time_from_micros(200, GPR_TIMESPAN));
+  ts.acked_time.time = gpr_time_add(ts.sent_time.time,
+                                    gpr_time_from_micros(1000, GPR_TIMESPAN));
+  grpc_stats_data before;
+  grpc_stats_collect(&before);
+  grpc_core::ContextList::Execute(list, &ts, GRPC_ERROR_NONE);
+  grpc_stats_data after;
+  grpc_stats_collect(&after);
+  grpc_stats_data diff;
+  grpc_stats_diff(&after, &before, &diff);
+  EXPECT_EQ(grpc_stats_histo_count(
+                &diff, GRPC_STATS_HISTOGRAM_HTTP2_WRITE_QUEUED_LATENCY),
+            1u);
+  EXPECT_EQ(grpc_stats_histo_count(
+                &diff, GRPC_STATS_HISTOGRAM_HTTP2_WRITE_KERNEL_LATENCY),
+            1u);
+  EXPECT_EQ(grpc_stats_histo_count(
+                &diff, GRPC_STATS_HISTOGRAM_HTTP2_WRITE_WIRE_LATENCY),
+            1u);
+  grpc_chttp2_transport* transport =
+      reinterpret_cast<grpc_chttp2_transport*>(t);
+  ASSERT_NE(transport->channelz_socket, nullptr);
+  std::string json = transport->channelz_socket->RenderJsonString();
+  EXPECT_NE(json.find("\"grpc.write_latency.samples\",\"value\":\"1\""),
+            std::string::npos)
+      << json;
+  EXPECT_NE(
+      json.find("\"grpc.write_latency.wire_avg_us\",\"value\":\"1000\""),
+      std::string::npos)
+      << json;
+  grpc_transport_destroy_stream(reinterpret_cast<grpc_transport*>(t),
+                                reinterpret_cast<grpc_stream*>(s), nullptr);
+  exec_ctx.Flush();
+  gpr_free(s);
+  grpc_transport_destroy(t);
+  grpc_resource_quota_unref(resource_quota);
+  exec_ctx.Flush();
+}
+
 }  // namespace
 }  // namespace testing
 }  // namespace grpc_core
@@ -20,6 +20,7 @@
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
 
+#include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/slice/slice_internal.h"
 #include "src/core/tsi/alts/crypt/gsec.h"
@@ -36,6 +37,9 @@ constexpr size_t kSmallBufferSize = 16;
 constexpr size_t kLargeBufferSize = 16384;
 constexpr size_t kChannelMaxSize = 2048;
 constexpr size_t kChannelMinSize = 128;
+constexpr size_t kMultiFrameBufferSize = 40000;
+constexpr size_t kMultiFrameRepeatTimes = 5;
+constexpr size_t kMultiFrameMaxSliceSize = 700;
 
 /* Test fixtures for each test cases.  */
 struct alts_zero_copy_grpc_protector_test_fixture {
@@ -238,6 +242,61 @@ static void seal_unseal_large_buffer(tsi_zero_copy_grpc_protector* sender,
   grpc_core::ExecCtx::Get()->Flush();
 }
 
+static void seal_unseal_multi_frame_buffer(
+    tsi_zero_copy_grpc_protector* sender,
+    tsi_zero_copy_grpc_protector* receiver) {
+  grpc_core::ExecCtx exec_ctx;
+  for (size_t i = 0; i < kMultiFrameRepeatTimes; i++) {
+    alts_zero_copy_grpc_protector_test_var* var =
+        alts_zero_copy_grpc_protector_test_var_create();
+    /* Creates a buffer spanning several frames out of slices of random size,
+     * so that slice boundaries and frame boundaries do not line up.  */
+    size_t remaining = kMultiFrameBufferSize;
+    while (remaining > 0) {
+      size_t slice_size = GPR_MIN(
+          remaining, static_cast<size_t>(gsec_test_bias_random_uint32(
+                         static_cast<uint32_t>(kMultiFrameMaxSliceSize))) +
+                         1);
+      create_random_slice_buffer(&var->original_sb, &var->duplicate_sb,
+                                 slice_size);
+      remaining -= slice_size;
+    }
+    GPR_ASSERT(tsi_zero_copy_grpc_protector_protect(
+                   sender, &var->original_sb, &var->protected_sb) == TSI_OK);
+    GPR_ASSERT(var->original_sb.length == 0);
+    /* Unprotects all frames at once.  */
+    GPR_ASSERT(tsi_zero_copy_grpc_protector_unprotect(
+                   receiver, &var->protected_sb, &var->unprotected_sb) ==
+               TSI_OK);
+    GPR_ASSERT(var->protected_sb.length == 0);
+    GPR_ASSERT(
+        are_slice_buffers_equal(&var->unprotected_sb, &var->duplicate_sb));
+    alts_zero_copy_grpc_protector_test_var_destroy(var);
+  }
+  grpc_core::ExecCtx::Get()->Flush();
+}
+
+static void corrupted_multi_frame_buffer(
+    tsi_zero_copy_grpc_protector* sender,
+    tsi_zero_copy_grpc_protector* receiver) {
+  grpc_core::ExecCtx exec_ctx;
+  alts_zero_copy_grpc_protector_test_var* var =
+      alts_zero_copy_grpc_protector_test_var_create();
+  create_random_slice_buffer(&var->original_sb, &var->duplicate_sb,
+                             kMultiFrameBufferSize);
+  GPR_ASSERT(tsi_zero_copy_grpc_protector_protect(
+                 sender, &var->original_sb, &var->protected_sb) == TSI_OK);
+  /* Flips a byte in the payload of a frame in the middle of the batch.  */
+  uint8_t* byte =
+      pointer_to_nth_byte(&var->protected_sb, var->protected_sb.length / 2);
+  *byte ^= 1;
+  GPR_ASSERT(tsi_zero_copy_grpc_protector_unprotect(
+                 receiver, &var->protected_sb, &var->unprotected_sb) !=
+             TSI_OK);
+  alts_zero_copy_grpc_protector_test_var_destroy(var);
+  grpc_core::ExecCtx::Get()->Flush();
+}
+
 /* --- Test cases. --- */
 
 static void alts_zero_copy_protector_seal_unseal_small_buffer_tests(
@@ -296,6 +355,24 @@ static void alts_zero_copy_protector_seal_unseal_large_buffer_tests(
   alts_zero_copy_grpc_protector_test_fixture_destroy(fixture);
 }
 
+static void alts_zero_copy_protector_multi_frame_tests(bool enable_extra_copy) {
+  for (bool rekey : {false, true}) {
+    for (bool integrity_only : {false, true}) {
+      alts_zero_copy_grpc_protector_test_fixture* fixture =
+          alts_zero_copy_grpc_protector_test_fixture_create(
+              rekey, integrity_only, enable_extra_copy);
+      seal_unseal_multi_frame_buffer(fixture->client, fixture->server);
+      seal_unseal_multi_frame_buffer(fixture->server, fixture->client);
+      alts_zero_copy_grpc_protector_test_fixture_destroy(fixture);
+
+      fixture = alts_zero_copy_grpc_protector_test_fixture_create(
+          rekey, integrity_only, enable_extra_copy);
+      corrupted_multi_frame_buffer(fixture->client, fixture->server);
+      alts_zero_copy_grpc_protector_test_fixture_destroy(fixture);
+    }
+  }
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(argc, argv);
   grpc_init();
@@ -307,6 +384,8 @@ int main(int argc, char** argv) {
       /*enable_extra_copy=*/false);
   alts_zero_copy_protector_seal_unseal_large_buffer_tests(
       /*enable_extra_copy=*/true);
+  alts_zero_copy_protector_multi_frame_tests(/*enable_extra_copy=*/false);
+  alts_zero_copy_protector_multi_frame_tests(/*enable_extra_copy=*/true);
   grpc_shutdown();
   return 0;
 }
@@ -26,11 +26,14 @@
 #include <stdio.h>
 #include <string.h>
 
+#include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/iomgr/load_file.h"
 #include "src/core/lib/security/security_connector/security_connector.h"
 #include "src/core/tsi/transport_security.h"
+#include "src/core/tsi/transport_security_grpc.h"
 #include "src/core/tsi/transport_security_interface.h"
 #include "test/core/tsi/transport_security_test_lib.h"
+#include "test/core/util/slice_splitter.h"
 #include "test/core/util/test_config.h"
 
 extern "C" {
@@ -95,6 +98,8 @@ typedef struct ssl_tsi_test_fixture {
   bool session_reused;
   const char* session_ticket_key;
   size_t session_ticket_key_size;
+  tsi_ssl_session_ticket_keys* session_ticket_keys;
+  bool use_zero_copy_protector;
   tsi_ssl_server_handshaker_factory* server_handshaker_factory;
   tsi_ssl_client_handshaker_factory* client_handshaker_factory;
 } ssl_tsi_test_fixture;
@@ -127,6 +132,7 @@ static void ssl_test_setup_handshakers(tsi_test_fixture* fixture) {
   if (ssl_fixture->session_cache != nullptr) {
     client_options.session_cache = ssl_fixture->session_cache;
   }
+  client_options.use_zero_copy_protector = ssl_fixture->use_zero_copy_protector;
   GPR_ASSERT(tsi_create_ssl_client_handshaker_factory_with_options(
                  &client_options, &ssl_fixture->client_handshaker_factory) ==
              TSI_OK);
@@ -159,6 +165,8 @@ static void ssl_test_setup_handshakers(tsi_test_fixture* fixture) {
   }
   server_options.session_ticket_key = ssl_fixture->session_ticket_key;
   server_options.session_ticket_key_size = ssl_fixture->session_ticket_key_size;
+  server_options.session_ticket_keys = ssl_fixture->session_ticket_keys;
+  server_options.use_zero_copy_protector = ssl_fixture->use_zero_copy_protector;
   GPR_ASSERT(tsi_create_ssl_server_handshaker_factory_with_options(
                  &server_options, &ssl_fixture->server_handshaker_factory) ==
              TSI_OK);
@@ -486,6 +494,7 @@ static tsi_test_fixture* ssl_tsi_test_fixture_create() {
   ssl_fixture->session_reused = false;
   ssl_fixture->session_ticket_key = nullptr;
   ssl_fixture->session_ticket_key_size = 0;
+  ssl_fixture->session_ticket_keys = nullptr;
   ssl_fixture->force_client_auth = false;
   return &ssl_fixture->base;
 }
@@ -704,6 +713,68 @@ void ssl_tsi_test_do_round_trip_odd_buffer_size() {
   }
 }
 
+static void ssl_tsi_test_zero_copy_send_message(
+    tsi_zero_copy_grpc_protector* sender,
+    tsi_zero_copy_grpc_protector* receiver) {
+  /* A mix of small and large slices, like HTTP/2 frame headers and data. */
+  const size_t slice_sizes[] = {9, 100000, 9, 5, 16384, 1, 40000};
+  grpc_slice_buffer message;
+  grpc_slice_buffer protected_slices;
+  grpc_slice_buffer received;
+  grpc_slice_buffer_init(&message);
+  grpc_slice_buffer_init(&protected_slices);
+  grpc_slice_buffer_init(&received);
+  for (size_t i = 0; i < GPR_ARRAY_SIZE(slice_sizes); i++) {
+    grpc_slice slice = grpc_slice_malloc(slice_sizes[i]);
+    for (size_t j = 0; j < slice_sizes[i]; j++) {
+      GRPC_SLICE_START_PTR(slice)[j] = static_cast<uint8_t>(i * 31 + j);
+    }
+    grpc_slice_buffer_add(&message, slice);
+  }
+  grpc_slice expected = grpc_slice_merge(message.slices, message.count);
+  GPR_ASSERT(tsi_zero_copy_grpc_protector_protect(sender, &message,
+                                                  &protected_slices) == TSI_OK);
+  GPR_ASSERT(message.length == 0);
+  /* Deliver the records in pieces that do not line up with them. */
+  while (protected_slices.length > 0) {
+    grpc_slice_buffer_move_first(
+        &protected_slices, GPR_MIN(protected_slices.length, 1000), &message);
+    GPR_ASSERT(tsi_zero_copy_grpc_protector_unprotect(receiver, &message,
+                                                      &received) == TSI_OK);
+    GPR_ASSERT(message.length == 0);
+  }
+  grpc_slice actual = grpc_slice_merge(received.slices, received.count);
+  GPR_ASSERT(grpc_slice_eq(expected, actual));
+  grpc_slice_unref(expected);
+  grpc_slice_unref(actual);
+  grpc_slice_buffer_destroy(&message);
+  grpc_slice_buffer_destroy(&protected_slices);
+  grpc_slice_buffer_destroy(&received);
+}
+
+void ssl_tsi_test_do_zero_copy_round_trip() {
+  gpr_log(GPR_INFO, "ssl_tsi_test_do_zero_copy_round_trip");
+  tsi_test_fixture* fixture = ssl_tsi_test_fixture_create();
+  ssl_tsi_test_fixture* ssl_fixture =
+      reinterpret_cast<ssl_tsi_test_fixture*>(fixture);
+  ssl_fixture->use_zero_copy_protector = true;
+  tsi_test_do_handshake(fixture);
+  tsi_zero_copy_grpc_protector* client_protector = nullptr;
+  tsi_zero_copy_grpc_protector* server_protector = nullptr;
+  GPR_ASSERT(tsi_handshaker_result_create_zero_copy_grpc_protector(
+                 fixture->client_result, nullptr, &client_protector) ==
+             TSI_OK);
+  GPR_ASSERT(tsi_handshaker_result_create_zero_copy_grpc_protector(
+                 fixture->server_result, nullptr, &server_protector) ==
+             TSI_OK);
+  ssl_tsi_test_zero_copy_send_message(client_protector, server_protector);
+  ssl_tsi_test_zero_copy_send_message(server_protector, client_protector);
+  ssl_tsi_test_zero_copy_send_message(client_protector, server_protector);
+  tsi_zero_copy_grpc_protector_destroy(client_protector);
+  tsi_zero_copy_grpc_protector_destroy(server_protector);
+  tsi_test_fixture_destroy(fixture);
+}
+
 void ssl_tsi_test_do_handshake_session_cache() {
   gpr_log(GPR_INFO, "ssl_tsi_test_do_handshake_session_cache");
   tsi_ssl_session_cache* session_cache = tsi_ssl_session_cache_create_lru(16);
@@ -737,6 +808,61 @@ void ssl_tsi_test_do_handshake_session_cache() {
   tsi_ssl_session_cache_unref(session_cache);
 }
 
+void ssl_tsi_test_do_handshake_session_ticket_keys() {
+  gpr_log(GPR_INFO, "ssl_tsi_test_do_handshake_session_ticket_keys");
+  tsi_ssl_session_cache* session_cache = tsi_ssl_session_cache_create_lru(16);
+  tsi_ssl_session_ticket_keys* session_ticket_keys =
+      tsi_ssl_session_ticket_keys_create(2);
+  // Each handshake uses a new server handshaker factory sharing the keys.
+  auto do_handshake = [&session_ticket_keys, &session_cache](
+                          bool force_client_auth, bool session_reused) {
+    tsi_test_fixture* fixture = ssl_tsi_test_fixture_create();
+    ssl_tsi_test_fixture* ssl_fixture =
+        reinterpret_cast<ssl_tsi_test_fixture*>(fixture);
+    ssl_fixture->server_name_indication =
+        const_cast<char*>("waterzooi.test.google.be");
+    ssl_fixture->force_client_auth = force_client_auth;
+    ssl_fixture->session_ticket_keys = session_ticket_keys;
+    tsi_ssl_session_cache_ref(session_cache);
+    ssl_fixture->session_cache = session_cache;
+    ssl_fixture->session_reused = session_reused;
+    tsi_test_do_round_trip(&ssl_fixture->base);
+    tsi_test_fixture_destroy(fixture);
+  };
+  unsigned char key[TSI_SSL_SESSION_TICKET_KEY_SIZE];
+  GPR_ASSERT(tsi_ssl_session_ticket_keys_rotate(session_ticket_keys, key,
+                                                sizeof(key) - 1) ==
+             TSI_INVALID_ARGUMENT);
+  // No ticket is issued before the first key is added.
+  do_handshake(false, false);
+  do_handshake(false, false);
+  memset(key, 'a', sizeof(key));
+  GPR_ASSERT(tsi_ssl_session_ticket_keys_rotate(session_ticket_keys, key,
+                                                sizeof(key)) == TSI_OK);
+  do_handshake(false, false);
+  do_handshake(false, true);
+  // Sessions are not resumed by clients with different settings.
+  do_handshake(true, false);
+  do_handshake(true, true);
+  // Tickets encrypted with the previous key are still accepted.
+  memset(key, 'b', sizeof(key));
+  GPR_ASSERT(tsi_ssl_session_ticket_keys_rotate(session_ticket_keys, key,
+                                                sizeof(key)) == TSI_OK);
+  do_handshake(false, true);
+  do_handshake(false, true);
+  // Dropping the key of the cached ticket invalidates it.
+  memset(key, 'c', sizeof(key));
+  GPR_ASSERT(tsi_ssl_session_ticket_keys_rotate(session_ticket_keys, key,
+                                                sizeof(key)) == TSI_OK);
+  memset(key, 'd', sizeof(key));
+  GPR_ASSERT(tsi_ssl_session_ticket_keys_rotate(session_ticket_keys, key,
+                                                sizeof(key)) == TSI_OK);
+  do_handshake(false, false);
+  do_handshake(false, true);
+  tsi_ssl_session_ticket_keys_unref(session_ticket_keys);
+  tsi_ssl_session_cache_unref(session_cache);
+}
+
 static const tsi_ssl_handshaker_factory_vtable* original_vtable;
 static bool handshaker_factory_destructor_called;
 
@@ -969,8 +1095,10 @@ int main(int argc, char** argv) {
   ssl_tsi_test_do_handshake_alpn_server_no_client();
   ssl_tsi_test_do_handshake_alpn_client_server_ok();
   ssl_tsi_test_do_handshake_session_cache();
+  ssl_tsi_test_do_handshake_session_ticket_keys();
   ssl_tsi_test_do_round_trip_for_all_configs();
   ssl_tsi_test_do_round_trip_odd_buffer_size();
+  ssl_tsi_test_do_zero_copy_round_trip();
   ssl_tsi_test_handshaker_factory_internals();
   ssl_tsi_test_duplicate_root_certificates();
   ssl_tsi_test_extract_x509_subject_names();
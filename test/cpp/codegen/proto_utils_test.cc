@@ -16,6 +16,8 @@
  *
  */
 
+#include <vector>
+
 #include <grpc/impl/codegen/byte_buffer.h>
 #include <grpc/slice.h>
 #include <grpcpp/impl/codegen/grpc_library.h>
@@ -23,6 +25,8 @@
 #include <grpcpp/impl/grpc_library.h>
 #include <gtest/gtest.h>
 
+#include <google/protobuf/wrappers.pb.h>
+
 namespace grpc {
 
 namespace internal {
@@ -86,6 +90,39 @@ TEST_F(ProtoUtilsTest, TinyBackupThenNext) {
   EXPECT_EQ(block_size, size);
 }
 
+// Messages that fit in one writer block are serialized into a single slice of
+// exactly their size; larger ones are still split into writer blocks.
+TEST_F(ProtoUtilsTest, SerializeSizesSlicesExactly) {
+  for (int length : {8, 100, 4096, kProtoBufferWriterMaxBufferLength - 16,
+                        2 * kProtoBufferWriterMaxBufferLength}) {
+    ::google::protobuf::StringValue msg;
+    msg.set_value(grpc::string(length, 'x'));
+    ByteBuffer bb;
+    bool own_buffer;
+    ASSERT_TRUE(SerializationTraits<::google::protobuf::StringValue>::Serialize(
+                    msg, &bb, &own_buffer)
+                    .ok());
+    EXPECT_TRUE(own_buffer);
+    const int byte_size = msg.ByteSizeLong();
+    EXPECT_EQ(static_cast<size_t>(byte_size), bb.Length());
+    std::vector<Slice> slices;
+    ASSERT_TRUE(bb.Dump(&slices).ok());
+    if (byte_size <= kProtoBufferWriterMaxBufferLength) {
+      ASSERT_EQ(1u, slices.size());
+      EXPECT_EQ(static_cast<size_t>(byte_size), slices[0].size());
+    } else {
+      EXPECT_GT(slices.size(), 1u);
+    }
+
+    ::google::protobuf::StringValue parsed;
+    ASSERT_TRUE(
+        SerializationTraits<::google::protobuf::StringValue>::Deserialize(
+            &bb, &parsed)
+            .ok());
+    EXPECT_EQ(msg.value(), parsed.value());
+  }
+}
+
 namespace {
 
 // Set backup_size to 0 to indicate no backup is needed.
@@ -16,6 +16,11 @@
  *
  */
 
+#include <netinet/in.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
 #include <algorithm>
 #include <memory>
 #include <mutex>
@@ -93,6 +98,33 @@ void tcp_client_connect_with_delay(grpc_closure* closure, grpc_endpoint** ep,
 
 grpc_tcp_client_vtable delayed_connect = {tcp_client_connect_with_delay};
 
+// A TCP listener on 127.0.0.1 that never accepts.  Connections to it
+// complete at the TCP level but never get a response, so from the client's
+// point of view the address is blackholed until the connect deadline.
+class BlackholeListener {
+ public:
+  BlackholeListener() : port_(grpc_pick_unused_port_or_die()) {
+    fd_ = socket(AF_INET, SOCK_STREAM, 0);
+    GPR_ASSERT(fd_ >= 0);
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = htons(port_);
+    GPR_ASSERT(bind(fd_, reinterpret_cast<struct sockaddr*>(&addr),
+                    sizeof(addr)) == 0);
+    GPR_ASSERT(listen(fd_, 16) == 0);
+  }
+
+  ~BlackholeListener() { close(fd_); }
+
+  int port() const { return port_; }
+
+ private:
+  const int port_;
+  int fd_;
+};
+
 // Subclass of TestServiceImpl that increments a request counter for
 // every call to the Echo RPC.
 class MyTestServiceImpl : public TestServiceImpl {
@@ -685,6 +717,55 @@ TEST_F(ClientLbEnd2endTest,
   EXPECT_LT(waited_ms, kWaitMs);
 }
 
+TEST_F(ClientLbEnd2endTest, PickFirstRacesPastBlackholedAddress) {
+  // Make the connect deadline much longer than the test is willing to wait.
+  ChannelArguments args;
+  constexpr int kMinConnectTimeoutMs = 10000;
+  args.SetInt(GRPC_ARG_MIN_RECONNECT_BACKOFF_MS, kMinConnectTimeoutMs);
+  args.SetInt(GRPC_ARG_INITIAL_RECONNECT_BACKOFF_MS, kMinConnectTimeoutMs);
+  args.SetInt(GRPC_ARG_HAPPY_EYEBALLS_CONNECTION_ATTEMPT_DELAY_MS, 250);
+  BlackholeListener blackhole;
+  StartServers(1);
+  auto response_generator = BuildResolverResponseGenerator();
+  auto channel = BuildChannel("pick_first", response_generator, args);
+  auto stub = BuildStub(channel);
+  const gpr_timespec t0 = gpr_now(GPR_CLOCK_MONOTONIC);
+  response_generator.SetNextResolution({blackhole.port(), servers_[0]->port_});
+  // The second address is tried once the connection attempt delay expires,
+  // while the attempt on the first one is still pending.
+  EXPECT_TRUE(SendRpc(stub, nullptr, 5000 /* timeout_ms */, nullptr,
+                      true /* wait_for_ready */));
+  const gpr_timespec t1 = gpr_now(GPR_CLOCK_MONOTONIC);
+  const grpc_millis waited_ms = gpr_time_to_millis(gpr_time_sub(t1, t0));
+  gpr_log(GPR_INFO, "Time to first RPC: %" PRId64 " ms", waited_ms);
+  EXPECT_LT(waited_ms, kMinConnectTimeoutMs / 2);
+  EXPECT_EQ(1, servers_[0]->service_.request_count());
+}
+
+TEST_F(ClientLbEnd2endTest, PickFirstWithoutAttemptDelayWaitsForBlackhole) {
+  // Without a connection attempt delay, which is the default, addresses are
+  // tried one at a time, so the blackholed address holds up the channel
+  // until its connect deadline expires.
+  ChannelArguments args;
+  constexpr int kMinConnectTimeoutMs = 1000;
+  args.SetInt(GRPC_ARG_MIN_RECONNECT_BACKOFF_MS, kMinConnectTimeoutMs);
+  args.SetInt(GRPC_ARG_INITIAL_RECONNECT_BACKOFF_MS, kMinConnectTimeoutMs);
+  BlackholeListener blackhole;
+  StartServers(1);
+  auto response_generator = BuildResolverResponseGenerator();
+  auto channel = BuildChannel("pick_first", response_generator, args);
+  auto stub = BuildStub(channel);
+  const gpr_timespec t0 = gpr_now(GPR_CLOCK_MONOTONIC);
+  response_generator.SetNextResolution({blackhole.port(), servers_[0]->port_});
+  EXPECT_TRUE(SendRpc(stub, nullptr, 5000 /* timeout_ms */, nullptr,
+                      true /* wait_for_ready */));
+  const gpr_timespec t1 = gpr_now(GPR_CLOCK_MONOTONIC);
+  const grpc_millis waited_ms = gpr_time_to_millis(gpr_time_sub(t1, t0));
+  gpr_log(GPR_INFO, "Time to first RPC: %" PRId64 " ms", waited_ms);
+  // We substract one to account for test and precision accuracy drift.
+  EXPECT_GE(waited_ms, kMinConnectTimeoutMs - 1);
+}
+
 TEST_F(ClientLbEnd2endTest, PickFirstUpdates) {
   // Start servers and send one RPC per server.
   const int kNumServers = 3;
@@ -819,6 +900,37 @@ TEST_F(ClientLbEnd2endTest, PickFirstLocalSubchannelPool) {
   EXPECT_EQ(2UL, servers_[0]->service_.clients().size());
 }
 
+TEST_F(ClientLbEnd2endTest, PickFirstMultipleConnectionsPerSubchannel) {
+  // Start one server.
+  const int kNumServers = 1;
+  const size_t kNumConnections = 3;
+  StartServers(kNumServers);
+  // Create a channel whose subchannel keeps several connections open.
+  ChannelArguments args;
+  args.SetInt(GRPC_ARG_SUBCHANNEL_CONNECTIONS, kNumConnections);
+  auto response_generator = BuildResolverResponseGenerator();
+  auto channel = BuildChannel("pick_first", response_generator, args);
+  auto stub = BuildStub(channel);
+  response_generator.SetNextResolution(GetServersPorts());
+  WaitForServer(stub, 0, DEBUG_LOCATION);
+  // The additional connections are opened one at a time after the first.
+  // Once they are up, RPCs are spread across all of them, so the server
+  // eventually sees requests from that many client ports.
+  const gpr_timespec deadline = grpc_timeout_seconds_to_deadline(5);
+  gpr_timespec now = gpr_now(GPR_CLOCK_MONOTONIC);
+  while (gpr_time_cmp(deadline, now) > 0) {
+    CheckRpcSendOk(stub, DEBUG_LOCATION);
+    if (servers_[0]->service_.clients().size() == kNumConnections) break;
+    now = gpr_now(GPR_CLOCK_MONOTONIC);
+  }
+  ASSERT_GT(gpr_time_cmp(deadline, now), 0);
+  // No more connections than requested are opened.
+  for (size_t i = 0; i < 10 * kNumConnections; ++i) {
+    CheckRpcSendOk(stub, DEBUG_LOCATION);
+  }
+  EXPECT_EQ(kNumConnections, servers_[0]->service_.clients().size());
+}
+
 TEST_F(ClientLbEnd2endTest, PickFirstManyUpdates) {
   const int kNumUpdates = 1000;
   const int kNumServers = 3;
@@ -1073,6 +1185,88 @@ TEST_F(ClientLbEnd2endTest, RoundRobin) {
   EXPECT_EQ("round_robin", channel->GetLoadBalancingPolicyName());
 }
 
+TEST_F(ClientLbEnd2endTest, RoundRobinWarmUpConnectsAllSubchannels) {
+  const int kNumServers = 3;
+  StartServers(kNumServers);
+  auto response_generator = BuildResolverResponseGenerator();
+  auto channel = BuildChannel("round_robin", response_generator);
+  auto stub = BuildStub(channel);
+  response_generator.SetNextResolution(GetServersPorts());
+  EXPECT_TRUE(experimental::ChannelWarmUp(
+      channel.get(), grpc_timeout_seconds_to_deadline(5), /*send_ping=*/false));
+  EXPECT_EQ(GRPC_CHANNEL_READY, channel->GetState(false));
+  // Every subchannel is already connected, so the very first round of RPCs
+  // reaches every server instead of piling onto whichever connected first.
+  for (int i = 0; i < kNumServers; ++i) {
+    CheckRpcSendOk(stub, DEBUG_LOCATION);
+  }
+  for (int i = 0; i < kNumServers; ++i) {
+    EXPECT_EQ(1, servers_[i]->service_.request_count());
+  }
+}
+
+TEST_F(ClientLbEnd2endTest, PickFirstWarmUpWithPing) {
+  StartServers(1);
+  auto response_generator = BuildResolverResponseGenerator();
+  auto channel = BuildChannel("pick_first", response_generator);
+  auto stub = BuildStub(channel);
+  response_generator.SetNextResolution(GetServersPorts());
+  EXPECT_TRUE(experimental::ChannelWarmUp(
+      channel.get(), grpc_timeout_seconds_to_deadline(5), /*send_ping=*/true));
+  EXPECT_EQ(GRPC_CHANNEL_READY, channel->GetState(false));
+  CheckRpcSendOk(stub, DEBUG_LOCATION);
+  EXPECT_EQ(1, servers_[0]->service_.request_count());
+}
+
+TEST_F(ClientLbEnd2endTest, WarmUpFailsAtDeadlineWithoutServer) {
+  auto response_generator = BuildResolverResponseGenerator();
+  auto channel = BuildChannel("pick_first", response_generator);
+  response_generator.SetNextResolution({grpc_pick_unused_port_or_die()});
+  EXPECT_FALSE(experimental::ChannelWarmUp(
+      channel.get(), grpc_timeout_milliseconds_to_deadline(500),
+      /*send_ping=*/true));
+  EXPECT_NE(GRPC_CHANNEL_READY, channel->GetState(false));
+}
+
+TEST_F(ClientLbEnd2endTest, WarmUpFirstRpcLatency) {
+  StartServers(1);
+  // Use local subchannel pools, so that the warmed-up channel's connection
+  // is not shared with the cold one.
+  ChannelArguments args;
+  args.SetInt(GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL, 1);
+  auto cold_response_generator = BuildResolverResponseGenerator();
+  auto cold_channel =
+      BuildChannel("pick_first", cold_response_generator, args);
+  auto cold_stub = BuildStub(cold_channel);
+  cold_response_generator.SetNextResolution(GetServersPorts());
+  auto warm_response_generator = BuildResolverResponseGenerator();
+  auto warm_channel =
+      BuildChannel("pick_first", warm_response_generator, args);
+  auto warm_stub = BuildStub(warm_channel);
+  warm_response_generator.SetNextResolution(GetServersPorts());
+  ASSERT_TRUE(experimental::ChannelWarmUp(warm_channel.get(),
+                                          grpc_timeout_seconds_to_deadline(5),
+                                          /*send_ping=*/true));
+  // The cold channel pays for resolution, connection and handshakes on its
+  // first RPC; the warmed-up one only for the RPC itself.
+  auto elapsed_ms = [](gpr_timespec start) {
+    return gpr_timespec_to_micros(
+               gpr_time_sub(gpr_now(GPR_CLOCK_MONOTONIC), start)) /
+           1000.0;
+  };
+  gpr_timespec start = gpr_now(GPR_CLOCK_MONOTONIC);
+  CheckRpcSendOk(cold_stub, DEBUG_LOCATION, /*wait_for_ready=*/true);
+  const double cold_ms = elapsed_ms(start);
+  start = gpr_now(GPR_CLOCK_MONOTONIC);
+  CheckRpcSendOk(warm_stub, DEBUG_LOCATION);
+  const double warm_ms = elapsed_ms(start);
+  gpr_log(GPR_INFO, "first RPC latency: cold %.3f ms, warmed up %.3f ms",
+          cold_ms, warm_ms);
+  EXPECT_LT(warm_ms, cold_ms);
+  EXPECT_EQ(2, servers_[0]->service_.request_count());
+  EXPECT_EQ(2UL, servers_[0]->service_.clients().size());
+}
+
 TEST_F(ClientLbEnd2endTest, RoundRobinProcessPending) {
   StartServers(1);  // Single server
   auto response_generator = BuildResolverResponseGenerator();
@@ -17,6 +17,7 @@
  */
 
 #include <algorithm>
+#include <atomic>
 #include <condition_variable>
 #include <functional>
 #include <memory>
@@ -129,8 +130,13 @@ class MessageAllocatorEnd2endTestBase
   ~MessageAllocatorEnd2endTestBase() = default;
 
   void CreateServer(
-      experimental::MessageAllocator<EchoRequest, EchoResponse>* allocator) {
+      experimental::MessageAllocator<EchoRequest, EchoResponse>* allocator,
+      int message_arena_block_size = 0) {
     ServerBuilder builder;
+    if (message_arena_block_size > 0) {
+      builder.experimental().SetMessageArenaInitialBlockSize(
+          message_arena_block_size);
+    }
 
     auto server_creds = GetCredentialsProvider()->GetServerCredentials(
         GetParam().credentials_type);
@@ -374,6 +380,45 @@ TEST_P(ArenaAllocatorTest, SimpleRpc) {
   EXPECT_EQ(kRpcCount, allocator->allocation_count);
 }
 
+class MessageArenaTest : public MessageAllocatorEnd2endTestBase {};
+
+TEST_P(MessageArenaTest, SimpleRpc) {
+  MAYBE_SKIP_TEST;
+  const int kRpcCount = 10;
+  std::atomic_int arena_count{0};
+  auto mutator = [&arena_count](experimental::RpcAllocatorState*,
+                                const EchoRequest* req, EchoResponse* resp) {
+    EXPECT_NE(req->GetArena(), nullptr);
+    EXPECT_NE(resp->GetArena(), nullptr);
+    EXPECT_NE(req->GetArena(), resp->GetArena());
+    arena_count++;
+  };
+  callback_service_.SetAllocatorMutator(mutator);
+  // The messages outgrow the initial block after the first few RPCs.
+  CreateServer(nullptr, 4096);
+  ResetStub();
+  SendRpcs(kRpcCount);
+  EXPECT_EQ(kRpcCount, arena_count.load());
+}
+
+TEST_P(MessageArenaTest, AllocatorTakesPrecedence) {
+  MAYBE_SKIP_TEST;
+  const int kRpcCount = 10;
+  std::unique_ptr<SimpleAllocatorTest::SimpleAllocator> allocator(
+      new SimpleAllocatorTest::SimpleAllocator);
+  auto mutator = [](experimental::RpcAllocatorState*, const EchoRequest* req,
+                    EchoResponse* resp) {
+    EXPECT_EQ(req->GetArena(), nullptr);
+    EXPECT_EQ(resp->GetArena(), nullptr);
+  };
+  callback_service_.SetAllocatorMutator(mutator);
+  CreateServer(allocator.get(), 4096);
+  ResetStub();
+  SendRpcs(kRpcCount);
+  EXPECT_EQ(kRpcCount, allocator->allocation_count);
+  EXPECT_EQ(kRpcCount, allocator->messages_deallocation_count);
+}
+
 std::vector<TestScenario> CreateTestScenarios(bool test_insecure) {
   std::vector<TestScenario> scenarios;
   std::vector<grpc::string> credentials_types{
@@ -409,6 +454,8 @@ INSTANTIATE_TEST_SUITE_P(SimpleAllocatorTest, SimpleAllocatorTest,
                          ::testing::ValuesIn(CreateTestScenarios(true)));
 INSTANTIATE_TEST_SUITE_P(ArenaAllocatorTest, ArenaAllocatorTest,
                          ::testing::ValuesIn(CreateTestScenarios(true)));
+INSTANTIATE_TEST_SUITE_P(MessageArenaTest, MessageArenaTest,
+                         ::testing::ValuesIn(CreateTestScenarios(true)));
 
 }  // namespace
 }  // namespace testing
@@ -3518,6 +3518,49 @@ TEST_P(EdsTest, NacksSparsePriorityList) {
             "EDS update includes sparse priority list");
 }
 
+// Tests that many channels receiving the same large EDS resource all come
+// up and all follow an update to it.  The resource is parsed once per
+// update and shared between the channels; the timings are logged so that
+// the cost per channel can be compared across changes.
+TEST_P(EdsTest, ManyChannelsShareLargeResource) {
+  const size_t kNumChannels = 20;
+  const size_t kNumEndpoints = 1000;
+  AdsServiceImpl::EdsResourceArgs args({
+      {"locality0", std::vector<int>(kNumEndpoints, backends_[0]->port())},
+  });
+  balancers_[0]->ads_service()->SetEdsResource(
+      AdsServiceImpl::BuildEdsResource(args));
+  std::vector<std::shared_ptr<Channel>> channels;
+  const gpr_timespec t0 = gpr_now(GPR_CLOCK_MONOTONIC);
+  for (size_t i = 0; i < kNumChannels; ++i) {
+    ResetStub();
+    SetNextResolution({});
+    SetNextResolutionForLbChannelAllBalancers();
+    WaitForBackend(0);
+    channels.push_back(channel_);
+  }
+  const gpr_timespec t1 = gpr_now(GPR_CLOCK_MONOTONIC);
+  gpr_log(GPR_INFO,
+          "%" PRIuPTR " channels with %" PRIuPTR
+          " endpoints each connected in %d ms",
+          kNumChannels, kNumEndpoints,
+          gpr_time_to_millis(gpr_time_sub(t1, t0)));
+  // Move all endpoints to backend 1; every channel must pick that up.
+  args = AdsServiceImpl::EdsResourceArgs({
+      {"locality0", std::vector<int>(kNumEndpoints, backends_[1]->port())},
+  });
+  balancers_[0]->ads_service()->SetEdsResource(
+      AdsServiceImpl::BuildEdsResource(args));
+  for (const auto& channel : channels) {
+    channel_ = channel;
+    stub_ = grpc::testing::EchoTestService::NewStub(channel_);
+    WaitForBackend(1);
+  }
+  const gpr_timespec t2 = gpr_now(GPR_CLOCK_MONOTONIC);
+  gpr_log(GPR_INFO, "update applied to %" PRIuPTR " channels in %d ms",
+          kNumChannels, gpr_time_to_millis(gpr_time_sub(t2, t1)));
+}
+
 using LocalityMapTest = BasicTest;
 
 // Tests that the localities in a locality map are picked according to their
@@ -3727,6 +3770,50 @@ TEST_P(LocalityMapTest, UpdateMap) {
   }
 }
 
+// Tests that large EDS updates in which only one locality changes are
+// applied without disrupting the localities that did not change, and logs
+// how long each update takes to be applied.
+TEST_P(LocalityMapTest, LargeUpdatesChangingOneLocality) {
+  SetNextResolution({});
+  SetNextResolutionForLbChannelAllBalancers();
+  const size_t kNumEndpoints = 1000;
+  const size_t kNumUpdates = 10;
+  // locality0 lists backend 0 kNumEndpoints times and never changes.
+  // locality1 alternates between backends 1 and 2.
+  const std::vector<int> large_port_list(kNumEndpoints, backends_[0]->port());
+  AdsServiceImpl::EdsResourceArgs args({
+      {"locality0", large_port_list},
+      {"locality1", GetBackendPorts(1, 2)},
+  });
+  balancers_[0]->ads_service()->SetEdsResource(
+      AdsServiceImpl::BuildEdsResource(args));
+  WaitForAllBackends(0, 2);
+  grpc_millis total_update_ms = 0;
+  for (size_t i = 0; i < kNumUpdates; ++i) {
+    const size_t backend_idx = 2 - i % 2;
+    args = AdsServiceImpl::EdsResourceArgs({
+        {"locality0", large_port_list},
+        {"locality1", GetBackendPorts(backend_idx, backend_idx + 1)},
+    });
+    const gpr_timespec t0 = gpr_now(GPR_CLOCK_MONOTONIC);
+    balancers_[0]->ads_service()->SetEdsResource(
+        AdsServiceImpl::BuildEdsResource(args));
+    // No RPC may fail while the update is applied.
+    WaitForBackend(backend_idx, /*reset_counters=*/true,
+                   /*require_success=*/true);
+    const gpr_timespec t1 = gpr_now(GPR_CLOCK_MONOTONIC);
+    total_update_ms += gpr_time_to_millis(gpr_time_sub(t1, t0));
+  }
+  gpr_log(GPR_INFO,
+          "%" PRIuPTR " updates of %" PRIuPTR
+          " endpoints applied in %.1f ms on average",
+          kNumUpdates, kNumEndpoints + 1,
+          static_cast<double>(total_update_ms) / kNumUpdates);
+  // The unchanged locality is still in use.
+  CheckRpcSendOk(100);
+  EXPECT_GT(backends_[0]->backend_service()->request_count(), 0U);
+}
+
 // Tests that we don't fail RPCs when replacing all of the localities in
 // a given priority.
 TEST_P(LocalityMapTest, ReplaceAllLocalitiesInPriority) {
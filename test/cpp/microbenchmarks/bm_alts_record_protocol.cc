@@ -0,0 +1,178 @@
+/*
+ *
+ * Copyright 2020 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/* Benchmark ALTS record protocol throughput for small and large frames */
+
+#include <benchmark/benchmark.h>
+#include <string.h>
+
+#include <algorithm>
+
+#include <grpc/slice_buffer.h>
+
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/slice/slice_internal.h"
+#include "src/core/tsi/alts/crypt/gsec.h"
+#include "src/core/tsi/alts/zero_copy_frame_protector/alts_zero_copy_grpc_protector.h"
+#include "src/core/tsi/transport_security_grpc.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace {
+
+// A connected pair of protectors sharing one key.
+class ProtectorPair {
+ public:
+  ProtectorPair(size_t max_frame_size, bool integrity_only) {
+    uint8_t key[kAes128GcmRekeyKeyLength];
+    memset(key, 0x5a, sizeof(key));
+    size_t frame_size = max_frame_size;
+    GPR_ASSERT(alts_zero_copy_grpc_protector_create(
+                   key, sizeof(key), /*is_rekey=*/true, /*is_client=*/true,
+                   integrity_only, /*enable_extra_copy=*/false, &frame_size,
+                   &client_) == TSI_OK);
+    frame_size = max_frame_size;
+    GPR_ASSERT(alts_zero_copy_grpc_protector_create(
+                   key, sizeof(key), /*is_rekey=*/true, /*is_client=*/false,
+                   integrity_only, /*enable_extra_copy=*/false, &frame_size,
+                   &server_) == TSI_OK);
+  }
+
+  ~ProtectorPair() {
+    tsi_zero_copy_grpc_protector_destroy(client_);
+    tsi_zero_copy_grpc_protector_destroy(server_);
+  }
+
+  tsi_zero_copy_grpc_protector* client() { return client_; }
+  tsi_zero_copy_grpc_protector* server() { return server_; }
+
+ private:
+  tsi_zero_copy_grpc_protector* client_;
+  tsi_zero_copy_grpc_protector* server_;
+};
+
+// Adds message_size bytes to sb, split into slices of at most 8KB as they
+// would arrive from the transport.
+void AddMessage(grpc_slice_buffer* sb, size_t message_size) {
+  constexpr size_t kSliceSize = 8192;
+  while (message_size > 0) {
+    size_t length = std::min(message_size, kSliceSize);
+    grpc_slice slice = GRPC_SLICE_MALLOC(length);
+    memset(GRPC_SLICE_START_PTR(slice), 0xa5, length);
+    grpc_slice_buffer_add(sb, slice);
+    message_size -= length;
+  }
+}
+
+void ProtectLoop(benchmark::State& state, bool integrity_only) {
+  const size_t message_size = state.range(0);
+  const size_t max_frame_size = state.range(1);
+  grpc_core::ExecCtx exec_ctx;
+  ProtectorPair pair(max_frame_size, integrity_only);
+  grpc_slice_buffer unprotected;
+  grpc_slice_buffer protected_sb;
+  grpc_slice_buffer_init(&unprotected);
+  grpc_slice_buffer_init(&protected_sb);
+  for (auto _ : state) {
+    state.PauseTiming();
+    AddMessage(&unprotected, message_size);
+    state.ResumeTiming();
+    GPR_ASSERT(tsi_zero_copy_grpc_protector_protect(
+                   pair.client(), &unprotected, &protected_sb) == TSI_OK);
+    grpc_slice_buffer_reset_and_unref_internal(&protected_sb);
+  }
+  grpc_slice_buffer_destroy_internal(&unprotected);
+  grpc_slice_buffer_destroy_internal(&protected_sb);
+  state.SetBytesProcessed(state.iterations() * message_size);
+}
+
+void RoundTripLoop(benchmark::State& state, bool integrity_only) {
+  const size_t message_size = state.range(0);
+  const size_t max_frame_size = state.range(1);
+  grpc_core::ExecCtx exec_ctx;
+  ProtectorPair pair(max_frame_size, integrity_only);
+  grpc_slice_buffer unprotected;
+  grpc_slice_buffer protected_sb;
+  grpc_slice_buffer received;
+  grpc_slice_buffer_init(&unprotected);
+  grpc_slice_buffer_init(&protected_sb);
+  grpc_slice_buffer_init(&received);
+  for (auto _ : state) {
+    state.PauseTiming();
+    AddMessage(&unprotected, message_size);
+    state.ResumeTiming();
+    GPR_ASSERT(tsi_zero_copy_grpc_protector_protect(
+                   pair.client(), &unprotected, &protected_sb) == TSI_OK);
+    GPR_ASSERT(tsi_zero_copy_grpc_protector_unprotect(
+                   pair.server(), &protected_sb, &received) == TSI_OK);
+    GPR_ASSERT(received.length == message_size);
+    grpc_slice_buffer_reset_and_unref_internal(&received);
+  }
+  grpc_slice_buffer_destroy_internal(&unprotected);
+  grpc_slice_buffer_destroy_internal(&protected_sb);
+  grpc_slice_buffer_destroy_internal(&received);
+  state.SetBytesProcessed(state.iterations() * message_size);
+}
+
+// Message sizes from a single small frame up to many full frames, for the
+// minimum, default and a large maximum frame size.
+void SweepArgs(benchmark::internal::Benchmark* b) {
+  for (int max_frame_size : {1024, 16 * 1024, 128 * 1024}) {
+    for (int message_size = 64; message_size <= 4 * 1024 * 1024;
+         message_size *= 8) {
+      b->Args({message_size, max_frame_size});
+    }
+  }
+}
+
+}  // namespace
+
+static void BM_AltsProtect_PrivacyIntegrity(benchmark::State& state) {
+  TrackCounters track_counters;
+  ProtectLoop(state, /*integrity_only=*/false);
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_AltsProtect_PrivacyIntegrity)->Apply(SweepArgs);
+
+static void BM_AltsRoundTrip_PrivacyIntegrity(benchmark::State& state) {
+  TrackCounters track_counters;
+  RoundTripLoop(state, /*integrity_only=*/false);
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_AltsRoundTrip_PrivacyIntegrity)->Apply(SweepArgs);
+
+static void BM_AltsRoundTrip_IntegrityOnly(benchmark::State& state) {
+  TrackCounters track_counters;
+  RoundTripLoop(state, /*integrity_only=*/true);
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_AltsRoundTrip_IntegrityOnly)->Apply(SweepArgs);
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  ::grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
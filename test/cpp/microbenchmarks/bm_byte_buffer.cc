@@ -21,8 +21,10 @@
 #include <memory>
 
 #include <benchmark/benchmark.h>
+#include <grpcpp/impl/codegen/proto_utils.h>
 #include <grpcpp/impl/grpc_library.h>
 #include <grpcpp/support/byte_buffer.h>
+#include "src/proto/grpc/testing/echo_messages.pb.h"
 #include "test/cpp/microbenchmarks/helpers.h"
 #include "test/cpp/util/test_config.h"
 
@@ -112,6 +114,38 @@ static void BM_ByteBufferReader_Peek(benchmark::State& state) {
 }
 BENCHMARK(BM_ByteBufferReader_Peek)->Ranges({{64 * 1024, 1024 * 1024}});
 
+static void BM_ProtoSerialize(benchmark::State& state) {
+  EchoRequest request;
+  request.set_message(std::string(state.range(0), 'a'));
+  for (auto _ : state) {
+    grpc::ByteBuffer bb;
+    bool own_buffer;
+    GPR_ASSERT(grpc::SerializationTraits<EchoRequest>::Serialize(
+                   request, &bb, &own_buffer)
+                   .ok());
+  }
+  state.SetBytesProcessed(state.range(0) * state.iterations());
+}
+BENCHMARK(BM_ProtoSerialize)->Range(0, 4 * 1024 * 1024);
+
+static void BM_ProtoDeserialize(benchmark::State& state) {
+  EchoRequest request;
+  request.set_message(std::string(state.range(0), 'a'));
+  grpc::ByteBuffer serialized;
+  bool own_buffer;
+  GPR_ASSERT(grpc::SerializationTraits<EchoRequest>::Serialize(
+                 request, &serialized, &own_buffer)
+                 .ok());
+  for (auto _ : state) {
+    grpc::ByteBuffer bb(serialized);
+    EchoRequest parsed;
+    GPR_ASSERT(
+        grpc::SerializationTraits<EchoRequest>::Deserialize(&bb, &parsed).ok());
+  }
+  state.SetBytesProcessed(state.range(0) * state.iterations());
+}
+BENCHMARK(BM_ProtoDeserialize)->Range(0, 4 * 1024 * 1024);
+
 }  // namespace testing
 }  // namespace grpc
 
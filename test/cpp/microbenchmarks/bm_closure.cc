@@ -21,6 +21,7 @@
 #include <benchmark/benchmark.h>
 #include <grpc/grpc.h>
 #include <sstream>
+#include <vector>
 
 #include "src/core/lib/gpr/spinlock.h"
 #include "src/core/lib/iomgr/closure.h"
@@ -298,6 +299,46 @@ static void BM_ClosureSched3OnCombiner(benchmark::State& state) {
 }
 BENCHMARK(BM_ClosureSched3OnCombiner);
 
+static void BM_ClosureSchedManyOnCombiner(benchmark::State& state) {
+  TrackCounters track_counters;
+  grpc_core::Combiner* combiner = grpc_combiner_create();
+  std::vector<grpc_closure> closures(state.range(0));
+  for (auto& c : closures) {
+    GRPC_CLOSURE_INIT(&c, DoNothing, nullptr, nullptr);
+  }
+  grpc_core::ExecCtx exec_ctx;
+  for (auto _ : state) {
+    for (auto& c : closures) {
+      combiner->Run(&c, GRPC_ERROR_NONE);
+    }
+    grpc_core::ExecCtx::Get()->Flush();
+  }
+  GRPC_COMBINER_UNREF(combiner, "finished");
+
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_ClosureSchedManyOnCombiner)->Range(1, 64);
+
+static void BM_ClosureSchedListOnExecCtx(benchmark::State& state) {
+  TrackCounters track_counters;
+  std::vector<grpc_closure> closures(state.range(0));
+  for (auto& c : closures) {
+    GRPC_CLOSURE_INIT(&c, DoNothing, nullptr, nullptr);
+  }
+  grpc_core::ExecCtx exec_ctx;
+  for (auto _ : state) {
+    grpc_closure_list list = GRPC_CLOSURE_LIST_INIT;
+    for (auto& c : closures) {
+      grpc_closure_list_append(&list, &c, GRPC_ERROR_NONE);
+    }
+    grpc_core::ExecCtx::RunList(DEBUG_LOCATION, &list);
+    grpc_core::ExecCtx::Get()->Flush();
+  }
+
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_ClosureSchedListOnExecCtx)->Range(1, 64);
+
 static void BM_ClosureSched2OnTwoCombiners(benchmark::State& state) {
   TrackCounters track_counters;
   grpc_core::Combiner* combiner1 = grpc_combiner_create();
@@ -53,6 +53,24 @@ BENCHMARK_TEMPLATE(BM_PumpStreamServerToClient, MinUDS)->Arg(0);
 BENCHMARK_TEMPLATE(BM_PumpStreamServerToClient, MinInProcess)->Arg(0);
 BENCHMARK_TEMPLATE(BM_PumpStreamServerToClient, MinInProcessCHTTP2)->Arg(0);
 
+// A single backend pumped over many streams, with one and with several
+// connections per subchannel.
+static void ManyStreamsArgs(benchmark::internal::Benchmark* b) {
+  b->Ranges({{16 * 1024, 1024 * 1024}, {8, 64}});
+}
+BENCHMARK_TEMPLATE(BM_PumpManyStreamsClientToServer, TCP)
+    ->Apply(ManyStreamsArgs)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_PumpManyStreamsClientToServer, TCPx2)
+    ->Apply(ManyStreamsArgs)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_PumpManyStreamsClientToServer, TCPx4)
+    ->Apply(ManyStreamsArgs)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_PumpManyStreamsClientToServer, TCPx8)
+    ->Apply(ManyStreamsArgs)
+    ->UseRealTime();
+
 }  // namespace testing
 }  // namespace grpc
 
@@ -0,0 +1,119 @@
+/*
+ *
+ * Copyright 2020 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/* Benchmark streaming throughput over local TLS, with records protected in
+   user space or by the kernel */
+
+#include <grpcpp/security/credentials.h>
+#include <grpcpp/security/server_credentials.h>
+
+#include "test/core/end2end/data/ssl_test_data.h"
+#include "test/cpp/microbenchmarks/fullstack_streaming_pump.h"
+#include "test/cpp/util/test_config.h"
+
+namespace grpc {
+namespace testing {
+
+class TlsConfiguration : public FixtureConfiguration {
+ public:
+  void ApplyCommonChannelArguments(ChannelArguments* c) const override {
+    FixtureConfiguration::ApplyCommonChannelArguments(c);
+    c->SetSslTargetNameOverride("foo.test.google.fr");
+  }
+};
+
+class KernelTlsConfiguration : public TlsConfiguration {
+ public:
+  void ApplyCommonChannelArguments(ChannelArguments* c) const override {
+    TlsConfiguration::ApplyCommonChannelArguments(c);
+    c->SetInt(GRPC_ARG_ENABLE_KERNEL_TLS, 1);
+  }
+
+  void ApplyCommonServerBuilderConfig(ServerBuilder* b) const override {
+    TlsConfiguration::ApplyCommonServerBuilderConfig(b);
+    b->AddChannelArgument(GRPC_ARG_ENABLE_KERNEL_TLS, 1);
+  }
+};
+
+class TLS : public FullstackFixture {
+ public:
+  TLS(Service* service, const FixtureConfiguration& fixture_configuration =
+                            TlsConfiguration())
+      : FullstackFixture(service, fixture_configuration, MakeAddress(&port_),
+                         MakeServerCredentials(), MakeChannelCredentials()) {}
+
+  ~TLS() { grpc_recycle_unused_port(port_); }
+
+ private:
+  int port_;
+
+  static grpc::string MakeAddress(int* port) {
+    *port = grpc_pick_unused_port_or_die();
+    std::stringstream addr;
+    addr << "localhost:" << *port;
+    return addr.str();
+  }
+
+  static std::shared_ptr<ServerCredentials> MakeServerCredentials() {
+    SslServerCredentialsOptions options;
+    options.pem_key_cert_pairs.push_back({test_server1_key, test_server1_cert});
+    return ::grpc::SslServerCredentials(options);
+  }
+
+  static std::shared_ptr<ChannelCredentials> MakeChannelCredentials() {
+    SslCredentialsOptions options;
+    options.pem_root_certs = test_root_cert;
+    return ::grpc::SslCredentials(options);
+  }
+};
+
+// Falls back to TLS where the kernel or the session cannot take over.
+class KernelTLS : public TLS {
+ public:
+  KernelTLS(Service* service) : TLS(service, KernelTlsConfiguration()) {}
+};
+
+/*******************************************************************************
+ * CONFIGURATIONS
+ */
+
+BENCHMARK_TEMPLATE(BM_PumpStreamClientToServer, TLS)
+    ->Range(0, 128 * 1024 * 1024);
+BENCHMARK_TEMPLATE(BM_PumpStreamClientToServer, KernelTLS)
+    ->Range(0, 128 * 1024 * 1024);
+BENCHMARK_TEMPLATE(BM_PumpStreamServerToClient, TLS)
+    ->Range(0, 128 * 1024 * 1024);
+BENCHMARK_TEMPLATE(BM_PumpStreamServerToClient, KernelTLS)
+    ->Range(0, 128 * 1024 * 1024);
+
+}  // namespace testing
+}  // namespace grpc
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  ::grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -0,0 +1,247 @@
+/*
+ *
+ * Copyright 2020 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/* Benchmark unary latency on an established TLS connection while other
+   clients keep opening new TLS connections to the same server, with security
+   handshakes run inline or offloaded to the handshake thread pool */
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include <grpcpp/security/credentials.h>
+#include <grpcpp/security/server_credentials.h>
+
+#include "src/proto/grpc/testing/echo.grpc.pb.h"
+#include "test/core/end2end/data/ssl_test_data.h"
+#include "test/core/util/histogram.h"
+#include "test/cpp/microbenchmarks/fullstack_fixtures.h"
+#include "test/cpp/util/test_config.h"
+
+namespace grpc {
+namespace testing {
+
+class TlsConfiguration : public FixtureConfiguration {
+ public:
+  void ApplyCommonChannelArguments(ChannelArguments* c) const override {
+    FixtureConfiguration::ApplyCommonChannelArguments(c);
+    c->SetSslTargetNameOverride("foo.test.google.fr");
+  }
+};
+
+class OffloadTlsConfiguration : public TlsConfiguration {
+ public:
+  void ApplyCommonChannelArguments(ChannelArguments* c) const override {
+    TlsConfiguration::ApplyCommonChannelArguments(c);
+    c->SetInt(GRPC_ARG_OFFLOAD_HANDSHAKES, 1);
+  }
+
+  void ApplyCommonServerBuilderConfig(ServerBuilder* b) const override {
+    TlsConfiguration::ApplyCommonServerBuilderConfig(b);
+    b->AddChannelArgument(GRPC_ARG_OFFLOAD_HANDSHAKES, 1);
+  }
+};
+
+static const TlsConfiguration kTlsConfiguration;
+static const OffloadTlsConfiguration kOffloadTlsConfiguration;
+
+class TLS : public FullstackFixture {
+ public:
+  TLS(Service* service, const FixtureConfiguration& fixture_configuration =
+                            kTlsConfiguration)
+      : FullstackFixture(service, fixture_configuration, MakeAddress(&port_),
+                         MakeServerCredentials(), MakeChannelCredentials()),
+        fixture_configuration_(fixture_configuration) {}
+
+  ~TLS() { grpc_recycle_unused_port(port_); }
+
+  // Opens a new connection to the server, not shared with the fixture's
+  // channel or any other, and waits for its handshake to complete.
+  bool Connect() {
+    ChannelArguments args;
+    fixture_configuration_.ApplyCommonChannelArguments(&args);
+    args.SetInt(GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL, 1);
+    std::stringstream addr;
+    addr << "localhost:" << port_;
+    std::shared_ptr<Channel> channel =
+        ::grpc::CreateCustomChannel(addr.str(), MakeChannelCredentials(), args);
+    return channel->WaitForConnected(grpc_timeout_seconds_to_deadline(10));
+  }
+
+ private:
+  int port_;
+  const FixtureConfiguration& fixture_configuration_;
+
+  static grpc::string MakeAddress(int* port) {
+    *port = grpc_pick_unused_port_or_die();
+    std::stringstream addr;
+    addr << "localhost:" << *port;
+    return addr.str();
+  }
+
+  static std::shared_ptr<ServerCredentials> MakeServerCredentials() {
+    SslServerCredentialsOptions options;
+    options.pem_key_cert_pairs.push_back({test_server1_key, test_server1_cert});
+    return ::grpc::SslServerCredentials(options);
+  }
+
+  static std::shared_ptr<ChannelCredentials> MakeChannelCredentials() {
+    SslCredentialsOptions options;
+    options.pem_root_certs = test_root_cert;
+    return ::grpc::SslCredentials(options);
+  }
+};
+
+class OffloadTLS : public TLS {
+ public:
+  OffloadTLS(Service* service) : TLS(service, kOffloadTlsConfiguration) {}
+};
+
+// Threads that keep opening new connections to the fixture's server until
+// destroyed.
+class ConnectionStorm {
+ public:
+  ConnectionStorm(TLS* fixture, int num_threads) {
+    for (int i = 0; i < num_threads; ++i) {
+      threads_.emplace_back([this, fixture] {
+        while (!done_.load(std::memory_order_relaxed)) {
+          if (fixture->Connect()) {
+            connections_.fetch_add(1, std::memory_order_relaxed);
+          }
+        }
+      });
+    }
+  }
+
+  ~ConnectionStorm() {
+    done_.store(true, std::memory_order_relaxed);
+    for (auto& thread : threads_) {
+      thread.join();
+    }
+  }
+
+  int64_t connections() const {
+    return connections_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  std::atomic<bool> done_{false};
+  std::atomic<int64_t> connections_{0};
+  std::vector<std::thread> threads_;
+};
+
+/*******************************************************************************
+ * BENCHMARKING KERNELS
+ */
+
+static void* tag(intptr_t x) { return reinterpret_cast<void*>(x); }
+
+// The server side of the fixture is driven by the benchmark thread, which
+// therefore also runs the server side of any handshake that is not
+// offloaded.
+template <class Fixture>
+static void BM_UnaryDuringConnectionStorm(benchmark::State& state) {
+  EchoTestService::AsyncService service;
+  std::unique_ptr<Fixture> fixture(new Fixture(&service));
+  std::unique_ptr<EchoTestService::Stub> stub(
+      EchoTestService::NewStub(fixture->channel()));
+  EchoRequest send_request;
+  EchoResponse send_response;
+  EchoResponse recv_response;
+  Status recv_status;
+  grpc_histogram* latency = grpc_histogram_create(0.01, 60e6);
+  std::unique_ptr<ConnectionStorm> storm(
+      new ConnectionStorm(fixture.get(), state.range(0)));
+  gpr_timespec storm_start = gpr_now(GPR_CLOCK_MONOTONIC);
+  for (auto _ : state) {
+    gpr_timespec start = gpr_now(GPR_CLOCK_MONOTONIC);
+    ServerContext svr_ctx;
+    EchoRequest recv_request;
+    ServerAsyncResponseWriter<EchoResponse> response_writer(&svr_ctx);
+    service.RequestEcho(&svr_ctx, &recv_request, &response_writer,
+                        fixture->cq(), fixture->cq(), tag(0));
+    ClientContext cli_ctx;
+    std::unique_ptr<ClientAsyncResponseReader<EchoResponse>> response_reader(
+        stub->AsyncEcho(&cli_ctx, send_request, fixture->cq()));
+    response_reader->Finish(&recv_response, &recv_status, tag(2));
+    void* t;
+    bool ok;
+    GPR_ASSERT(fixture->cq()->Next(&t, &ok));
+    GPR_ASSERT(ok);
+    GPR_ASSERT(t == tag(0));
+    response_writer.Finish(send_response, Status::OK, tag(1));
+    for (int i = (1 << 1) | (1 << 2); i != 0;) {
+      GPR_ASSERT(fixture->cq()->Next(&t, &ok));
+      GPR_ASSERT(ok);
+      int tagnum = static_cast<int>(reinterpret_cast<intptr_t>(t));
+      GPR_ASSERT(i & (1 << tagnum));
+      i -= 1 << tagnum;
+    }
+    GPR_ASSERT(recv_status.ok());
+    grpc_histogram_add(latency, gpr_timespec_to_micros(gpr_time_sub(
+                                    gpr_now(GPR_CLOCK_MONOTONIC), start)));
+  }
+  const double storm_seconds = gpr_timespec_to_micros(gpr_time_sub(
+                                   gpr_now(GPR_CLOCK_MONOTONIC), storm_start)) /
+                               1e6;
+  state.counters["handshakes_per_second"] =
+      storm->connections() / storm_seconds;
+  state.counters["p50_us"] = grpc_histogram_percentile(latency, 50);
+  state.counters["p99_us"] = grpc_histogram_percentile(latency, 99);
+  storm.reset();
+  grpc_histogram_destroy(latency);
+  fixture->Finish(state);
+  fixture.reset();
+}
+
+/*******************************************************************************
+ * CONFIGURATIONS
+ */
+
+BENCHMARK_TEMPLATE(BM_UnaryDuringConnectionStorm, TLS)
+    ->Arg(0)
+    ->Arg(1)
+    ->Arg(4)
+    ->Arg(16)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_UnaryDuringConnectionStorm, OffloadTLS)
+    ->Arg(0)
+    ->Arg(1)
+    ->Arg(4)
+    ->Arg(16)
+    ->UseRealTime();
+
+}  // namespace testing
+}  // namespace grpc
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  ::grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
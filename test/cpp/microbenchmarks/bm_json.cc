@@ -0,0 +1,147 @@
+/*
+ *
+ * Copyright 2020 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/* Benchmark JSON parsing of service configs and xDS bootstrap files */
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include "absl/strings/str_cat.h"
+
+#include "src/core/lib/json/json.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+using grpc_core::Json;
+
+// A service config with one retrying method config per method.
+static std::string MakeServiceConfig(int num_methods) {
+  std::string config =
+      "{\n"
+      "  \"loadBalancingConfig\": [\n"
+      "    {\"round_robin\": {}},\n"
+      "    {\"pick_first\": {}}\n"
+      "  ],\n"
+      "  \"methodConfig\": [";
+  for (int i = 0; i < num_methods; ++i) {
+    absl::StrAppend(
+        &config, i == 0 ? "\n" : ",\n",
+        "    {\n"
+        "      \"name\": [\n"
+        "        {\"service\": \"grpc.testing.EchoTestService\", "
+        "\"method\": \"Echo",
+        i,
+        "\"}\n"
+        "      ],\n"
+        "      \"waitForReady\": true,\n"
+        "      \"timeout\": \"",
+        i % 60 + 1,
+        ".500s\",\n"
+        "      \"maxRequestMessageBytes\": 4194304,\n"
+        "      \"maxResponseMessageBytes\": 4194304,\n"
+        "      \"retryPolicy\": {\n"
+        "        \"maxAttempts\": 4,\n"
+        "        \"initialBackoff\": \"0.1s\",\n"
+        "        \"maxBackoff\": \"10s\",\n"
+        "        \"backoffMultiplier\": 1.5,\n"
+        "        \"retryableStatusCodes\": [\"UNAVAILABLE\", "
+        "\"RESOURCE_EXHAUSTED\"]\n"
+        "      }\n"
+        "    }");
+  }
+  absl::StrAppend(&config,
+                  "\n  ],\n"
+                  "  \"retryThrottling\": {\n"
+                  "    \"maxTokens\": 10,\n"
+                  "    \"tokenRatio\": 0.1\n"
+                  "  }\n"
+                  "}\n");
+  return config;
+}
+
+// An xDS bootstrap file whose node carries a sizeable metadata struct.
+static std::string MakeBootstrap(int num_metadata_entries) {
+  std::string bootstrap =
+      "{\n"
+      "  \"xds_servers\": [\n"
+      "    {\n"
+      "      \"server_uri\": \"trafficdirector.googleapis.com:443\",\n"
+      "      \"channel_creds\": [{\"type\": \"google_default\"}]\n"
+      "    }\n"
+      "  ],\n"
+      "  \"node\": {\n"
+      "    \"id\": \"projects/123456789/networks/default/nodes/"
+      "5d8a1f2b-7c3e-4e8b-9f0a-1b2c3d4e5f60\",\n"
+      "    \"cluster\": \"cluster\",\n"
+      "    \"locality\": {\"zone\": \"us-central1-a\"},\n"
+      "    \"metadata\": {";
+  for (int i = 0; i < num_metadata_entries; ++i) {
+    absl::StrAppend(&bootstrap, i == 0 ? "\n" : ",\n", "      \"LABEL_", i,
+                    "\": \"value with a \\\"quoted\\\" part and \\u00e9 ", i,
+                    "\"");
+  }
+  absl::StrAppend(&bootstrap,
+                  "\n    }\n"
+                  "  }\n"
+                  "}\n");
+  return bootstrap;
+}
+
+static void ParseLoop(benchmark::State& state, const std::string& input) {
+  for (auto _ : state) {
+    grpc_error* error = GRPC_ERROR_NONE;
+    Json json = Json::Parse(input, &error);
+    GPR_ASSERT(error == GRPC_ERROR_NONE);
+    benchmark::DoNotOptimize(json);
+  }
+  state.SetBytesProcessed(state.iterations() * input.size());
+}
+
+static void BM_JsonParse_ServiceConfig(benchmark::State& state) {
+  ParseLoop(state, MakeServiceConfig(state.range(0)));
+}
+BENCHMARK(BM_JsonParse_ServiceConfig)->Range(1, 4096);
+
+static void BM_JsonParse_Bootstrap(benchmark::State& state) {
+  ParseLoop(state, MakeBootstrap(state.range(0)));
+}
+BENCHMARK(BM_JsonParse_Bootstrap)->Range(1, 4096);
+
+static void BM_JsonDump_ServiceConfig(benchmark::State& state) {
+  grpc_error* error = GRPC_ERROR_NONE;
+  Json json = Json::Parse(MakeServiceConfig(state.range(0)), &error);
+  GPR_ASSERT(error == GRPC_ERROR_NONE);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(json.Dump());
+  }
+}
+BENCHMARK(BM_JsonDump_ServiceConfig)->Range(1, 4096);
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  ::benchmark::Initialize(&argc, argv);
+  ::grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
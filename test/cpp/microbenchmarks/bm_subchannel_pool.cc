@@ -0,0 +1,190 @@
+/*
+ *
+ * Copyright 2020 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/* Benchmark rebuilding subchannel lists on large address updates, and many
+   threads creating subchannels for overlapping targets at once */
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "absl/strings/str_cat.h"
+
+#include <grpc/grpc.h>
+
+#include "src/core/ext/filters/client_channel/connector.h"
+#include "src/core/ext/filters/client_channel/global_subchannel_pool.h"
+#include "src/core/ext/filters/client_channel/local_subchannel_pool.h"
+#include "src/core/ext/filters/client_channel/subchannel.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+// The subchannels are never asked to connect.
+class NoOpConnector : public SubchannelConnector {
+ public:
+  void Connect(const Args& /*args*/, Result* /*result*/,
+               grpc_closure* /*notify*/) override {}
+  void Shutdown(grpc_error* error) override { GRPC_ERROR_UNREF(error); }
+};
+
+std::string AddressUri(int i) {
+  return absl::StrCat("ipv4:10.", (i >> 16) & 0xff, ".", (i >> 8) & 0xff, ".",
+                      i & 0xff, ":443");
+}
+
+// Args of the kind a channel passes down to each of its subchannels.
+grpc_channel_args* CreateBaseArgs(SubchannelPoolInterface* pool) {
+  grpc_arg args[] = {
+      grpc_channel_arg_string_create(
+          const_cast<char*>(GRPC_ARG_PRIMARY_USER_AGENT_STRING),
+          const_cast<char*>("bm_subchannel_pool")),
+      grpc_channel_arg_string_create(
+          const_cast<char*>(GRPC_ARG_DEFAULT_AUTHORITY),
+          const_cast<char*>("backend.example.com")),
+      grpc_channel_arg_integer_create(
+          const_cast<char*>(GRPC_ARG_KEEPALIVE_TIME_MS), 60000),
+      grpc_channel_arg_integer_create(
+          const_cast<char*>(GRPC_ARG_MAX_RECEIVE_MESSAGE_LENGTH), 4194304),
+      grpc_channel_arg_integer_create(
+          const_cast<char*>(GRPC_ARG_INITIAL_RECONNECT_BACKOFF_MS), 1000),
+      SubchannelPoolInterface::CreateChannelArg(pool),
+  };
+  return grpc_channel_args_copy_and_add(nullptr, args, GPR_ARRAY_SIZE(args));
+}
+
+std::vector<Subchannel*> CreateSubchannels(const grpc_channel_args* base_args,
+                                           int first, int num_addresses) {
+  std::vector<Subchannel*> subchannels;
+  subchannels.reserve(num_addresses);
+  for (int i = first; i < first + num_addresses; ++i) {
+    std::string uri = AddressUri(i);
+    grpc_arg address_arg = grpc_channel_arg_string_create(
+        const_cast<char*>(GRPC_ARG_SUBCHANNEL_ADDRESS),
+        const_cast<char*>(uri.c_str()));
+    grpc_channel_args* args =
+        grpc_channel_args_copy_and_add(base_args, &address_arg, 1);
+    subchannels.push_back(
+        Subchannel::Create(MakeOrphanable<NoOpConnector>(), args));
+    grpc_channel_args_destroy(args);
+  }
+  return subchannels;
+}
+
+void UnrefSubchannels(std::vector<Subchannel*>* subchannels) {
+  for (Subchannel* subchannel : *subchannels) {
+    GRPC_SUBCHANNEL_UNREF(subchannel, "bm_subchannel_pool");
+  }
+  subchannels->clear();
+}
+
+// Each iteration applies one address update: a new subchannel list is built
+// while the previous one is still alive, so that the addresses the two have
+// in common reuse their subchannels from the pool, and then the previous list
+// is dropped. Each update replaces a tenth of the addresses.
+void RebuildLoop(benchmark::State& state, SubchannelPoolInterface* pool) {
+  const int num_addresses = state.range(0);
+  const int churn = std::max(1, num_addresses / 10);
+  ExecCtx exec_ctx;
+  grpc_channel_args* base_args = CreateBaseArgs(pool);
+  int first = 0;
+  std::vector<Subchannel*> current =
+      CreateSubchannels(base_args, first, num_addresses);
+  for (auto _ : state) {
+    first += churn;
+    std::vector<Subchannel*> next =
+        CreateSubchannels(base_args, first, num_addresses);
+    UnrefSubchannels(&current);
+    current = std::move(next);
+    ExecCtx::Get()->Flush();
+  }
+  UnrefSubchannels(&current);
+  grpc_channel_args_destroy(base_args);
+  ExecCtx::Get()->Flush();
+  state.SetItemsProcessed(state.iterations() * num_addresses);
+}
+
+// Each iteration creates the subchannels for a window of addresses, as a new
+// channel does when it first connects, and drops them again. The windows of
+// neighbouring threads overlap by half, so threads both share subchannels
+// through the pool and race to register and unregister them.
+void CreateLoop(benchmark::State& state, SubchannelPoolInterface* pool) {
+  const int num_addresses = state.range(0);
+  ExecCtx exec_ctx;
+  grpc_channel_args* base_args = CreateBaseArgs(pool);
+  const int first = state.thread_index * num_addresses / 2;
+  for (auto _ : state) {
+    std::vector<Subchannel*> subchannels =
+        CreateSubchannels(base_args, first, num_addresses);
+    UnrefSubchannels(&subchannels);
+    ExecCtx::Get()->Flush();
+  }
+  grpc_channel_args_destroy(base_args);
+  ExecCtx::Get()->Flush();
+  state.SetItemsProcessed(state.iterations() * num_addresses);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+static void BM_SubchannelListRebuild_GlobalPool(benchmark::State& state) {
+  TrackCounters track_counters;
+  grpc_core::RebuildLoop(state,
+                         grpc_core::GlobalSubchannelPool::instance().get());
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_SubchannelListRebuild_GlobalPool)->Range(16, 8192);
+
+static void BM_SubchannelListRebuild_LocalPool(benchmark::State& state) {
+  TrackCounters track_counters;
+  auto pool = grpc_core::MakeRefCounted<grpc_core::LocalSubchannelPool>();
+  grpc_core::RebuildLoop(state, pool.get());
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_SubchannelListRebuild_LocalPool)->Range(16, 8192);
+
+static void BM_ConcurrentSubchannelCreate_GlobalPool(benchmark::State& state) {
+  TrackCounters track_counters;
+  grpc_core::CreateLoop(state,
+                        grpc_core::GlobalSubchannelPool::instance().get());
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_ConcurrentSubchannelCreate_GlobalPool)
+    ->Arg(1024)
+    ->ThreadRange(1, 32)
+    ->UseRealTime();
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  ::grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
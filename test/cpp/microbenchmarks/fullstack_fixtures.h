@@ -32,6 +32,7 @@
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/iomgr/endpoint.h"
 #include "src/core/lib/iomgr/endpoint_pair.h"
+#include "src/core/lib/iomgr/endpoint_shm.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/iomgr/tcp_posix.h"
 #include "src/core/lib/surface/channel.h"
@@ -65,10 +66,17 @@ class BaseFixture : public TrackCounters {};
 class FullstackFixture : public BaseFixture {
  public:
   FullstackFixture(Service* service, const FixtureConfiguration& config,
-                   const grpc::string& address) {
+                   const grpc::string& address)
+      : FullstackFixture(service, config, address, InsecureServerCredentials(),
+                         InsecureChannelCredentials()) {}
+
+  FullstackFixture(Service* service, const FixtureConfiguration& config,
+                   const grpc::string& address,
+                   std::shared_ptr<ServerCredentials> server_creds,
+                   std::shared_ptr<ChannelCredentials> channel_creds) {
     ServerBuilder b;
     if (address.length() > 0) {
-      b.AddListeningPort(address, InsecureServerCredentials());
+      b.AddListeningPort(address, server_creds);
     }
     cq_ = b.AddCompletionQueue(true);
     b.RegisterService(service);
@@ -77,8 +85,7 @@ class FullstackFixture : public BaseFixture {
     ChannelArguments args;
     config.ApplyCommonChannelArguments(&args);
     if (address.length() > 0) {
-      channel_ = ::grpc::CreateCustomChannel(
-          address, InsecureChannelCredentials(), args);
+      channel_ = ::grpc::CreateCustomChannel(address, channel_creds, args);
     } else {
       channel_ = server_->InProcessChannel(args);
     }
@@ -148,6 +155,30 @@ class UDS : public FullstackFixture {
   }
 };
 
+#ifdef GRPC_HAVE_SHM_ENDPOINT
+// Connects over a Unix domain socket and then moves the connection onto
+// shared memory.
+class Shm : public FullstackFixture {
+ public:
+  Shm(Service* service, const FixtureConfiguration& fixture_configuration =
+                            FixtureConfiguration())
+      : FullstackFixture(service, fixture_configuration, MakeAddress(&port_)) {}
+
+  ~Shm() { grpc_recycle_unused_port(port_); }
+
+ private:
+  int port_;
+
+  static grpc::string MakeAddress(int* port) {
+    *port = grpc_pick_unused_port_or_die();  // just for a unique id - not a
+                                             // real port
+    std::stringstream addr;
+    addr << "shm:/tmp/bm_fullstack_shm." << *port;
+    return addr.str();
+  }
+};
+#endif  // GRPC_HAVE_SHM_ENDPOINT
+
 class InProcess : public FullstackFixture {
  public:
   InProcess(Service* service,
@@ -321,10 +352,55 @@ class MinStackize : public Base {
 
 typedef MinStackize<TCP> MinTCP;
 typedef MinStackize<UDS> MinUDS;
+#ifdef GRPC_HAVE_SHM_ENDPOINT
+typedef MinStackize<Shm> MinShm;
+#endif
 typedef MinStackize<InProcess> MinInProcess;
 typedef MinStackize<SockPair> MinSockPair;
 typedef MinStackize<InProcessCHTTP2> MinInProcessCHTTP2;
 
+////////////////////////////////////////////////////////////////////////////////
+// Fixtures keeping several HTTP/2 connections per subchannel
+
+template <int kConnections>
+class SubchannelConnectionsConfiguration : public FixtureConfiguration {
+  void ApplyCommonChannelArguments(ChannelArguments* a) const override {
+    a->SetInt(GRPC_ARG_SUBCHANNEL_CONNECTIONS, kConnections);
+    FixtureConfiguration::ApplyCommonChannelArguments(a);
+  }
+};
+
+template <class Base, int kConnections>
+class MultiConnectionize : public Base {
+ public:
+  MultiConnectionize(Service* service)
+      : Base(service, SubchannelConnectionsConfiguration<kConnections>()) {}
+};
+
+typedef MultiConnectionize<TCP, 2> TCPx2;
+typedef MultiConnectionize<TCP, 4> TCPx4;
+typedef MultiConnectionize<TCP, 8> TCPx8;
+
+////////////////////////////////////////////////////////////////////////////////
+// Fixtures allocating sync/callback messages on per-message protobuf arenas
+
+class MessageArenaConfiguration : public FixtureConfiguration {
+  void ApplyCommonServerBuilderConfig(ServerBuilder* b) const override {
+    b->experimental().SetMessageArenaInitialBlockSize(4096);
+    FixtureConfiguration::ApplyCommonServerBuilderConfig(b);
+  }
+};
+
+template <class Base>
+class MessageArenaize : public Base {
+ public:
+  MessageArenaize(Service* service)
+      : Base(service, MessageArenaConfiguration()) {}
+};
+
+typedef MessageArenaize<InProcess> ArenaInProcess;
+typedef MessageArenaize<InProcessCHTTP2> ArenaInProcessCHTTP2;
+
 }  // namespace testing
 }  // namespace grpc
 
@@ -0,0 +1,214 @@
+/*
+ *
+ * Copyright 2020 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <atomic>
+#include <vector>
+
+#include <gmock/gmock.h>
+
+#include <grpc/grpc.h>
+#include <grpc/support/alloc.h>
+#include <grpc/support/log.h>
+#include <grpc/support/string_util.h>
+#include <grpc/support/time.h>
+
+#include "src/core/ext/filters/client_channel/resolver.h"
+#include "src/core/ext/filters/client_channel/resolver/dns/dns_resolver_selection.h"
+#include "src/core/ext/filters/client_channel/resolver_registry.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/gprpp/orphanable.h"
+#include "src/core/lib/iomgr/pollset.h"
+#include "src/core/lib/iomgr/pollset_set.h"
+#include "src/core/lib/iomgr/work_serializer.h"
+#include "test/core/util/port.h"
+#include "test/core/util/test_config.h"
+#include "test/cpp/naming/dns_test_util.h"
+
+namespace {
+
+struct ArgsStruct {
+  std::atomic<int> results{0};
+  gpr_mu* mu;
+  grpc_pollset* pollset;
+  grpc_pollset_set* pollset_set;
+  std::shared_ptr<grpc_core::WorkSerializer> lock;
+};
+
+void ArgsInit(ArgsStruct* args) {
+  args->pollset = (grpc_pollset*)gpr_zalloc(grpc_pollset_size());
+  grpc_pollset_init(args->pollset, &args->mu);
+  args->pollset_set = grpc_pollset_set_create();
+  grpc_pollset_set_add_pollset(args->pollset_set, args->pollset);
+  args->lock = std::make_shared<grpc_core::WorkSerializer>();
+}
+
+void DoNothing(void* /*arg*/, grpc_error* /*error*/) {}
+
+void ArgsFinish(ArgsStruct* args) {
+  grpc_pollset_set_del_pollset(args->pollset_set, args->pollset);
+  grpc_pollset_set_destroy(args->pollset_set);
+  grpc_closure DoNothing_cb;
+  GRPC_CLOSURE_INIT(&DoNothing_cb, DoNothing, nullptr,
+                    grpc_schedule_on_exec_ctx);
+  grpc_pollset_shutdown(args->pollset, &DoNothing_cb);
+  // exec_ctx needs to be flushed before calling grpc_pollset_destroy()
+  grpc_core::ExecCtx::Get()->Flush();
+  grpc_pollset_destroy(args->pollset);
+  gpr_free(args->pollset);
+}
+
+void PollPollsetUntilResults(ArgsStruct* args, int expected_results) {
+  gpr_timespec deadline = grpc_timeout_seconds_to_deadline(10);
+  while (args->results.load() < expected_results) {
+    GPR_ASSERT(gpr_time_cmp(gpr_now(GPR_CLOCK_MONOTONIC), deadline) < 0);
+    grpc_pollset_worker* worker = nullptr;
+    grpc_core::ExecCtx exec_ctx;
+    gpr_mu_lock(args->mu);
+    GRPC_LOG_IF_ERROR(
+        "pollset_work",
+        grpc_pollset_work(args->pollset, &worker,
+                          grpc_core::ExecCtx::Get()->Now() + 100));
+    gpr_mu_unlock(args->mu);
+  }
+}
+
+class CountingResultHandler : public grpc_core::Resolver::ResultHandler {
+ public:
+  explicit CountingResultHandler(ArgsStruct* args) : args_(args) {}
+
+  void ReturnResult(grpc_core::Resolver::Result result) override {
+    EXPECT_EQ(result.addresses.size(), 1u);
+    args_->results.fetch_add(1);
+    gpr_mu_lock(args_->mu);
+    GRPC_LOG_IF_ERROR("pollset_kick",
+                      grpc_pollset_kick(args_->pollset, nullptr));
+    gpr_mu_unlock(args_->mu);
+  }
+
+  void ReturnError(grpc_error* error) override {
+    gpr_log(GPR_ERROR, "unexpected resolution error: %s",
+            grpc_error_string(error));
+    GPR_ASSERT(false);
+  }
+
+ private:
+  ArgsStruct* args_;
+};
+
+// Starts num_resolvers resolvers for name, waits for all of them to return a
+// result, logs how long that took and shuts them down.
+void ResolveConcurrently(int dns_port, const char* name, bool enable_cache,
+                         int num_resolvers) {
+  grpc_core::ExecCtx exec_ctx;
+  ArgsStruct args;
+  ArgsInit(&args);
+  char* target;
+  GPR_ASSERT(gpr_asprintf(&target, "dns://[::1]:%d/%s:1234", dns_port, name));
+  grpc_arg arg = grpc_channel_arg_integer_create(
+      const_cast<char*>(GRPC_ARG_DNS_ARES_ENABLE_CACHE), enable_cache);
+  grpc_channel_args channel_args = {1, &arg};
+  gpr_timespec start = gpr_now(GPR_CLOCK_MONOTONIC);
+  std::vector<grpc_core::OrphanablePtr<grpc_core::Resolver>> resolvers;
+  for (int i = 0; i < num_resolvers; ++i) {
+    resolvers.push_back(grpc_core::ResolverRegistry::CreateResolver(
+        target, &channel_args, args.pollset_set, args.lock,
+        absl::make_unique<CountingResultHandler>(&args)));
+    resolvers.back()->StartLocked();
+  }
+  grpc_core::ExecCtx::Get()->Flush();
+  PollPollsetUntilResults(&args, num_resolvers);
+  gpr_timespec elapsed = gpr_time_sub(gpr_now(GPR_CLOCK_MONOTONIC), start);
+  gpr_log(GPR_INFO, "%d resolvers (cache %s) resolved %s in %.3fms",
+          num_resolvers, enable_cache ? "on" : "off", name,
+          gpr_timespec_to_micros(elapsed) / 1000.0);
+  resolvers.clear();
+  grpc_core::ExecCtx::Get()->Flush();
+  gpr_free(target);
+  ArgsFinish(&args);
+}
+
+class AresDnsCacheTest : public ::testing::Test {
+ protected:
+  static void SetUpTestCase() {
+    GPR_GLOBAL_CONFIG_SET(grpc_dns_resolver, "ares");
+    grpc_init();
+  }
+
+  static void TearDownTestCase() { grpc_shutdown(); }
+};
+
+TEST_F(AresDnsCacheTest, ConcurrentResolutionsShareOneLookup) {
+  int port = grpc_pick_unused_port_or_die();
+  grpc::testing::FakeDNSServer dns_server(port, 300);
+  ResolveConcurrently(port, "coalesced.test.com", true, 50);
+  EXPECT_EQ(dns_server.a_queries(), 1);
+}
+
+TEST_F(AresDnsCacheTest, FreshEntryIsServedWithoutQuerying) {
+  int port = grpc_pick_unused_port_or_die();
+  grpc::testing::FakeDNSServer dns_server(port, 300);
+  ResolveConcurrently(port, "fresh.test.com", true, 1);
+  EXPECT_EQ(dns_server.a_queries(), 1);
+  ResolveConcurrently(port, "fresh.test.com", true, 1);
+  EXPECT_EQ(dns_server.a_queries(), 1);
+}
+
+TEST_F(AresDnsCacheTest, ExpiredEntryIsLookedUpAgain) {
+  int port = grpc_pick_unused_port_or_die();
+  grpc::testing::FakeDNSServer dns_server(port, 1);
+  ResolveConcurrently(port, "expiring.test.com", true, 1);
+  EXPECT_EQ(dns_server.a_queries(), 1);
+  gpr_sleep_until(grpc_timeout_milliseconds_to_deadline(1500));
+  // Entries nobody was served from are not prefetched.
+  EXPECT_EQ(dns_server.a_queries(), 1);
+  ResolveConcurrently(port, "expiring.test.com", true, 1);
+  EXPECT_EQ(dns_server.a_queries(), 2);
+}
+
+TEST_F(AresDnsCacheTest, UsedEntryIsPrefetchedBeforeExpiry) {
+  int port = grpc_pick_unused_port_or_die();
+  grpc::testing::FakeDNSServer dns_server(port, 3);
+  ResolveConcurrently(port, "prefetched.test.com", true, 1);
+  ResolveConcurrently(port, "prefetched.test.com", true, 1);
+  EXPECT_EQ(dns_server.a_queries(), 1);
+  // The prefetch timer refreshes the entry with no resolver around.
+  gpr_timespec deadline = grpc_timeout_seconds_to_deadline(10);
+  while (dns_server.a_queries() < 2) {
+    ASSERT_LT(gpr_time_cmp(gpr_now(GPR_CLOCK_MONOTONIC), deadline), 0);
+    gpr_sleep_until(grpc_timeout_milliseconds_to_deadline(100));
+  }
+  // Past the original TTL, the refreshed entry is still served.
+  gpr_sleep_until(grpc_timeout_milliseconds_to_deadline(1500));
+  ResolveConcurrently(port, "prefetched.test.com", true, 1);
+  EXPECT_EQ(dns_server.a_queries(), 2);
+}
+
+TEST_F(AresDnsCacheTest, ResolversWithoutCacheQueryIndividually) {
+  int port = grpc_pick_unused_port_or_die();
+  grpc::testing::FakeDNSServer dns_server(port, 300);
+  ResolveConcurrently(port, "uncached.test.com", false, 50);
+  EXPECT_EQ(dns_server.a_queries(), 50);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
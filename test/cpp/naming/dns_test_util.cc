@@ -93,5 +93,82 @@ FakeNonResponsiveDNSServer::~FakeNonResponsiveDNSServer() {
 #endif
 }
 
+FakeDNSServer::FakeDNSServer(int port, uint32_t ttl_seconds)
+    : ttl_seconds_(ttl_seconds) {
+  udp_socket_ = socket(AF_INET6, SOCK_DGRAM, 0);
+  if (udp_socket_ == BAD_SOCKET_RETURN_VAL) {
+    gpr_log(GPR_DEBUG, "Failed to create UDP ipv6 socket");
+    abort();
+  }
+  sockaddr_in6 addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sin6_family = AF_INET6;
+  addr.sin6_port = htons(port);
+  ((char*)&addr.sin6_addr)[15] = 1;
+  if (bind(udp_socket_, (const sockaddr*)&addr, sizeof(addr)) != 0) {
+    gpr_log(GPR_DEBUG, "Failed to bind UDP ipv6 socket to [::1]:%d", port);
+    abort();
+  }
+  thread_ = std::thread([this]() { Serve(); });
+}
+
+FakeDNSServer::~FakeDNSServer() {
+  shutdown_.store(true);
+  thread_.join();
+#ifdef GPR_WINDOWS
+  closesocket(udp_socket_);
+#else
+  close(udp_socket_);
+#endif
+}
+
+void FakeDNSServer::Serve() {
+  while (!shutdown_.load()) {
+    fd_set read_fds;
+    FD_ZERO(&read_fds);
+    FD_SET(udp_socket_, &read_fds);
+    timeval timeout = {0, 100 * 1000};
+    if (select(udp_socket_ + 1, &read_fds, nullptr, nullptr, &timeout) <= 0) {
+      continue;
+    }
+    unsigned char query[512];
+    sockaddr_in6 from;
+    socklen_t from_len = sizeof(from);
+    int len = recvfrom(udp_socket_, (char*)query, sizeof(query), 0,
+                       (sockaddr*)&from, &from_len);
+    // Header, then a single question: labels, type and class.
+    if (len < 12) continue;
+    int pos = 12;
+    while (pos < len && query[pos] != 0) pos += query[pos] + 1;
+    if (pos + 5 > len) continue;
+    const bool is_a = query[pos + 1] == 0 && query[pos + 2] == 1;
+    const int question_end = pos + 5;
+    unsigned char response[512 + 16];
+    memcpy(response, query, question_end);
+    response[2] = 0x81;  // QR, RD
+    response[3] = 0x80;  // RA, NOERROR
+    memset(response + 6, 0, 6);
+    int response_len = question_end;
+    if (is_a) {
+      response[7] = 1;  // ANCOUNT
+      const unsigned char answer[] = {
+          0xc0, 0x0c,  // name: pointer to the question
+          0x00, 0x01,  // type A
+          0x00, 0x01,  // class IN
+          static_cast<unsigned char>(ttl_seconds_ >> 24),
+          static_cast<unsigned char>(ttl_seconds_ >> 16),
+          static_cast<unsigned char>(ttl_seconds_ >> 8),
+          static_cast<unsigned char>(ttl_seconds_),
+          0x00, 0x04,  // RDLENGTH
+          127, 0, 0, 1};
+      memcpy(response + response_len, answer, sizeof(answer));
+      response_len += sizeof(answer);
+      a_queries_.fetch_add(1);
+    }
+    sendto(udp_socket_, (const char*)response, response_len, 0,
+           (const sockaddr*)&from, from_len);
+  }
+}
+
 }  // namespace testing
 }  // namespace grpc
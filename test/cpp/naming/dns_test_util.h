@@ -19,6 +19,11 @@
 #ifndef GRPC_DNS_TEST_UTIL_H
 #define GRPC_DNS_TEST_UTIL_H
 
+#include <stdint.h>
+
+#include <atomic>
+#include <thread>
+
 namespace grpc {
 namespace testing {
 
@@ -32,6 +37,26 @@ class FakeNonResponsiveDNSServer {
   int tcp_socket_;
 };
 
+// A UDP DNS server on [::1]:port that answers every A query with 127.0.0.1,
+// using the given record TTL, and every other query with an empty answer.
+class FakeDNSServer {
+ public:
+  FakeDNSServer(int port, uint32_t ttl_seconds);
+  ~FakeDNSServer();
+
+  // Number of A queries answered so far.
+  int a_queries() const { return a_queries_.load(); }
+
+ private:
+  void Serve();
+
+  int udp_socket_;
+  const uint32_t ttl_seconds_;
+  std::atomic<bool> shutdown_{false};
+  std::atomic<int> a_queries_{0};
+  std::thread thread_;
+};
+
 }  // namespace testing
 }  // namespace grpc
 
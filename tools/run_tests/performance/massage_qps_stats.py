@@ -317,6 +317,24 @@ def massage_qps_stats(scenario_result):
             stats[
                 "core_cq_ev_queue_transient_pop_failures"] = massage_qps_stats_helpers.counter(
                     core_stats, "cq_ev_queue_transient_pop_failures")
+            stats[
+                "core_handshake_steps_offloaded"] = massage_qps_stats_helpers.counter(
+                    core_stats, "handshake_steps_offloaded")
+            stats[
+                "core_handshake_offload_rejected"] = massage_qps_stats_helpers.counter(
+                    core_stats, "handshake_offload_rejected")
+            stats[
+                "core_ssl_client_handshakes"] = massage_qps_stats_helpers.counter(
+                    core_stats, "ssl_client_handshakes")
+            stats[
+                "core_ssl_client_sessions_resumed"] = massage_qps_stats_helpers.counter(
+                    core_stats, "ssl_client_sessions_resumed")
+            stats[
+                "core_ssl_server_handshakes"] = massage_qps_stats_helpers.counter(
+                    core_stats, "ssl_server_handshakes")
+            stats[
+                "core_ssl_server_sessions_resumed"] = massage_qps_stats_helpers.counter(
+                    core_stats, "ssl_server_sessions_resumed")
             h = massage_qps_stats_helpers.histogram(core_stats,
                                                     "call_initial_size")
             stats["core_call_initial_size"] = ",".join(
@@ -494,6 +512,81 @@ def massage_qps_stats(scenario_result):
             stats[
                 "core_http2_send_flowctl_per_write_99p"] = massage_qps_stats_helpers.percentile(
                     h.buckets, 99, h.boundaries)
+            h = massage_qps_stats_helpers.histogram(
+                core_stats, "http2_write_queued_latency")
+            stats["core_http2_write_queued_latency"] = ",".join(
+                "%f" % x for x in h.buckets)
+            stats["core_http2_write_queued_latency_bkts"] = ",".join(
+                "%f" % x for x in h.boundaries)
+            stats[
+                "core_http2_write_queued_latency_50p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 50, h.boundaries)
+            stats[
+                "core_http2_write_queued_latency_95p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 95, h.boundaries)
+            stats[
+                "core_http2_write_queued_latency_99p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 99, h.boundaries)
+            h = massage_qps_stats_helpers.histogram(
+                core_stats, "http2_write_kernel_latency")
+            stats["core_http2_write_kernel_latency"] = ",".join(
+                "%f" % x for x in h.buckets)
+            stats["core_http2_write_kernel_latency_bkts"] = ",".join(
+                "%f" % x for x in h.boundaries)
+            stats[
+                "core_http2_write_kernel_latency_50p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 50, h.boundaries)
+            stats[
+                "core_http2_write_kernel_latency_95p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 95, h.boundaries)
+            stats[
+                "core_http2_write_kernel_latency_99p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 99, h.boundaries)
+            h = massage_qps_stats_helpers.histogram(core_stats,
+                                                    "http2_write_wire_latency")
+            stats["core_http2_write_wire_latency"] = ",".join(
+                "%f" % x for x in h.buckets)
+            stats["core_http2_write_wire_latency_bkts"] = ",".join(
+                "%f" % x for x in h.boundaries)
+            stats[
+                "core_http2_write_wire_latency_50p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 50, h.boundaries)
+            stats[
+                "core_http2_write_wire_latency_95p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 95, h.boundaries)
+            stats[
+                "core_http2_write_wire_latency_99p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 99, h.boundaries)
+            h = massage_qps_stats_helpers.histogram(
+                core_stats, "combiner_locks_queue_length")
+            stats["core_combiner_locks_queue_length"] = ",".join(
+                "%f" % x for x in h.buckets)
+            stats["core_combiner_locks_queue_length_bkts"] = ",".join(
+                "%f" % x for x in h.boundaries)
+            stats[
+                "core_combiner_locks_queue_length_50p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 50, h.boundaries)
+            stats[
+                "core_combiner_locks_queue_length_95p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 95, h.boundaries)
+            stats[
+                "core_combiner_locks_queue_length_99p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 99, h.boundaries)
+            h = massage_qps_stats_helpers.histogram(
+                core_stats, "exec_ctx_closures_per_flush")
+            stats["core_exec_ctx_closures_per_flush"] = ",".join(
+                "%f" % x for x in h.buckets)
+            stats["core_exec_ctx_closures_per_flush_bkts"] = ",".join(
+                "%f" % x for x in h.boundaries)
+            stats[
+                "core_exec_ctx_closures_per_flush_50p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 50, h.boundaries)
+            stats[
+                "core_exec_ctx_closures_per_flush_95p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 95, h.boundaries)
+            stats[
+                "core_exec_ctx_closures_per_flush_99p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 99, h.boundaries)
             h = massage_qps_stats_helpers.histogram(core_stats,
                                                     "server_cqs_checked")
             stats["core_server_cqs_checked"] = ",".join(
@@ -509,3 +602,48 @@ def massage_qps_stats(scenario_result):
             stats[
                 "core_server_cqs_checked_99p"] = massage_qps_stats_helpers.percentile(
                     h.buckets, 99, h.boundaries)
+            h = massage_qps_stats_helpers.histogram(
+                core_stats, "handshake_offload_queue_time")
+            stats["core_handshake_offload_queue_time"] = ",".join(
+                "%f" % x for x in h.buckets)
+            stats["core_handshake_offload_queue_time_bkts"] = ",".join(
+                "%f" % x for x in h.boundaries)
+            stats[
+                "core_handshake_offload_queue_time_50p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 50, h.boundaries)
+            stats[
+                "core_handshake_offload_queue_time_95p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 95, h.boundaries)
+            stats[
+                "core_handshake_offload_queue_time_99p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 99, h.boundaries)
+            h = massage_qps_stats_helpers.histogram(core_stats,
+                                                    "handshake_step_time")
+            stats["core_handshake_step_time"] = ",".join(
+                "%f" % x for x in h.buckets)
+            stats["core_handshake_step_time_bkts"] = ",".join(
+                "%f" % x for x in h.boundaries)
+            stats[
+                "core_handshake_step_time_50p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 50, h.boundaries)
+            stats[
+                "core_handshake_step_time_95p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 95, h.boundaries)
+            stats[
+                "core_handshake_step_time_99p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 99, h.boundaries)
+            h = massage_qps_stats_helpers.histogram(core_stats,
+                                                    "handshake_duration")
+            stats["core_handshake_duration"] = ",".join(
+                "%f" % x for x in h.buckets)
+            stats["core_handshake_duration_bkts"] = ",".join(
+                "%f" % x for x in h.boundaries)
+            stats[
+                "core_handshake_duration_50p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 50, h.boundaries)
+            stats[
+                "core_handshake_duration_95p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 95, h.boundaries)
+            stats[
+                "core_handshake_duration_99p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 99, h.boundaries)